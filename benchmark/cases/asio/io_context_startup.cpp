@@ -0,0 +1,82 @@
+#include <boost/asio.hpp>
+
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <fstream>
+#include <iomanip>
+#include <iostream>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include <unistd.h>
+
+namespace {
+
+using udp = boost::asio::ip::udp;
+
+auto resident_kb() -> double {
+  std::ifstream statm{"/proc/self/statm"};
+  std::size_t size = 0;
+  std::size_t resident = 0;
+  statm >> size >> resident;
+  return static_cast<double>(resident) * static_cast<double>(::sysconf(_SC_PAGESIZE)) / 1024.0;
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  int contexts = 1;
+  int fds = 0;
+  if (argc >= 3) {
+    contexts = std::stoi(argv[1]);
+    fds = std::stoi(argv[2]);
+  }
+  if (contexts <= 0) {
+    std::cerr << "asio_io_context_startup: contexts must be > 0\n";
+    return 1;
+  }
+  if (fds < 0) {
+    std::cerr << "asio_io_context_startup: fds must be >= 0\n";
+    return 1;
+  }
+
+  std::vector<std::unique_ptr<boost::asio::io_context>> ctxs;
+  ctxs.reserve(static_cast<std::size_t>(contexts));
+  std::vector<udp::socket> sockets;
+  sockets.reserve(static_cast<std::size_t>(contexts) * static_cast<std::size_t>(fds));
+
+  auto const rss_before = resident_kb();
+  auto const start = std::chrono::steady_clock::now();
+  for (int c = 0; c < contexts; ++c) {
+    auto& ctx = *ctxs.emplace_back(std::make_unique<boost::asio::io_context>());
+    // Registered sockets make each context touch its fd table.
+    for (int i = 0; i < fds; ++i) {
+      udp::socket s{ctx};
+      boost::system::error_code ec;
+      s.open(udp::v4(), ec);
+      if (!ec) {
+        s.bind(udp::endpoint{boost::asio::ip::address_v4::loopback(), 0}, ec);
+      }
+      if (ec) {
+        std::cerr << "asio_io_context_startup: bind failed: " << ec.message() << "\n";
+        return 1;
+      }
+      sockets.push_back(std::move(s));
+    }
+  }
+  auto const end = std::chrono::steady_clock::now();
+  auto const rss_after = resident_kb();
+
+  auto const elapsed_s = std::chrono::duration<double>(end - start).count();
+  auto const startup_us = (elapsed_s * 1'000'000.0) / static_cast<double>(contexts);
+  // Floor at one page so the report stays positive when the allocator reuses memory.
+  auto const rss_kb = std::max(4.0, (rss_after - rss_before) / static_cast<double>(contexts));
+
+  std::cout << std::fixed << std::setprecision(2);
+  std::cout << "asio_io_context_startup"
+            << " contexts=" << contexts << " fds=" << fds << " elapsed_s=" << elapsed_s
+            << " startup_us=" << startup_us << " rss_kb=" << rss_kb << "\n";
+  return 0;
+}
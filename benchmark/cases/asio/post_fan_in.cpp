@@ -0,0 +1,75 @@
+#include <boost/asio.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+int main(int argc, char* argv[]) {
+  int producers = 1;
+  std::uint64_t tasks = 1;
+  if (argc >= 3) {
+    producers = std::stoi(argv[1]);
+    tasks = static_cast<std::uint64_t>(std::stoull(argv[2]));
+  }
+  if (producers <= 0) {
+    std::cerr << "asio_post_fan_in: producers must be > 0\n";
+    return 1;
+  }
+  if (tasks == 0) {
+    std::cerr << "asio_post_fan_in: tasks must be > 0\n";
+    return 1;
+  }
+
+  boost::asio::io_context ctx;
+  auto ex = ctx.get_executor();
+  auto guard = boost::asio::make_work_guard(ctx);
+
+  std::atomic<std::uint64_t> remaining{tasks};
+  std::atomic<bool> go{false};
+
+  auto const per_producer = tasks / static_cast<std::uint64_t>(producers);
+  auto const extra = tasks % static_cast<std::uint64_t>(producers);
+
+  std::vector<std::thread> threads;
+  threads.reserve(static_cast<std::size_t>(producers));
+  for (int p = 0; p < producers; ++p) {
+    auto const count = per_producer + (static_cast<std::uint64_t>(p) < extra ? 1 : 0);
+    threads.emplace_back([&, count] {
+      while (!go.load(std::memory_order_acquire)) {
+        std::this_thread::yield();
+      }
+      for (std::uint64_t i = 0; i < count; ++i) {
+        boost::asio::post(ex, [&] {
+          if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+            guard.reset();
+          }
+        });
+      }
+    });
+  }
+
+  auto const start = std::chrono::steady_clock::now();
+  go.store(true, std::memory_order_release);
+  ctx.run();
+  auto const end = std::chrono::steady_clock::now();
+
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  auto const elapsed_s = std::chrono::duration<double>(end - start).count();
+  auto const ops_s = elapsed_s > 0.0 ? static_cast<double>(tasks) / elapsed_s : 0.0;
+  auto const avg_us =
+    elapsed_s > 0.0 ? (elapsed_s * 1'000'000.0) / static_cast<double>(tasks) : 0.0;
+
+  std::cout << std::fixed << std::setprecision(2);
+  std::cout << "asio_post_fan_in"
+            << " producers=" << producers << " tasks=" << tasks << " elapsed_s=" << elapsed_s
+            << " ops_s=" << ops_s << " avg_us=" << avg_us << "\n";
+  return 0;
+}
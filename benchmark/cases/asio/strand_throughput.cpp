@@ -0,0 +1,112 @@
+#include <boost/asio.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+namespace {
+
+// A strand with its share of the tasks. Without producers its tasks form a chain that re-posts
+// itself onto the strand; with producers they are all posted from other threads.
+struct lane {
+  boost::asio::strand<boost::asio::io_context::executor_type> strand;
+  std::uint64_t left = 0;
+
+  void step() {
+    if (--left == 0) {
+      return;
+    }
+    boost::asio::post(strand, [this] { step(); });
+  }
+};
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  int strands = 1;
+  int producers = 0;
+  std::uint64_t tasks = 1;
+  if (argc >= 4) {
+    strands = std::stoi(argv[1]);
+    producers = std::stoi(argv[2]);
+    tasks = static_cast<std::uint64_t>(std::stoull(argv[3]));
+  }
+  if (strands <= 0 || producers < 0) {
+    std::cerr << "asio_strand_throughput: strands must be > 0 and producers >= 0\n";
+    return 1;
+  }
+  if (tasks < static_cast<std::uint64_t>(strands)) {
+    std::cerr << "asio_strand_throughput: tasks must be >= strands\n";
+    return 1;
+  }
+
+  boost::asio::io_context ctx{1};
+  auto guard = boost::asio::make_work_guard(ctx);
+
+  std::vector<lane> lanes;
+  lanes.reserve(static_cast<std::size_t>(strands));
+  for (int i = 0; i < strands; ++i) {
+    lanes.push_back(lane{boost::asio::make_strand(ctx.get_executor()), 0});
+  }
+
+  std::atomic<std::uint64_t> remaining{tasks};
+  std::atomic<bool> go{false};
+  std::vector<std::thread> threads;
+
+  if (producers == 0) {
+    auto const per_strand = tasks / static_cast<std::uint64_t>(strands);
+    auto const extra = tasks % static_cast<std::uint64_t>(strands);
+    for (std::size_t i = 0; i < lanes.size(); ++i) {
+      auto& l = lanes[i];
+      l.left = per_strand + (i < extra ? 1 : 0);
+      boost::asio::post(l.strand, [&l] { l.step(); });
+    }
+    // Chains end on their own; drop the guard once all of them are queued.
+    guard.reset();
+  } else {
+    auto const per_producer = tasks / static_cast<std::uint64_t>(producers);
+    auto const extra = tasks % static_cast<std::uint64_t>(producers);
+    threads.reserve(static_cast<std::size_t>(producers));
+    for (int p = 0; p < producers; ++p) {
+      auto const count = per_producer + (static_cast<std::uint64_t>(p) < extra ? 1 : 0);
+      threads.emplace_back([&, p, count] {
+        while (!go.load(std::memory_order_acquire)) {
+          std::this_thread::yield();
+        }
+        for (std::uint64_t i = 0; i < count; ++i) {
+          auto& l = lanes[(static_cast<std::size_t>(p) + i) % lanes.size()];
+          boost::asio::post(l.strand, [&] {
+            if (remaining.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+              guard.reset();
+            }
+          });
+        }
+      });
+    }
+  }
+
+  auto const start = std::chrono::steady_clock::now();
+  go.store(true, std::memory_order_release);
+  ctx.run();
+  auto const end = std::chrono::steady_clock::now();
+
+  for (auto& t : threads) {
+    t.join();
+  }
+
+  auto const elapsed_s = std::chrono::duration<double>(end - start).count();
+  auto const ops_s = elapsed_s > 0.0 ? static_cast<double>(tasks) / elapsed_s : 0.0;
+  auto const avg_us =
+    elapsed_s > 0.0 ? (elapsed_s * 1'000'000.0) / static_cast<double>(tasks) : 0.0;
+
+  std::cout << std::fixed << std::setprecision(2);
+  std::cout << "asio_strand_throughput"
+            << " strands=" << strands << " producers=" << producers << " tasks=" << tasks
+            << " elapsed_s=" << elapsed_s << " ops_s=" << ops_s << " avg_us=" << avg_us << "\n";
+  return 0;
+}
@@ -0,0 +1,128 @@
+#include <boost/asio.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+
+namespace net = boost::asio;
+using net::awaitable;
+using net::co_spawn;
+using net::detached;
+using net::use_awaitable;
+using net::ip::tcp;
+
+namespace {
+
+struct bench_state {
+  net::io_context* server_ioc = nullptr;
+  net::io_context* client_ioc = nullptr;
+  std::atomic<int> remaining_connects{0};
+  std::atomic<bool> failed{false};
+};
+
+inline void fail_and_stop(bench_state* st, std::string message) {
+  if (!st->failed.exchange(true, std::memory_order_acq_rel)) {
+    std::cerr << message << "\n";
+  }
+  st->server_ioc->stop();
+  st->client_ioc->stop();
+}
+
+auto accept_loop(tcp::acceptor& acceptor, int connections, bench_state* st) -> awaitable<void> {
+  for (int i = 0; i < connections; ++i) {
+    boost::system::error_code ec;
+    auto socket = co_await acceptor.async_accept(net::redirect_error(use_awaitable, ec));
+    if (ec) {
+      fail_and_stop(st, "asio_tcp_accept_storm: accept failed: " + ec.message());
+      co_return;
+    }
+  }
+  st->server_ioc->stop();
+}
+
+auto client_once(tcp::endpoint ep, bench_state* st) -> awaitable<void> {
+  auto ex = co_await net::this_coro::executor;
+  tcp::socket socket{ex};
+
+  boost::system::error_code ec;
+  co_await socket.async_connect(ep, net::redirect_error(use_awaitable, ec));
+  if (ec) {
+    fail_and_stop(st, "asio_tcp_accept_storm: connect failed: " + ec.message());
+    co_return;
+  }
+  if (st->remaining_connects.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    st->client_ioc->stop();
+  }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  int connections = 2000;
+  std::size_t queue = 64;
+  if (argc >= 2) {
+    connections = std::stoi(argv[1]);
+  }
+  if (argc >= 3) {
+    // Accepted for CLI parity; asio has no multishot accept.
+    queue = static_cast<std::size_t>(std::stoul(argv[2]));
+  }
+  if (connections <= 0) {
+    std::cerr << "asio_tcp_accept_storm: connections must be > 0\n";
+    return 1;
+  }
+
+  net::io_context server_ioc;
+  net::io_context client_ioc;
+
+  tcp::acceptor acceptor{server_ioc, tcp::endpoint{net::ip::make_address_v4("127.0.0.1"), 0}};
+  acceptor.listen(net::socket_base::max_listen_connections);
+  auto const listen_ep = acceptor.local_endpoint();
+
+  bench_state st{};
+  st.server_ioc = &server_ioc;
+  st.client_ioc = &client_ioc;
+  st.remaining_connects.store(connections, std::memory_order_release);
+
+  auto server_guard = net::make_work_guard(server_ioc);
+  auto client_guard = net::make_work_guard(client_ioc);
+
+  co_spawn(server_ioc, accept_loop(acceptor, connections, &st), detached);
+  for (int i = 0; i < connections; ++i) {
+    co_spawn(client_ioc, client_once(listen_ep, &st), detached);
+  }
+
+  auto const start = std::chrono::steady_clock::now();
+  std::thread clients([&] { client_ioc.run(); });
+  server_ioc.run();
+  auto const end = std::chrono::steady_clock::now();
+  clients.join();
+
+  if (st.failed.load(std::memory_order_acquire)) {
+    return 1;
+  }
+  if (st.remaining_connects.load(std::memory_order_acquire) != 0) {
+    std::cerr << "asio_tcp_accept_storm: incomplete run (remaining_connects="
+              << st.remaining_connects.load(std::memory_order_relaxed) << ")\n";
+    return 1;
+  }
+
+  auto const elapsed_s = std::chrono::duration<double>(end - start).count();
+  auto const cps = elapsed_s > 0.0 ? static_cast<double>(connections) / elapsed_s : 0.0;
+  auto const avg_us = elapsed_s > 0.0
+                        ? (elapsed_s * 1'000'000.0) / static_cast<double>(connections)
+                        : 0.0;
+
+  std::cout << std::fixed << std::setprecision(2);
+  std::cout << "asio_tcp_accept_storm"
+            << " listen=" << listen_ep.address().to_string() << ":" << listen_ep.port()
+            << " connections=" << connections << " queue=" << queue << " elapsed_s=" << elapsed_s
+            << " cps=" << cps << " avg_us=" << avg_us << "\n";
+
+  return 0;
+}
@@ -9,7 +9,9 @@
 #include <iostream>
 #include <string>
 #include <string_view>
+#include <thread>
 #include <utility>
+#include <vector>
 
 namespace net = boost::asio;
 using net::awaitable;
@@ -122,6 +124,7 @@ int main(int argc, char* argv[]) {
   int sessions = 1;
   int msgs = 1;
   std::size_t msg_bytes = 13;
+  int threads = 1;
   if (argc >= 3) {
     sessions = std::stoi(argv[1]);
     msgs = std::stoi(argv[2]);
@@ -129,12 +132,19 @@ int main(int argc, char* argv[]) {
   if (argc >= 4) {
     msg_bytes = static_cast<std::size_t>(std::stoul(argv[3]));
   }
+  if (argc >= 5) {
+    threads = std::stoi(argv[4]);
+  }
   if (msg_bytes == 0) {
     std::cerr << "asio_tcp_roundtrip: msg_bytes must be > 0\n";
     return 1;
   }
+  if (threads <= 0) {
+    std::cerr << "asio_tcp_roundtrip: threads must be > 0\n";
+    return 1;
+  }
 
-  net::io_context ioc;
+  net::io_context ioc{threads};
 
   tcp::acceptor acceptor{ioc, tcp::endpoint{net::ip::make_address_v4("127.0.0.1"), 0}};
   auto const listen_ep = acceptor.local_endpoint();
@@ -163,7 +173,15 @@ int main(int argc, char* argv[]) {
   }
 
   auto const start = std::chrono::steady_clock::now();
+  std::vector<std::thread> runners;
+  runners.reserve(static_cast<std::size_t>(threads - 1));
+  for (int i = 1; i < threads; ++i) {
+    runners.emplace_back([&ioc] { ioc.run(); });
+  }
   ioc.run();
+  for (auto& t : runners) {
+    t.join();
+  }
   auto const end = std::chrono::steady_clock::now();
 
   if (st.failed.load(std::memory_order_acquire)) {
@@ -185,9 +203,9 @@ int main(int argc, char* argv[]) {
   std::cout << "asio_tcp_roundtrip"
             << " listen=" << listen_ep.address().to_string() << ":" << listen_ep.port()
             << " sessions=" << sessions << " msgs=" << msgs << " msg_bytes=" << payload_bytes
-            << " roundtrips=" << total_roundtrips << " tx_bytes=" << total_tx_bytes
-            << " rx_bytes=" << total_rx_bytes << " elapsed_s=" << elapsed_s << " rps=" << rps
-            << " avg_us=" << avg_us << "\n";
+            << " threads=" << threads << " roundtrips=" << total_roundtrips
+            << " tx_bytes=" << total_tx_bytes << " rx_bytes=" << total_rx_bytes
+            << " elapsed_s=" << elapsed_s << " rps=" << rps << " avg_us=" << avg_us << "\n";
 
   return 0;
 }
@@ -2,10 +2,13 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace net = boost::asio;
 using net::awaitable;
@@ -20,11 +23,21 @@ struct bench_state {
   std::atomic<int> remaining_sessions{0};
   std::atomic<bool> failed{false};
   int waits_per_session = 0;
+  std::vector<std::unique_ptr<net::steady_timer>>* idle_timers = nullptr;
+  std::chrono::steady_clock::time_point end{};
 };
 
+inline void finish(bench_state* st) {
+  st->end = std::chrono::steady_clock::now();
+  for (auto& t : *st->idle_timers) {
+    t->cancel();
+  }
+  st->ioc->stop();
+}
+
 inline void mark_done(bench_state* st) {
   if (st->remaining_sessions.fetch_sub(1, std::memory_order_acq_rel) == 1) {
-    st->ioc->stop();
+    finish(st);
   }
 }
 
@@ -32,7 +45,7 @@ inline void fail_and_stop(bench_state* st, std::string message) {
   if (!st->failed.exchange(true, std::memory_order_acq_rel)) {
     std::cerr << message << "\n";
   }
-  st->ioc->stop();
+  finish(st);
 }
 
 auto timer_session(net::any_io_executor ex, bench_state* st) -> awaitable<void> {
@@ -49,15 +62,30 @@ auto timer_session(net::any_io_executor ex, bench_state* st) -> awaitable<void>
   mark_done(st);
 }
 
+// Long-lived timer that stays armed for the whole run (idle-connection timeout stand-in); it only
+// deepens the timer queue the churning sessions work against.
+auto idle_wait(net::steady_timer* timer) -> awaitable<void> {
+  boost::system::error_code ec;
+  (void)co_await timer->async_wait(net::redirect_error(use_awaitable, ec));
+}
+
 }  // namespace
 
 int main(int argc, char* argv[]) {
   int sessions = 1;
   int waits = 1;
+  int idle = 0;
+  int wheel = 0;
   if (argc >= 3) {
     sessions = std::stoi(argv[1]);
     waits = std::stoi(argv[2]);
   }
+  if (argc >= 4) {
+    idle = std::stoi(argv[3]);
+  }
+  if (argc >= 5) {
+    wheel = std::stoi(argv[4]);
+  }
   if (sessions <= 0) {
     std::cerr << "asio_timer_churn: sessions must be > 0\n";
     return 1;
@@ -66,15 +94,38 @@ int main(int argc, char* argv[]) {
     std::cerr << "asio_timer_churn: waits must be > 0\n";
     return 1;
   }
+  if (idle < 0) {
+    std::cerr << "asio_timer_churn: idle must be >= 0\n";
+    return 1;
+  }
+  if (wheel != 0 && wheel != 1) {
+    std::cerr << "asio_timer_churn: wheel must be 0 or 1\n";
+    return 1;
+  }
 
+  // asio has a single (heap) timer queue; `wheel` is accepted for scenario symmetry only.
   net::io_context ioc;
+  auto ex = ioc.get_executor();
+
+  std::vector<std::unique_ptr<net::steady_timer>> idle_timers{};
+  idle_timers.reserve(static_cast<std::size_t>(idle));
+  for (int i = 0; i < idle; ++i) {
+    auto& t = idle_timers.emplace_back(std::make_unique<net::steady_timer>(ex));
+    t->expires_after(std::chrono::hours{1} + std::chrono::milliseconds{i});
+    co_spawn(ex, idle_wait(t.get()), detached);
+  }
 
   bench_state st{};
   st.ioc = &ioc;
   st.waits_per_session = waits;
+  st.idle_timers = &idle_timers;
   st.remaining_sessions.store(sessions, std::memory_order_release);
 
-  auto ex = ioc.get_executor();
+  // Arm the idle timers before the measured section (poll() stops the context once it runs
+  // out of ready handlers).
+  (void)ioc.poll();
+  ioc.restart();
+
   for (int i = 0; i < sessions; ++i) {
     co_spawn(ex, timer_session(ex, &st), detached);
   }
@@ -83,7 +134,11 @@ int main(int argc, char* argv[]) {
 
   auto const start = std::chrono::steady_clock::now();
   ioc.run();
-  auto const end = std::chrono::steady_clock::now();
+  auto const end = st.end;
+
+  // Let the cancelled idle waits unwind.
+  ioc.restart();
+  ioc.run();
 
   if (st.failed.load(std::memory_order_acquire)) {
     return 1;
@@ -102,7 +157,8 @@ int main(int argc, char* argv[]) {
 
   std::cout << std::fixed << std::setprecision(2);
   std::cout << "asio_timer_churn"
-            << " sessions=" << sessions << " waits=" << waits << " total_waits=" << total_waits
+            << " sessions=" << sessions << " waits=" << waits << " idle=" << idle
+            << " wheel=" << wheel << " total_waits=" << total_waits
             << " elapsed_s=" << elapsed_s << " ops_s=" << ops_s << " avg_us=" << avg_us << "\n";
 
   return 0;
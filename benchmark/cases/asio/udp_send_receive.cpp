@@ -1,5 +1,6 @@
 #include <boost/asio.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstddef>
@@ -24,6 +25,8 @@ struct bench_state {
   std::atomic<bool> failed{false};
   int msgs_per_session = 0;
   std::size_t msg_bytes = 0;
+  // Datagrams per client burst. Asio has no batch API, so a burst is `batch` single sends.
+  int batch = 1;
 };
 
 inline void mark_done(bench_state* st) {
@@ -73,28 +76,35 @@ auto client_session(udp::socket socket, udp::endpoint destination,
   std::vector<std::byte> payload(st->msg_bytes, std::byte{0x78});
   std::vector<std::byte> ack(st->msg_bytes);
   udp::endpoint src{};
-  for (int i = 0; i < st->msgs_per_session; ++i) {
+  int done = 0;
+  while (done < st->msgs_per_session) {
+    auto const burst = (std::min)(st->batch, st->msgs_per_session - done);
     boost::system::error_code ec;
-    auto n = co_await socket.async_send_to(net::buffer(payload), destination,
-                                           net::redirect_error(use_awaitable, ec));
-    if (ec || n != payload.size()) {
-      if (ec) {
-        fail_and_stop(st, "asio_udp_send_receive: client send failed: " + ec.message());
-      } else {
-        fail_and_stop(st, "asio_udp_send_receive: client send size mismatch");
+    for (int i = 0; i < burst; ++i) {
+      auto n = co_await socket.async_send_to(net::buffer(payload), destination,
+                                             net::redirect_error(use_awaitable, ec));
+      if (ec || n != payload.size()) {
+        if (ec) {
+          fail_and_stop(st, "asio_udp_send_receive: client send failed: " + ec.message());
+        } else {
+          fail_and_stop(st, "asio_udp_send_receive: client send size mismatch");
+        }
+        co_return;
       }
-      co_return;
     }
-    n = co_await socket.async_receive_from(net::buffer(ack), src,
-                                           net::redirect_error(use_awaitable, ec));
-    if (ec || n != ack.size()) {
-      if (ec) {
-        fail_and_stop(st, "asio_udp_send_receive: client receive failed: " + ec.message());
-      } else {
-        fail_and_stop(st, "asio_udp_send_receive: client receive size mismatch");
+    for (int i = 0; i < burst; ++i) {
+      auto n = co_await socket.async_receive_from(net::buffer(ack), src,
+                                                  net::redirect_error(use_awaitable, ec));
+      if (ec || n != ack.size()) {
+        if (ec) {
+          fail_and_stop(st, "asio_udp_send_receive: client receive failed: " + ec.message());
+        } else {
+          fail_and_stop(st, "asio_udp_send_receive: client receive size mismatch");
+        }
+        co_return;
       }
-      co_return;
     }
+    done += burst;
   }
   mark_done(st);
 }
@@ -112,6 +122,10 @@ int main(int argc, char* argv[]) {
   if (argc >= 4) {
     msg_bytes = static_cast<std::size_t>(std::stoull(argv[3]));
   }
+  int batch = 1;
+  if (argc >= 5) {
+    batch = std::stoi(argv[4]);
+  }
   if (sessions <= 0) {
     std::cerr << "asio_udp_send_receive: sessions must be > 0\n";
     return 1;
@@ -124,6 +138,10 @@ int main(int argc, char* argv[]) {
     std::cerr << "asio_udp_send_receive: msg_bytes must be > 0\n";
     return 1;
   }
+  if (batch <= 0) {
+    std::cerr << "asio_udp_send_receive: batch must be > 0\n";
+    return 1;
+  }
 
   net::io_context ioc;
 
@@ -131,6 +149,7 @@ int main(int argc, char* argv[]) {
   st.ioc = &ioc;
   st.msgs_per_session = msgs;
   st.msg_bytes = msg_bytes;
+  st.batch = batch;
   st.remaining_events.store(sessions * 2, std::memory_order_release);
 
   std::vector<udp::endpoint> server_endpoints;
@@ -216,6 +235,7 @@ int main(int argc, char* argv[]) {
   std::cout << std::fixed << std::setprecision(2);
   std::cout << "asio_udp_send_receive"
             << " sessions=" << sessions << " msgs=" << msgs << " msg_bytes=" << msg_bytes
+            << " batch=" << batch
             << " total_messages=" << total_messages << " total_bytes=" << total_bytes
             << " elapsed_s=" << elapsed_s << " pps=" << pps
             << " throughput_mib_s=" << throughput_mib_s << " avg_us=" << avg_us << "\n";
@@ -0,0 +1,138 @@
+#include <iocoro/iocoro.hpp>
+
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <iomanip>
+#include <iostream>
+#include <string>
+#include <thread>
+
+namespace {
+
+using iocoro::ip::tcp;
+
+struct bench_state {
+  iocoro::io_context* server_ctx = nullptr;
+  iocoro::io_context* client_ctx = nullptr;
+  std::atomic<int> remaining_connects{0};
+  std::atomic<bool> failed{false};
+};
+
+inline void fail_and_stop(bench_state* st, std::string message) {
+  if (!st->failed.exchange(true, std::memory_order_acq_rel)) {
+    std::cerr << message << "\n";
+  }
+  st->server_ctx->stop();
+  st->client_ctx->stop();
+}
+
+// Accepts every connection of the storm and drops it right away.
+auto accept_loop(tcp::acceptor& acceptor, int connections,
+                 bench_state* st) -> iocoro::awaitable<void> {
+  for (int i = 0; i < connections; ++i) {
+    auto accepted = co_await acceptor.async_accept();
+    if (!accepted) {
+      fail_and_stop(st, "iocoro_tcp_accept_storm: accept failed: " + accepted.error().message());
+      co_return;
+    }
+  }
+  st->server_ctx->stop();
+}
+
+auto client_once(iocoro::io_context& ctx, tcp::endpoint ep,
+                 bench_state* st) -> iocoro::awaitable<void> {
+  tcp::socket socket{ctx};
+  auto cr = co_await socket.async_connect(ep);
+  if (!cr) {
+    fail_and_stop(st, "iocoro_tcp_accept_storm: connect failed: " + cr.error().message());
+    co_return;
+  }
+  if (st->remaining_connects.fetch_sub(1, std::memory_order_acq_rel) == 1) {
+    st->client_ctx->stop();
+  }
+}
+
+}  // namespace
+
+int main(int argc, char* argv[]) {
+  int connections = 2000;
+  std::size_t queue = 64;
+  if (argc >= 2) {
+    connections = std::stoi(argv[1]);
+  }
+  if (argc >= 3) {
+    queue = static_cast<std::size_t>(std::stoul(argv[2]));
+  }
+  if (connections <= 0) {
+    std::cerr << "iocoro_tcp_accept_storm: connections must be > 0\n";
+    return 1;
+  }
+
+  iocoro::io_context server_ctx;
+  iocoro::io_context client_ctx;
+
+  tcp::acceptor acceptor{server_ctx};
+  auto listen_ep = tcp::endpoint{iocoro::ip::address_v4::loopback(), 0};
+  auto lr = acceptor.listen(listen_ep, SOMAXCONN);
+  if (!lr) {
+    std::cerr << "iocoro_tcp_accept_storm: listen failed: " << lr.error().message() << "\n";
+    return 1;
+  }
+  // 0 keeps one accept request per connection.
+  acceptor.set_multishot_accept(queue);
+
+  auto ep_r = acceptor.local_endpoint();
+  if (!ep_r) {
+    std::cerr << "iocoro_tcp_accept_storm: local_endpoint failed: " << ep_r.error().message()
+              << "\n";
+    return 1;
+  }
+
+  bench_state st{};
+  st.server_ctx = &server_ctx;
+  st.client_ctx = &client_ctx;
+  st.remaining_connects.store(connections, std::memory_order_release);
+
+  auto server_guard = iocoro::make_work_guard(server_ctx);
+  auto client_guard = iocoro::make_work_guard(client_ctx);
+
+  iocoro::co_spawn(server_ctx.get_executor(), accept_loop(acceptor, connections, &st),
+                   iocoro::detached);
+  // The whole storm is launched up front from a separate context, so connections pile up in
+  // the listen backlog faster than one accept at a time drains them.
+  for (int i = 0; i < connections; ++i) {
+    iocoro::co_spawn(client_ctx.get_executor(), client_once(client_ctx, *ep_r, &st),
+                     iocoro::detached);
+  }
+
+  auto const start = std::chrono::steady_clock::now();
+  std::thread clients([&] { client_ctx.run(); });
+  server_ctx.run();
+  auto const end = std::chrono::steady_clock::now();
+  clients.join();
+
+  if (st.failed.load(std::memory_order_acquire)) {
+    return 1;
+  }
+  if (st.remaining_connects.load(std::memory_order_acquire) != 0) {
+    std::cerr << "iocoro_tcp_accept_storm: incomplete run (remaining_connects="
+              << st.remaining_connects.load(std::memory_order_relaxed) << ")\n";
+    return 1;
+  }
+
+  auto const elapsed_s = std::chrono::duration<double>(end - start).count();
+  auto const cps = elapsed_s > 0.0 ? static_cast<double>(connections) / elapsed_s : 0.0;
+  auto const avg_us = elapsed_s > 0.0
+                        ? (elapsed_s * 1'000'000.0) / static_cast<double>(connections)
+                        : 0.0;
+
+  std::cout << std::fixed << std::setprecision(2);
+  std::cout << "iocoro_tcp_accept_storm"
+            << " listen=" << ep_r->to_string() << " connections=" << connections
+            << " queue=" << queue << " elapsed_s=" << elapsed_s << " cps=" << cps
+            << " avg_us=" << avg_us << "\n";
+
+  return 0;
+}
@@ -127,6 +127,7 @@ int main(int argc, char* argv[]) {
   int sessions = 1;
   int msgs = 1;
   std::size_t msg_bytes = 64;
+  long busy_poll_us = 0;
   if (argc >= 3) {
     sessions = std::stoi(argv[1]);
     msgs = std::stoi(argv[2]);
@@ -134,6 +135,10 @@ int main(int argc, char* argv[]) {
   if (argc >= 4) {
     msg_bytes = static_cast<std::size_t>(std::stoull(argv[3]));
   }
+  // Optional, not part of the suite's scenario tuple: io_context busy-poll window.
+  if (argc >= 5) {
+    busy_poll_us = std::stol(argv[4]);
+  }
   if (sessions <= 0) {
     std::cerr << "iocoro_tcp_latency: sessions must be > 0\n";
     return 1;
@@ -147,7 +152,9 @@ int main(int argc, char* argv[]) {
     return 1;
   }
 
-  iocoro::io_context ctx;
+  iocoro::io_context::options opts{};
+  opts.busy_poll = std::chrono::microseconds{busy_poll_us};
+  iocoro::io_context ctx{opts};
 
   tcp::acceptor acceptor{ctx};
   auto listen_ep = tcp::endpoint{iocoro::ip::address_v4::loopback(), 0};
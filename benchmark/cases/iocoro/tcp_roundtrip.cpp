@@ -8,7 +8,9 @@
 #include <iomanip>
 #include <iostream>
 #include <string>
+#include <thread>
 #include <utility>
+#include <vector>
 
 namespace {
 
@@ -101,6 +103,7 @@ int main(int argc, char* argv[]) {
   int sessions = 1;
   int msgs = 1;
   std::size_t msg_bytes = 13;
+  int threads = 1;
   if (argc >= 3) {
     sessions = std::stoi(argv[1]);
     msgs = std::stoi(argv[2]);
@@ -108,10 +111,17 @@ int main(int argc, char* argv[]) {
   if (argc >= 4) {
     msg_bytes = static_cast<std::size_t>(std::stoul(argv[3]));
   }
+  if (argc >= 5) {
+    threads = std::stoi(argv[4]);
+  }
   if (msg_bytes == 0) {
     std::cerr << "iocoro_tcp_roundtrip: msg_bytes must be > 0\n";
     return 1;
   }
+  if (threads <= 0) {
+    std::cerr << "iocoro_tcp_roundtrip: threads must be > 0\n";
+    return 1;
+  }
 
   iocoro::io_context ctx;
 
@@ -156,7 +166,15 @@ int main(int argc, char* argv[]) {
   auto const total_rx_bytes = total_roundtrips * payload_bytes;
 
   auto const start = std::chrono::steady_clock::now();
+  std::vector<std::thread> runners;
+  runners.reserve(static_cast<std::size_t>(threads - 1));
+  for (int i = 1; i < threads; ++i) {
+    runners.emplace_back([&ctx] { ctx.run(); });
+  }
   ctx.run();
+  for (auto& t : runners) {
+    t.join();
+  }
   auto const end = std::chrono::steady_clock::now();
 
   if (st.failed.load(std::memory_order_acquire)) {
@@ -177,9 +195,10 @@ int main(int argc, char* argv[]) {
   std::cout << std::fixed << std::setprecision(2);
   std::cout << "iocoro_tcp_roundtrip"
             << " listen=" << ep_r->to_string() << " sessions=" << sessions << " msgs=" << msgs
-            << " msg_bytes=" << payload_bytes << " roundtrips=" << total_roundtrips
-            << " tx_bytes=" << total_tx_bytes << " rx_bytes=" << total_rx_bytes
-            << " elapsed_s=" << elapsed_s << " rps=" << rps << " avg_us=" << avg_us << "\n";
+            << " msg_bytes=" << payload_bytes << " threads=" << threads
+            << " roundtrips=" << total_roundtrips << " tx_bytes=" << total_tx_bytes
+            << " rx_bytes=" << total_rx_bytes << " elapsed_s=" << elapsed_s << " rps=" << rps
+            << " avg_us=" << avg_us << "\n";
 
   return 0;
 }
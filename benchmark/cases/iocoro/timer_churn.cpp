@@ -2,10 +2,13 @@
 
 #include <atomic>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <iomanip>
 #include <iostream>
+#include <memory>
 #include <string>
+#include <vector>
 
 namespace {
 
@@ -14,11 +17,21 @@ struct bench_state {
   std::atomic<int> remaining_sessions{0};
   std::atomic<bool> failed{false};
   int waits_per_session = 0;
+  std::vector<std::unique_ptr<iocoro::steady_timer>>* idle_timers = nullptr;
+  std::chrono::steady_clock::time_point end{};
 };
 
+inline void finish(bench_state* st) {
+  st->end = std::chrono::steady_clock::now();
+  for (auto& t : *st->idle_timers) {
+    t->cancel();
+  }
+  st->ctx->stop();
+}
+
 inline void mark_done(bench_state* st) {
   if (st->remaining_sessions.fetch_sub(1, std::memory_order_acq_rel) == 1) {
-    st->ctx->stop();
+    finish(st);
   }
 }
 
@@ -26,7 +39,7 @@ inline void fail_and_stop(bench_state* st, std::string message) {
   if (!st->failed.exchange(true, std::memory_order_acq_rel)) {
     std::cerr << message << "\n";
   }
-  st->ctx->stop();
+  finish(st);
 }
 
 auto timer_session(iocoro::any_io_executor ex, bench_state* st) -> iocoro::awaitable<void> {
@@ -42,15 +55,29 @@ auto timer_session(iocoro::any_io_executor ex, bench_state* st) -> iocoro::await
   mark_done(st);
 }
 
+// Long-lived timer that stays armed for the whole run (idle-connection timeout stand-in); it only
+// deepens the timer queue the churning sessions work against.
+auto idle_wait(iocoro::steady_timer* timer) -> iocoro::awaitable<void> {
+  (void)co_await timer->async_wait(iocoro::use_awaitable);
+}
+
 }  // namespace
 
 int main(int argc, char* argv[]) {
   int sessions = 1;
   int waits = 1;
+  int idle = 0;
+  int wheel = 0;
   if (argc >= 3) {
     sessions = std::stoi(argv[1]);
     waits = std::stoi(argv[2]);
   }
+  if (argc >= 4) {
+    idle = std::stoi(argv[3]);
+  }
+  if (argc >= 5) {
+    wheel = std::stoi(argv[4]);
+  }
   if (sessions <= 0) {
     std::cerr << "iocoro_timer_churn: sessions must be > 0\n";
     return 1;
@@ -59,16 +86,37 @@ int main(int argc, char* argv[]) {
     std::cerr << "iocoro_timer_churn: waits must be > 0\n";
     return 1;
   }
+  if (idle < 0) {
+    std::cerr << "iocoro_timer_churn: idle must be >= 0\n";
+    return 1;
+  }
+  if (wheel != 0 && wheel != 1) {
+    std::cerr << "iocoro_timer_churn: wheel must be 0 or 1\n";
+    return 1;
+  }
 
-  iocoro::io_context ctx;
+  iocoro::io_context ctx{{.timers = wheel != 0 ? iocoro::io_context::timer_queue_kind::wheel
+                                               : iocoro::io_context::timer_queue_kind::heap}};
   auto ex = ctx.get_executor();
   auto guard = iocoro::make_work_guard(ctx);
 
+  std::vector<std::unique_ptr<iocoro::steady_timer>> idle_timers{};
+  idle_timers.reserve(static_cast<std::size_t>(idle));
+  for (int i = 0; i < idle; ++i) {
+    auto& t = idle_timers.emplace_back(std::make_unique<iocoro::steady_timer>(ex));
+    t->expires_after(std::chrono::hours{1} + std::chrono::milliseconds{i});
+    iocoro::co_spawn(ex, idle_wait(t.get()), iocoro::detached);
+  }
+
   bench_state st{};
   st.ctx = &ctx;
   st.waits_per_session = waits;
+  st.idle_timers = &idle_timers;
   st.remaining_sessions.store(sessions, std::memory_order_release);
 
+  // Arm the idle timers before the measured section.
+  (void)ctx.run_for(std::chrono::milliseconds{10});
+
   for (int i = 0; i < sessions; ++i) {
     iocoro::co_spawn(ex, timer_session(ex, &st), iocoro::detached);
   }
@@ -77,7 +125,12 @@ int main(int argc, char* argv[]) {
 
   auto const start = std::chrono::steady_clock::now();
   ctx.run();
-  auto const end = std::chrono::steady_clock::now();
+  auto const end = st.end;
+
+  // Let the cancelled idle waits unwind.
+  guard.reset();
+  ctx.restart();
+  ctx.run();
 
   if (st.failed.load(std::memory_order_acquire)) {
     return 1;
@@ -96,7 +149,8 @@ int main(int argc, char* argv[]) {
 
   std::cout << std::fixed << std::setprecision(2);
   std::cout << "iocoro_timer_churn"
-            << " sessions=" << sessions << " waits=" << waits << " total_waits=" << total_waits
+            << " sessions=" << sessions << " waits=" << waits << " idle=" << idle
+            << " wheel=" << wheel << " total_waits=" << total_waits
             << " elapsed_s=" << elapsed_s << " ops_s=" << ops_s << " avg_us=" << avg_us << "\n";
 
   return 0;
@@ -1,11 +1,13 @@
 #include <iocoro/iocoro.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <chrono>
 #include <cstddef>
 #include <cstdint>
 #include <iomanip>
 #include <iostream>
+#include <span>
 #include <string>
 #include <vector>
 
@@ -19,6 +21,8 @@ struct bench_state {
   std::atomic<bool> failed{false};
   int msgs_per_session = 0;
   std::size_t msg_bytes = 0;
+  // Datagrams per client burst; above 1 both sides use the batch (sendmmsg/recvmmsg) API.
+  int batch = 1;
 };
 
 inline void mark_done(bench_state* st) {
@@ -88,6 +92,93 @@ auto client_session(udp::socket socket, udp::endpoint destination,
   mark_done(st);
 }
 
+// Echo every datagram back to its sender, a batch at a time.
+auto server_batch_session(udp::socket socket, bench_state* st) -> iocoro::awaitable<void> {
+  auto const slots = static_cast<std::size_t>(st->batch);
+  std::vector<std::byte> storage(slots * st->msg_bytes);
+  std::vector<udp::socket::incoming_datagram_type> in(slots);
+  std::vector<udp::socket::outgoing_datagram_type> out(slots);
+  for (std::size_t i = 0; i < slots; ++i) {
+    in[i].buffer = iocoro::net::buffer(storage.data() + i * st->msg_bytes, st->msg_bytes);
+  }
+
+  int received = 0;
+  while (received < st->msgs_per_session) {
+    auto r = co_await socket.async_receive_batch(in);
+    if (!r) {
+      fail_and_stop(st, "iocoro_udp_send_receive: server receive failed: " + r.error().message());
+      co_return;
+    }
+    for (std::size_t i = 0; i < *r; ++i) {
+      if (in[i].size != st->msg_bytes) {
+        fail_and_stop(st, "iocoro_udp_send_receive: server receive size mismatch");
+        co_return;
+      }
+      out[i] = {iocoro::net::buffer(in[i].buffer.data(), in[i].size), in[i].source};
+    }
+    received += static_cast<int>(*r);
+
+    std::span<udp::socket::outgoing_datagram_type const> pending{out.data(), *r};
+    while (!pending.empty()) {
+      auto w = co_await socket.async_send_batch(pending);
+      if (!w) {
+        fail_and_stop(st, "iocoro_udp_send_receive: server send failed: " + w.error().message());
+        co_return;
+      }
+      pending = pending.subspan(*w);
+    }
+  }
+  mark_done(st);
+}
+
+// Send a burst of `batch` datagrams, then wait for all of their echoes.
+auto client_batch_session(udp::socket socket, udp::endpoint destination,
+                          bench_state* st) -> iocoro::awaitable<void> {
+  auto const slots = static_cast<std::size_t>(st->batch);
+  std::vector<std::byte> payload(st->msg_bytes, std::byte{0x78});
+  std::vector<std::byte> acks(slots * st->msg_bytes);
+  std::vector<udp::socket::outgoing_datagram_type> out(
+    slots, {iocoro::net::buffer(payload), destination});
+  std::vector<udp::socket::incoming_datagram_type> in(slots);
+  for (std::size_t i = 0; i < slots; ++i) {
+    in[i].buffer = iocoro::net::buffer(acks.data() + i * st->msg_bytes, st->msg_bytes);
+  }
+
+  int done = 0;
+  while (done < st->msgs_per_session) {
+    auto const burst = (std::min)(slots, static_cast<std::size_t>(st->msgs_per_session - done));
+
+    std::span<udp::socket::outgoing_datagram_type const> pending{out.data(), burst};
+    while (!pending.empty()) {
+      auto w = co_await socket.async_send_batch(pending);
+      if (!w) {
+        fail_and_stop(st, "iocoro_udp_send_receive: client send failed: " + w.error().message());
+        co_return;
+      }
+      pending = pending.subspan(*w);
+    }
+
+    std::size_t acked = 0;
+    while (acked < burst) {
+      auto r = co_await socket.async_receive_batch(std::span{in}.first(burst - acked));
+      if (!r) {
+        fail_and_stop(st,
+                      "iocoro_udp_send_receive: client receive failed: " + r.error().message());
+        co_return;
+      }
+      for (std::size_t i = 0; i < *r; ++i) {
+        if (in[i].size != st->msg_bytes) {
+          fail_and_stop(st, "iocoro_udp_send_receive: client receive size mismatch");
+          co_return;
+        }
+      }
+      acked += *r;
+    }
+    done += static_cast<int>(burst);
+  }
+  mark_done(st);
+}
+
 }  // namespace
 
 int main(int argc, char* argv[]) {
@@ -101,6 +192,10 @@ int main(int argc, char* argv[]) {
   if (argc >= 4) {
     msg_bytes = static_cast<std::size_t>(std::stoull(argv[3]));
   }
+  int batch = 1;
+  if (argc >= 5) {
+    batch = std::stoi(argv[4]);
+  }
   if (sessions <= 0) {
     std::cerr << "iocoro_udp_send_receive: sessions must be > 0\n";
     return 1;
@@ -113,6 +208,11 @@ int main(int argc, char* argv[]) {
     std::cerr << "iocoro_udp_send_receive: msg_bytes must be > 0\n";
     return 1;
   }
+  if (batch <= 0 || static_cast<std::size_t>(batch) > udp::socket::max_batch) {
+    std::cerr << "iocoro_udp_send_receive: batch must be in [1, " << udp::socket::max_batch
+              << "]\n";
+    return 1;
+  }
 
   iocoro::io_context ctx;
 
@@ -120,6 +220,7 @@ int main(int argc, char* argv[]) {
   st.ctx = &ctx;
   st.msgs_per_session = msgs;
   st.msg_bytes = msg_bytes;
+  st.batch = batch;
   st.remaining_events.store(sessions * 2, std::memory_order_release);
 
   std::vector<udp::endpoint> server_endpoints;
@@ -160,14 +261,18 @@ int main(int argc, char* argv[]) {
   auto guard = iocoro::make_work_guard(ctx);
 
   for (int i = 0; i < sessions; ++i) {
+    auto server = std::move(server_sockets[static_cast<std::size_t>(i)]);
     iocoro::co_spawn(ex,
-                     server_session(std::move(server_sockets[static_cast<std::size_t>(i)]), &st),
+                     batch > 1 ? server_batch_session(std::move(server), &st)
+                               : server_session(std::move(server), &st),
                      iocoro::detached);
   }
   for (int i = 0; i < sessions; ++i) {
+    auto client = std::move(client_sockets[static_cast<std::size_t>(i)]);
+    auto const& destination = server_endpoints[static_cast<std::size_t>(i)];
     iocoro::co_spawn(ex,
-                     client_session(std::move(client_sockets[static_cast<std::size_t>(i)]),
-                                    server_endpoints[static_cast<std::size_t>(i)], &st),
+                     batch > 1 ? client_batch_session(std::move(client), destination, &st)
+                               : client_session(std::move(client), destination, &st),
                      iocoro::detached);
   }
 
@@ -199,6 +304,7 @@ int main(int argc, char* argv[]) {
   std::cout << std::fixed << std::setprecision(2);
   std::cout << "iocoro_udp_send_receive"
             << " sessions=" << sessions << " msgs=" << msgs << " msg_bytes=" << msg_bytes
+            << " batch=" << batch
             << " total_messages=" << total_messages << " total_bytes=" << total_bytes
             << " elapsed_s=" << elapsed_s << " pps=" << pps
             << " throughput_mib_s=" << throughput_mib_s << " avg_us=" << avg_us << "\n";
@@ -67,9 +67,15 @@ run_step_no_summary() {
 suite_fields_csv() {
   local suite_id="$1"
   case "$suite_id" in
-    tcp_roundtrip|tcp_latency|udp_send_receive)
+    tcp_roundtrip)
+      echo "sessions,msgs,msg_bytes,threads"
+      ;;
+    tcp_latency)
       echo "sessions,msgs,msg_bytes"
       ;;
+    udp_send_receive)
+      echo "sessions,msgs,msg_bytes,batch"
+      ;;
     tcp_connect_accept)
       echo "connections"
       ;;
@@ -77,11 +83,23 @@ suite_fields_csv() {
       echo "sessions,bytes_per_session,chunk_bytes"
       ;;
     timer_churn)
-      echo "sessions,waits"
+      echo "sessions,waits,idle,wheel"
       ;;
     thread_pool_scaling)
       echo "workers,tasks"
       ;;
+    post_fan_in)
+      echo "producers,tasks"
+      ;;
+    strand_throughput)
+      echo "strands,producers,tasks"
+      ;;
+    tcp_accept_storm)
+      echo "connections,queue"
+      ;;
+    io_context_startup)
+      echo "contexts,fds"
+      ;;
     *)
       echo "Unknown suite id: $suite_id" >&2
       return 1
@@ -160,7 +178,8 @@ serialize_scenario_rows() {
         echo "Expected fields: $fields_csv" >&2
         return 1
       fi
-      bench_require_positive_int "${suite_id}.SCENARIO_ROWS[$idx].$key" "$value"
+      # Zero is meaningful for some fields (counts, on/off switches); binaries validate ranges.
+      bench_require_non_negative_int "${suite_id}.SCENARIO_ROWS[$idx].$key" "$value"
       kv["$key"]="$value"
     done
 
@@ -244,6 +263,10 @@ TCP_THROUGHPUT_SCENARIOS_OVERRIDE=""
 UDP_SEND_RECEIVE_SCENARIOS_OVERRIDE=""
 TIMER_CHURN_SCENARIOS_OVERRIDE=""
 THREAD_POOL_SCALING_SCENARIOS_OVERRIDE=""
+POST_FAN_IN_SCENARIOS_OVERRIDE=""
+STRAND_THROUGHPUT_SCENARIOS_OVERRIDE=""
+TCP_ACCEPT_STORM_SCENARIOS_OVERRIDE=""
+IO_CONTEXT_STARTUP_SCENARIOS_OVERRIDE=""
 
 TCP_ROUNDTRIP_TIMEOUT_OVERRIDE=""
 TCP_LATENCY_TIMEOUT_OVERRIDE=""
@@ -252,6 +275,10 @@ TCP_THROUGHPUT_TIMEOUT_OVERRIDE=""
 UDP_SEND_RECEIVE_TIMEOUT_OVERRIDE=""
 TIMER_CHURN_TIMEOUT_OVERRIDE=""
 THREAD_POOL_SCALING_TIMEOUT_OVERRIDE=""
+POST_FAN_IN_TIMEOUT_OVERRIDE=""
+STRAND_THROUGHPUT_TIMEOUT_OVERRIDE=""
+TCP_ACCEPT_STORM_TIMEOUT_OVERRIDE=""
+IO_CONTEXT_STARTUP_TIMEOUT_OVERRIDE=""
 
 TCP_ROUNDTRIP_CONFIG=""
 TCP_LATENCY_CONFIG=""
@@ -260,6 +287,10 @@ TCP_THROUGHPUT_CONFIG=""
 UDP_SEND_RECEIVE_CONFIG=""
 TIMER_CHURN_CONFIG=""
 THREAD_POOL_SCALING_CONFIG=""
+POST_FAN_IN_CONFIG=""
+STRAND_THROUGHPUT_CONFIG=""
+TCP_ACCEPT_STORM_CONFIG=""
+IO_CONTEXT_STARTUP_CONFIG=""
 
 ENABLE_SCHEMA_VALIDATE=true
 
@@ -270,6 +301,10 @@ TCP_THROUGHPUT_REPORT="$PROJECT_DIR/benchmark/reports/tcp_throughput.report.json
 UDP_SEND_RECEIVE_REPORT="$PROJECT_DIR/benchmark/reports/udp_send_receive.report.json"
 TIMER_CHURN_REPORT="$PROJECT_DIR/benchmark/reports/timer_churn.report.json"
 THREAD_POOL_SCALING_REPORT="$PROJECT_DIR/benchmark/reports/thread_pool_scaling.report.json"
+POST_FAN_IN_REPORT="$PROJECT_DIR/benchmark/reports/post_fan_in.report.json"
+STRAND_THROUGHPUT_REPORT="$PROJECT_DIR/benchmark/reports/strand_throughput.report.json"
+TCP_ACCEPT_STORM_REPORT="$PROJECT_DIR/benchmark/reports/tcp_accept_storm.report.json"
+IO_CONTEXT_STARTUP_REPORT="$PROJECT_DIR/benchmark/reports/io_context_startup.report.json"
 
 FAILED_STEPS=()
 
@@ -285,6 +320,10 @@ Run all performance benchmark suites:
 - udp_send_receive
 - timer_churn
 - thread_pool_scaling
+- post_fan_in
+- strand_throughput
+- tcp_accept_storm
+- io_context_startup
 
 Suite defaults come from one file per suite under `benchmark/conf/*.conf`.
 Each file must define: ITERATIONS, WARMUP, TIMEOUT_SEC, SCENARIO_ROWS.
@@ -311,6 +350,10 @@ Options:
   --udp-send-receive-config FILE          Config file for udp_send_receive
   --timer-churn-config FILE               Config file for timer_churn
   --thread-pool-scaling-config FILE       Config file for thread_pool_scaling
+  --post-fan-in-config FILE               Config file for post_fan_in
+  --strand-throughput-config FILE         Config file for strand_throughput
+  --tcp-accept-storm-config FILE          Config file for tcp_accept_storm
+  --io-context-startup-config FILE        Config file for io_context_startup
 
   --tcp-roundtrip-scenarios LIST          Override SCENARIOS for tcp_roundtrip
   --tcp-latency-scenarios LIST            Override SCENARIOS for tcp_latency
@@ -319,6 +362,10 @@ Options:
   --udp-send-receive-scenarios LIST       Override SCENARIOS for udp_send_receive
   --timer-churn-scenarios LIST            Override SCENARIOS for timer_churn
   --thread-pool-scaling-scenarios LIST    Override SCENARIOS for thread_pool_scaling
+  --post-fan-in-scenarios LIST            Override SCENARIOS for post_fan_in
+  --strand-throughput-scenarios LIST      Override SCENARIOS for strand_throughput
+  --tcp-accept-storm-scenarios LIST       Override SCENARIOS for tcp_accept_storm
+  --io-context-startup-scenarios LIST     Override SCENARIOS for io_context_startup
 
   --tcp-roundtrip-timeout-sec N           Override TIMEOUT_SEC for tcp_roundtrip
   --tcp-latency-timeout-sec N             Override TIMEOUT_SEC for tcp_latency
@@ -327,6 +374,10 @@ Options:
   --udp-send-receive-timeout-sec N        Override TIMEOUT_SEC for udp_send_receive
   --timer-churn-timeout-sec N             Override TIMEOUT_SEC for timer_churn
   --thread-pool-scaling-timeout-sec N     Override TIMEOUT_SEC for thread_pool_scaling
+  --post-fan-in-timeout-sec N             Override TIMEOUT_SEC for post_fan_in
+  --strand-throughput-timeout-sec N       Override TIMEOUT_SEC for strand_throughput
+  --tcp-accept-storm-timeout-sec N        Override TIMEOUT_SEC for tcp_accept_storm
+  --io-context-startup-timeout-sec N      Override TIMEOUT_SEC for io_context_startup
 
   --tcp-roundtrip-report FILE             Report path (default: benchmark/reports/tcp_roundtrip.report.json)
   --tcp-latency-report FILE               Report path (default: benchmark/reports/tcp_latency.report.json)
@@ -335,6 +386,10 @@ Options:
   --udp-send-receive-report FILE          Report path (default: benchmark/reports/udp_send_receive.report.json)
   --timer-churn-report FILE               Report path (default: benchmark/reports/timer_churn.report.json)
   --thread-pool-scaling-report FILE       Report path (default: benchmark/reports/thread_pool_scaling.report.json)
+  --post-fan-in-report FILE               Report path (default: benchmark/reports/post_fan_in.report.json)
+  --strand-throughput-report FILE         Report path (default: benchmark/reports/strand_throughput.report.json)
+  --tcp-accept-storm-report FILE          Report path (default: benchmark/reports/tcp_accept_storm.report.json)
+  --io-context-startup-report FILE        Report path (default: benchmark/reports/io_context_startup.report.json)
 
   --no-schema-validate                    Skip JSON schema validation
   -h, --help                              Show this help
@@ -393,6 +448,22 @@ while [[ $# -gt 0 ]]; do
       THREAD_POOL_SCALING_CONFIG="$2"
       shift 2
       ;;
+    --post-fan-in-config)
+      POST_FAN_IN_CONFIG="$2"
+      shift 2
+      ;;
+    --strand-throughput-config)
+      STRAND_THROUGHPUT_CONFIG="$2"
+      shift 2
+      ;;
+    --tcp-accept-storm-config)
+      TCP_ACCEPT_STORM_CONFIG="$2"
+      shift 2
+      ;;
+    --io-context-startup-config)
+      IO_CONTEXT_STARTUP_CONFIG="$2"
+      shift 2
+      ;;
 
     --tcp-roundtrip-scenarios)
       TCP_ROUNDTRIP_SCENARIOS_OVERRIDE="$2"
@@ -422,6 +493,22 @@ while [[ $# -gt 0 ]]; do
       THREAD_POOL_SCALING_SCENARIOS_OVERRIDE="$2"
       shift 2
       ;;
+    --post-fan-in-scenarios)
+      POST_FAN_IN_SCENARIOS_OVERRIDE="$2"
+      shift 2
+      ;;
+    --strand-throughput-scenarios)
+      STRAND_THROUGHPUT_SCENARIOS_OVERRIDE="$2"
+      shift 2
+      ;;
+    --tcp-accept-storm-scenarios)
+      TCP_ACCEPT_STORM_SCENARIOS_OVERRIDE="$2"
+      shift 2
+      ;;
+    --io-context-startup-scenarios)
+      IO_CONTEXT_STARTUP_SCENARIOS_OVERRIDE="$2"
+      shift 2
+      ;;
 
     --tcp-roundtrip-timeout-sec)
       TCP_ROUNDTRIP_TIMEOUT_OVERRIDE="$2"
@@ -451,6 +538,22 @@ while [[ $# -gt 0 ]]; do
       THREAD_POOL_SCALING_TIMEOUT_OVERRIDE="$2"
       shift 2
       ;;
+    --post-fan-in-timeout-sec)
+      POST_FAN_IN_TIMEOUT_OVERRIDE="$2"
+      shift 2
+      ;;
+    --strand-throughput-timeout-sec)
+      STRAND_THROUGHPUT_TIMEOUT_OVERRIDE="$2"
+      shift 2
+      ;;
+    --tcp-accept-storm-timeout-sec)
+      TCP_ACCEPT_STORM_TIMEOUT_OVERRIDE="$2"
+      shift 2
+      ;;
+    --io-context-startup-timeout-sec)
+      IO_CONTEXT_STARTUP_TIMEOUT_OVERRIDE="$2"
+      shift 2
+      ;;
 
     --tcp-roundtrip-report)
       TCP_ROUNDTRIP_REPORT="$2"
@@ -480,6 +583,22 @@ while [[ $# -gt 0 ]]; do
       THREAD_POOL_SCALING_REPORT="$2"
       shift 2
       ;;
+    --post-fan-in-report)
+      POST_FAN_IN_REPORT="$2"
+      shift 2
+      ;;
+    --strand-throughput-report)
+      STRAND_THROUGHPUT_REPORT="$2"
+      shift 2
+      ;;
+    --tcp-accept-storm-report)
+      TCP_ACCEPT_STORM_REPORT="$2"
+      shift 2
+      ;;
+    --io-context-startup-report)
+      IO_CONTEXT_STARTUP_REPORT="$2"
+      shift 2
+      ;;
 
     --no-schema-validate)
       ENABLE_SCHEMA_VALIDATE=false
@@ -514,7 +633,11 @@ for timeout_pair in \
   "--tcp-throughput-timeout-sec:$TCP_THROUGHPUT_TIMEOUT_OVERRIDE" \
   "--udp-send-receive-timeout-sec:$UDP_SEND_RECEIVE_TIMEOUT_OVERRIDE" \
   "--timer-churn-timeout-sec:$TIMER_CHURN_TIMEOUT_OVERRIDE" \
-  "--thread-pool-scaling-timeout-sec:$THREAD_POOL_SCALING_TIMEOUT_OVERRIDE"; do
+  "--thread-pool-scaling-timeout-sec:$THREAD_POOL_SCALING_TIMEOUT_OVERRIDE" \
+  "--post-fan-in-timeout-sec:$POST_FAN_IN_TIMEOUT_OVERRIDE" \
+  "--strand-throughput-timeout-sec:$STRAND_THROUGHPUT_TIMEOUT_OVERRIDE" \
+  "--tcp-accept-storm-timeout-sec:$TCP_ACCEPT_STORM_TIMEOUT_OVERRIDE" \
+  "--io-context-startup-timeout-sec:$IO_CONTEXT_STARTUP_TIMEOUT_OVERRIDE"; do
   IFS=':' read -r timeout_name timeout_value <<<"$timeout_pair"
   if [[ -n "$timeout_value" ]]; then
     bench_require_non_negative_int "$timeout_name" "$timeout_value"
@@ -531,6 +654,10 @@ CONF_DIR="$(bench_to_abs_path "$PROJECT_DIR" "$CONF_DIR")"
 : "${UDP_SEND_RECEIVE_CONFIG:=$CONF_DIR/udp_send_receive.conf}"
 : "${TIMER_CHURN_CONFIG:=$CONF_DIR/timer_churn.conf}"
 : "${THREAD_POOL_SCALING_CONFIG:=$CONF_DIR/thread_pool_scaling.conf}"
+: "${POST_FAN_IN_CONFIG:=$CONF_DIR/post_fan_in.conf}"
+: "${STRAND_THROUGHPUT_CONFIG:=$CONF_DIR/strand_throughput.conf}"
+: "${TCP_ACCEPT_STORM_CONFIG:=$CONF_DIR/tcp_accept_storm.conf}"
+: "${IO_CONTEXT_STARTUP_CONFIG:=$CONF_DIR/io_context_startup.conf}"
 
 TCP_ROUNDTRIP_CONFIG="$(bench_to_abs_path "$PROJECT_DIR" "$TCP_ROUNDTRIP_CONFIG")"
 TCP_LATENCY_CONFIG="$(bench_to_abs_path "$PROJECT_DIR" "$TCP_LATENCY_CONFIG")"
@@ -539,6 +666,10 @@ TCP_THROUGHPUT_CONFIG="$(bench_to_abs_path "$PROJECT_DIR" "$TCP_THROUGHPUT_CONFI
 UDP_SEND_RECEIVE_CONFIG="$(bench_to_abs_path "$PROJECT_DIR" "$UDP_SEND_RECEIVE_CONFIG")"
 TIMER_CHURN_CONFIG="$(bench_to_abs_path "$PROJECT_DIR" "$TIMER_CHURN_CONFIG")"
 THREAD_POOL_SCALING_CONFIG="$(bench_to_abs_path "$PROJECT_DIR" "$THREAD_POOL_SCALING_CONFIG")"
+POST_FAN_IN_CONFIG="$(bench_to_abs_path "$PROJECT_DIR" "$POST_FAN_IN_CONFIG")"
+STRAND_THROUGHPUT_CONFIG="$(bench_to_abs_path "$PROJECT_DIR" "$STRAND_THROUGHPUT_CONFIG")"
+TCP_ACCEPT_STORM_CONFIG="$(bench_to_abs_path "$PROJECT_DIR" "$TCP_ACCEPT_STORM_CONFIG")"
+IO_CONTEXT_STARTUP_CONFIG="$(bench_to_abs_path "$PROJECT_DIR" "$IO_CONTEXT_STARTUP_CONFIG")"
 
 TCP_ROUNDTRIP_REPORT="$(bench_to_abs_path "$PROJECT_DIR" "$TCP_ROUNDTRIP_REPORT")"
 TCP_LATENCY_REPORT="$(bench_to_abs_path "$PROJECT_DIR" "$TCP_LATENCY_REPORT")"
@@ -547,6 +678,10 @@ TCP_THROUGHPUT_REPORT="$(bench_to_abs_path "$PROJECT_DIR" "$TCP_THROUGHPUT_REPOR
 UDP_SEND_RECEIVE_REPORT="$(bench_to_abs_path "$PROJECT_DIR" "$UDP_SEND_RECEIVE_REPORT")"
 TIMER_CHURN_REPORT="$(bench_to_abs_path "$PROJECT_DIR" "$TIMER_CHURN_REPORT")"
 THREAD_POOL_SCALING_REPORT="$(bench_to_abs_path "$PROJECT_DIR" "$THREAD_POOL_SCALING_REPORT")"
+POST_FAN_IN_REPORT="$(bench_to_abs_path "$PROJECT_DIR" "$POST_FAN_IN_REPORT")"
+STRAND_THROUGHPUT_REPORT="$(bench_to_abs_path "$PROJECT_DIR" "$STRAND_THROUGHPUT_REPORT")"
+TCP_ACCEPT_STORM_REPORT="$(bench_to_abs_path "$PROJECT_DIR" "$TCP_ACCEPT_STORM_REPORT")"
+IO_CONTEXT_STARTUP_REPORT="$(bench_to_abs_path "$PROJECT_DIR" "$IO_CONTEXT_STARTUP_REPORT")"
 
 load_suite_config "tcp_roundtrip" "$TCP_ROUNDTRIP_CONFIG" cfg_tcp_roundtrip_iterations cfg_tcp_roundtrip_warmup cfg_tcp_roundtrip_timeout cfg_tcp_roundtrip_scenarios
 load_suite_config "tcp_latency" "$TCP_LATENCY_CONFIG" cfg_tcp_latency_iterations cfg_tcp_latency_warmup cfg_tcp_latency_timeout cfg_tcp_latency_scenarios
@@ -555,6 +690,10 @@ load_suite_config "tcp_throughput" "$TCP_THROUGHPUT_CONFIG" cfg_tcp_throughput_i
 load_suite_config "udp_send_receive" "$UDP_SEND_RECEIVE_CONFIG" cfg_udp_send_receive_iterations cfg_udp_send_receive_warmup cfg_udp_send_receive_timeout cfg_udp_send_receive_scenarios
 load_suite_config "timer_churn" "$TIMER_CHURN_CONFIG" cfg_timer_churn_iterations cfg_timer_churn_warmup cfg_timer_churn_timeout cfg_timer_churn_scenarios
 load_suite_config "thread_pool_scaling" "$THREAD_POOL_SCALING_CONFIG" cfg_thread_pool_scaling_iterations cfg_thread_pool_scaling_warmup cfg_thread_pool_scaling_timeout cfg_thread_pool_scaling_scenarios
+load_suite_config "post_fan_in" "$POST_FAN_IN_CONFIG" cfg_post_fan_in_iterations cfg_post_fan_in_warmup cfg_post_fan_in_timeout cfg_post_fan_in_scenarios
+load_suite_config "strand_throughput" "$STRAND_THROUGHPUT_CONFIG" cfg_strand_throughput_iterations cfg_strand_throughput_warmup cfg_strand_throughput_timeout cfg_strand_throughput_scenarios
+load_suite_config "tcp_accept_storm" "$TCP_ACCEPT_STORM_CONFIG" cfg_tcp_accept_storm_iterations cfg_tcp_accept_storm_warmup cfg_tcp_accept_storm_timeout cfg_tcp_accept_storm_scenarios
+load_suite_config "io_context_startup" "$IO_CONTEXT_STARTUP_CONFIG" cfg_io_context_startup_iterations cfg_io_context_startup_warmup cfg_io_context_startup_timeout cfg_io_context_startup_scenarios
 
 tcp_roundtrip_iterations="$cfg_tcp_roundtrip_iterations"
 tcp_latency_iterations="$cfg_tcp_latency_iterations"
@@ -563,6 +702,10 @@ tcp_throughput_iterations="$cfg_tcp_throughput_iterations"
 udp_send_receive_iterations="$cfg_udp_send_receive_iterations"
 timer_churn_iterations="$cfg_timer_churn_iterations"
 thread_pool_scaling_iterations="$cfg_thread_pool_scaling_iterations"
+post_fan_in_iterations="$cfg_post_fan_in_iterations"
+strand_throughput_iterations="$cfg_strand_throughput_iterations"
+tcp_accept_storm_iterations="$cfg_tcp_accept_storm_iterations"
+io_context_startup_iterations="$cfg_io_context_startup_iterations"
 
 tcp_roundtrip_warmup="$cfg_tcp_roundtrip_warmup"
 tcp_latency_warmup="$cfg_tcp_latency_warmup"
@@ -571,6 +714,10 @@ tcp_throughput_warmup="$cfg_tcp_throughput_warmup"
 udp_send_receive_warmup="$cfg_udp_send_receive_warmup"
 timer_churn_warmup="$cfg_timer_churn_warmup"
 thread_pool_scaling_warmup="$cfg_thread_pool_scaling_warmup"
+post_fan_in_warmup="$cfg_post_fan_in_warmup"
+strand_throughput_warmup="$cfg_strand_throughput_warmup"
+tcp_accept_storm_warmup="$cfg_tcp_accept_storm_warmup"
+io_context_startup_warmup="$cfg_io_context_startup_warmup"
 
 tcp_roundtrip_timeout="$cfg_tcp_roundtrip_timeout"
 tcp_latency_timeout="$cfg_tcp_latency_timeout"
@@ -579,6 +726,10 @@ tcp_throughput_timeout="$cfg_tcp_throughput_timeout"
 udp_send_receive_timeout="$cfg_udp_send_receive_timeout"
 timer_churn_timeout="$cfg_timer_churn_timeout"
 thread_pool_scaling_timeout="$cfg_thread_pool_scaling_timeout"
+post_fan_in_timeout="$cfg_post_fan_in_timeout"
+strand_throughput_timeout="$cfg_strand_throughput_timeout"
+tcp_accept_storm_timeout="$cfg_tcp_accept_storm_timeout"
+io_context_startup_timeout="$cfg_io_context_startup_timeout"
 
 tcp_roundtrip_scenarios="$cfg_tcp_roundtrip_scenarios"
 tcp_latency_scenarios="$cfg_tcp_latency_scenarios"
@@ -587,6 +738,10 @@ tcp_throughput_scenarios="$cfg_tcp_throughput_scenarios"
 udp_send_receive_scenarios="$cfg_udp_send_receive_scenarios"
 timer_churn_scenarios="$cfg_timer_churn_scenarios"
 thread_pool_scaling_scenarios="$cfg_thread_pool_scaling_scenarios"
+post_fan_in_scenarios="$cfg_post_fan_in_scenarios"
+strand_throughput_scenarios="$cfg_strand_throughput_scenarios"
+tcp_accept_storm_scenarios="$cfg_tcp_accept_storm_scenarios"
+io_context_startup_scenarios="$cfg_io_context_startup_scenarios"
 
 if [[ -n "$ITERATIONS_OVERRIDE" ]]; then
   tcp_roundtrip_iterations="$ITERATIONS_OVERRIDE"
@@ -596,6 +751,10 @@ if [[ -n "$ITERATIONS_OVERRIDE" ]]; then
   udp_send_receive_iterations="$ITERATIONS_OVERRIDE"
   timer_churn_iterations="$ITERATIONS_OVERRIDE"
   thread_pool_scaling_iterations="$ITERATIONS_OVERRIDE"
+  post_fan_in_iterations="$ITERATIONS_OVERRIDE"
+  strand_throughput_iterations="$ITERATIONS_OVERRIDE"
+  tcp_accept_storm_iterations="$ITERATIONS_OVERRIDE"
+  io_context_startup_iterations="$ITERATIONS_OVERRIDE"
 fi
 
 if [[ -n "$WARMUP_OVERRIDE" ]]; then
@@ -606,6 +765,10 @@ if [[ -n "$WARMUP_OVERRIDE" ]]; then
   udp_send_receive_warmup="$WARMUP_OVERRIDE"
   timer_churn_warmup="$WARMUP_OVERRIDE"
   thread_pool_scaling_warmup="$WARMUP_OVERRIDE"
+  post_fan_in_warmup="$WARMUP_OVERRIDE"
+  strand_throughput_warmup="$WARMUP_OVERRIDE"
+  tcp_accept_storm_warmup="$WARMUP_OVERRIDE"
+  io_context_startup_warmup="$WARMUP_OVERRIDE"
 fi
 
 if [[ -n "$TIMEOUT_SEC_OVERRIDE" ]]; then
@@ -616,6 +779,10 @@ if [[ -n "$TIMEOUT_SEC_OVERRIDE" ]]; then
   udp_send_receive_timeout="$TIMEOUT_SEC_OVERRIDE"
   timer_churn_timeout="$TIMEOUT_SEC_OVERRIDE"
   thread_pool_scaling_timeout="$TIMEOUT_SEC_OVERRIDE"
+  post_fan_in_timeout="$TIMEOUT_SEC_OVERRIDE"
+  strand_throughput_timeout="$TIMEOUT_SEC_OVERRIDE"
+  tcp_accept_storm_timeout="$TIMEOUT_SEC_OVERRIDE"
+  io_context_startup_timeout="$TIMEOUT_SEC_OVERRIDE"
 fi
 
 if [[ -n "$TCP_ROUNDTRIP_TIMEOUT_OVERRIDE" ]]; then tcp_roundtrip_timeout="$TCP_ROUNDTRIP_TIMEOUT_OVERRIDE"; fi
@@ -625,6 +792,10 @@ if [[ -n "$TCP_THROUGHPUT_TIMEOUT_OVERRIDE" ]]; then tcp_throughput_timeout="$TC
 if [[ -n "$UDP_SEND_RECEIVE_TIMEOUT_OVERRIDE" ]]; then udp_send_receive_timeout="$UDP_SEND_RECEIVE_TIMEOUT_OVERRIDE"; fi
 if [[ -n "$TIMER_CHURN_TIMEOUT_OVERRIDE" ]]; then timer_churn_timeout="$TIMER_CHURN_TIMEOUT_OVERRIDE"; fi
 if [[ -n "$THREAD_POOL_SCALING_TIMEOUT_OVERRIDE" ]]; then thread_pool_scaling_timeout="$THREAD_POOL_SCALING_TIMEOUT_OVERRIDE"; fi
+if [[ -n "$POST_FAN_IN_TIMEOUT_OVERRIDE" ]]; then post_fan_in_timeout="$POST_FAN_IN_TIMEOUT_OVERRIDE"; fi
+if [[ -n "$STRAND_THROUGHPUT_TIMEOUT_OVERRIDE" ]]; then strand_throughput_timeout="$STRAND_THROUGHPUT_TIMEOUT_OVERRIDE"; fi
+if [[ -n "$TCP_ACCEPT_STORM_TIMEOUT_OVERRIDE" ]]; then tcp_accept_storm_timeout="$TCP_ACCEPT_STORM_TIMEOUT_OVERRIDE"; fi
+if [[ -n "$IO_CONTEXT_STARTUP_TIMEOUT_OVERRIDE" ]]; then io_context_startup_timeout="$IO_CONTEXT_STARTUP_TIMEOUT_OVERRIDE"; fi
 
 if [[ -n "$TCP_ROUNDTRIP_SCENARIOS_OVERRIDE" ]]; then tcp_roundtrip_scenarios="$TCP_ROUNDTRIP_SCENARIOS_OVERRIDE"; fi
 if [[ -n "$TCP_LATENCY_SCENARIOS_OVERRIDE" ]]; then tcp_latency_scenarios="$TCP_LATENCY_SCENARIOS_OVERRIDE"; fi
@@ -633,6 +804,10 @@ if [[ -n "$TCP_THROUGHPUT_SCENARIOS_OVERRIDE" ]]; then tcp_throughput_scenarios=
 if [[ -n "$UDP_SEND_RECEIVE_SCENARIOS_OVERRIDE" ]]; then udp_send_receive_scenarios="$UDP_SEND_RECEIVE_SCENARIOS_OVERRIDE"; fi
 if [[ -n "$TIMER_CHURN_SCENARIOS_OVERRIDE" ]]; then timer_churn_scenarios="$TIMER_CHURN_SCENARIOS_OVERRIDE"; fi
 if [[ -n "$THREAD_POOL_SCALING_SCENARIOS_OVERRIDE" ]]; then thread_pool_scaling_scenarios="$THREAD_POOL_SCALING_SCENARIOS_OVERRIDE"; fi
+if [[ -n "$POST_FAN_IN_SCENARIOS_OVERRIDE" ]]; then post_fan_in_scenarios="$POST_FAN_IN_SCENARIOS_OVERRIDE"; fi
+if [[ -n "$STRAND_THROUGHPUT_SCENARIOS_OVERRIDE" ]]; then strand_throughput_scenarios="$STRAND_THROUGHPUT_SCENARIOS_OVERRIDE"; fi
+if [[ -n "$TCP_ACCEPT_STORM_SCENARIOS_OVERRIDE" ]]; then tcp_accept_storm_scenarios="$TCP_ACCEPT_STORM_SCENARIOS_OVERRIDE"; fi
+if [[ -n "$IO_CONTEXT_STARTUP_SCENARIOS_OVERRIDE" ]]; then io_context_startup_scenarios="$IO_CONTEXT_STARTUP_SCENARIOS_OVERRIDE"; fi
 
 TCP_ROUNDTRIP_SUMMARY="$(dirname -- "$TCP_ROUNDTRIP_REPORT")/tcp_roundtrip.summary.txt"
 TCP_LATENCY_SUMMARY="$(dirname -- "$TCP_LATENCY_REPORT")/tcp_latency.summary.txt"
@@ -641,6 +816,10 @@ TCP_THROUGHPUT_SUMMARY="$(dirname -- "$TCP_THROUGHPUT_REPORT")/tcp_throughput.su
 UDP_SEND_RECEIVE_SUMMARY="$(dirname -- "$UDP_SEND_RECEIVE_REPORT")/udp_send_receive.summary.txt"
 TIMER_CHURN_SUMMARY="$(dirname -- "$TIMER_CHURN_REPORT")/timer_churn.summary.txt"
 THREAD_POOL_SCALING_SUMMARY="$(dirname -- "$THREAD_POOL_SCALING_REPORT")/thread_pool_scaling.summary.txt"
+POST_FAN_IN_SUMMARY="$(dirname -- "$POST_FAN_IN_REPORT")/post_fan_in.summary.txt"
+STRAND_THROUGHPUT_SUMMARY="$(dirname -- "$STRAND_THROUGHPUT_REPORT")/strand_throughput.summary.txt"
+TCP_ACCEPT_STORM_SUMMARY="$(dirname -- "$TCP_ACCEPT_STORM_REPORT")/tcp_accept_storm.summary.txt"
+IO_CONTEXT_STARTUP_SUMMARY="$(dirname -- "$IO_CONTEXT_STARTUP_REPORT")/io_context_startup.summary.txt"
 
 mkdir -p "$(dirname -- "$TCP_ROUNDTRIP_REPORT")"
 mkdir -p "$(dirname -- "$TCP_LATENCY_REPORT")"
@@ -649,6 +828,10 @@ mkdir -p "$(dirname -- "$TCP_THROUGHPUT_REPORT")"
 mkdir -p "$(dirname -- "$UDP_SEND_RECEIVE_REPORT")"
 mkdir -p "$(dirname -- "$TIMER_CHURN_REPORT")"
 mkdir -p "$(dirname -- "$THREAD_POOL_SCALING_REPORT")"
+mkdir -p "$(dirname -- "$POST_FAN_IN_REPORT")"
+mkdir -p "$(dirname -- "$STRAND_THROUGHPUT_REPORT")"
+mkdir -p "$(dirname -- "$TCP_ACCEPT_STORM_REPORT")"
+mkdir -p "$(dirname -- "$IO_CONTEXT_STARTUP_REPORT")"
 
 suite_tcp_roundtrip_cmd=(
   "$SCRIPT_DIR/suites/run_perf_tcp_roundtrip.sh"
@@ -720,6 +903,46 @@ suite_thread_pool_scaling_cmd=(
   --report "$THREAD_POOL_SCALING_REPORT"
 )
 
+suite_post_fan_in_cmd=(
+  "$SCRIPT_DIR/suites/run_perf_post_fan_in.sh"
+  --build-dir "$BUILD_DIR"
+  --iterations "$post_fan_in_iterations"
+  --warmup "$post_fan_in_warmup"
+  --run-timeout-sec "$post_fan_in_timeout"
+  --scenarios "$post_fan_in_scenarios"
+  --report "$POST_FAN_IN_REPORT"
+)
+
+suite_strand_throughput_cmd=(
+  "$SCRIPT_DIR/suites/run_perf_strand_throughput.sh"
+  --build-dir "$BUILD_DIR"
+  --iterations "$strand_throughput_iterations"
+  --warmup "$strand_throughput_warmup"
+  --run-timeout-sec "$strand_throughput_timeout"
+  --scenarios "$strand_throughput_scenarios"
+  --report "$STRAND_THROUGHPUT_REPORT"
+)
+
+suite_tcp_accept_storm_cmd=(
+  "$SCRIPT_DIR/suites/run_perf_tcp_accept_storm.sh"
+  --build-dir "$BUILD_DIR"
+  --iterations "$tcp_accept_storm_iterations"
+  --warmup "$tcp_accept_storm_warmup"
+  --run-timeout-sec "$tcp_accept_storm_timeout"
+  --scenarios "$tcp_accept_storm_scenarios"
+  --report "$TCP_ACCEPT_STORM_REPORT"
+)
+
+suite_io_context_startup_cmd=(
+  "$SCRIPT_DIR/suites/run_perf_io_context_startup.sh"
+  --build-dir "$BUILD_DIR"
+  --iterations "$io_context_startup_iterations"
+  --warmup "$io_context_startup_warmup"
+  --run-timeout-sec "$io_context_startup_timeout"
+  --scenarios "$io_context_startup_scenarios"
+  --report "$IO_CONTEXT_STARTUP_REPORT"
+)
+
 echo "Running performance benchmark suites"
 echo "  build_dir: $BUILD_DIR"
 echo "  conf_dir: $CONF_DIR"
@@ -733,6 +956,10 @@ run_step_with_summary "suite_tcp_throughput" "$TCP_THROUGHPUT_SUMMARY" "${suite_
 run_step_with_summary "suite_udp_send_receive" "$UDP_SEND_RECEIVE_SUMMARY" "${suite_udp_send_receive_cmd[@]}"
 run_step_with_summary "suite_timer_churn" "$TIMER_CHURN_SUMMARY" "${suite_timer_churn_cmd[@]}"
 run_step_with_summary "suite_thread_pool_scaling" "$THREAD_POOL_SCALING_SUMMARY" "${suite_thread_pool_scaling_cmd[@]}"
+run_step_with_summary "suite_post_fan_in" "$POST_FAN_IN_SUMMARY" "${suite_post_fan_in_cmd[@]}"
+run_step_with_summary "suite_strand_throughput" "$STRAND_THROUGHPUT_SUMMARY" "${suite_strand_throughput_cmd[@]}"
+run_step_with_summary "suite_tcp_accept_storm" "$TCP_ACCEPT_STORM_SUMMARY" "${suite_tcp_accept_storm_cmd[@]}"
+run_step_with_summary "suite_io_context_startup" "$IO_CONTEXT_STARTUP_SUMMARY" "${suite_io_context_startup_cmd[@]}"
 
 if [[ "$ENABLE_SCHEMA_VALIDATE" == true ]]; then
   run_step_no_summary "schema_tcp_roundtrip" python3 "$SCRIPT_DIR/validate_benchmark_report.py" \
@@ -762,6 +989,22 @@ if [[ "$ENABLE_SCHEMA_VALIDATE" == true ]]; then
   run_step_no_summary "schema_thread_pool_scaling" python3 "$SCRIPT_DIR/validate_benchmark_report.py" \
     --schema "$PROJECT_DIR/benchmark/schemas/thread_pool_scaling.schema.json" \
     --report "$THREAD_POOL_SCALING_REPORT"
+
+  run_step_no_summary "schema_post_fan_in" python3 "$SCRIPT_DIR/validate_benchmark_report.py" \
+    --schema "$PROJECT_DIR/benchmark/schemas/post_fan_in.schema.json" \
+    --report "$POST_FAN_IN_REPORT"
+
+  run_step_no_summary "schema_strand_throughput" python3 "$SCRIPT_DIR/validate_benchmark_report.py" \
+    --schema "$PROJECT_DIR/benchmark/schemas/strand_throughput.schema.json" \
+    --report "$STRAND_THROUGHPUT_REPORT"
+
+  run_step_no_summary "schema_tcp_accept_storm" python3 "$SCRIPT_DIR/validate_benchmark_report.py" \
+    --schema "$PROJECT_DIR/benchmark/schemas/tcp_accept_storm.schema.json" \
+    --report "$TCP_ACCEPT_STORM_REPORT"
+
+  run_step_no_summary "schema_io_context_startup" python3 "$SCRIPT_DIR/validate_benchmark_report.py" \
+    --schema "$PROJECT_DIR/benchmark/schemas/io_context_startup.schema.json" \
+    --report "$IO_CONTEXT_STARTUP_REPORT"
 fi
 
 echo
@@ -773,6 +1016,10 @@ echo "  tcp_throughput report: $TCP_THROUGHPUT_REPORT"
 echo "  udp_send_receive report: $UDP_SEND_RECEIVE_REPORT"
 echo "  timer_churn report: $TIMER_CHURN_REPORT"
 echo "  thread_pool_scaling report: $THREAD_POOL_SCALING_REPORT"
+echo "  post_fan_in report: $POST_FAN_IN_REPORT"
+echo "  strand_throughput report: $STRAND_THROUGHPUT_REPORT"
+echo "  tcp_accept_storm report: $TCP_ACCEPT_STORM_REPORT"
+echo "  io_context_startup report: $IO_CONTEXT_STARTUP_REPORT"
 echo "  tcp_roundtrip summary: $TCP_ROUNDTRIP_SUMMARY"
 echo "  tcp_latency summary: $TCP_LATENCY_SUMMARY"
 echo "  tcp_connect_accept summary: $TCP_CONNECT_ACCEPT_SUMMARY"
@@ -780,6 +1027,10 @@ echo "  tcp_throughput summary: $TCP_THROUGHPUT_SUMMARY"
 echo "  udp_send_receive summary: $UDP_SEND_RECEIVE_SUMMARY"
 echo "  timer_churn summary: $TIMER_CHURN_SUMMARY"
 echo "  thread_pool_scaling summary: $THREAD_POOL_SCALING_SUMMARY"
+echo "  post_fan_in summary: $POST_FAN_IN_SUMMARY"
+echo "  strand_throughput summary: $STRAND_THROUGHPUT_SUMMARY"
+echo "  tcp_accept_storm summary: $TCP_ACCEPT_STORM_SUMMARY"
+echo "  io_context_startup summary: $IO_CONTEXT_STARTUP_SUMMARY"
 
 if [[ ${#FAILED_STEPS[@]} -gt 0 ]]; then
   echo
@@ -0,0 +1,21 @@
+#!/usr/bin/env bash
+
+set -euo pipefail
+
+SCRIPT_DIR="$(cd -- "$(dirname -- "${BASH_SOURCE[0]}")" && pwd)"
+
+exec "$SCRIPT_DIR/../run_perf_ratio_suite.sh" \
+  --suite-name "io_context_startup benchmark suite" \
+  --usage-name "benchmark/scripts/suites/run_perf_io_context_startup.sh" \
+  --scenario-fields "contexts,fds" \
+  --scenario-format "context counts and registered sockets per context" \
+  --scenarios-default "64:0,64:16,256:4" \
+  --iocoro-target "iocoro_io_context_startup" \
+  --asio-target "asio_io_context_startup" \
+  --metric-names "startup_us,rss_kb" \
+  --primary-metric "rss_kb" \
+  --ratio-mode "inverse" \
+  --ratio-field "ratio_vs_asio_rss" \
+  --ratio-label "asio_rss / iocoro_rss" \
+  --run-timeout-default 60 \
+  "$@"
@@ -0,0 +1,19 @@
+#!/usr/bin/env bash
+
+set -euo pipefail
+
+SCRIPT_DIR="$(cd -- "$(dirname -- "${BASH_SOURCE[0]}")" && pwd)"
+
+exec "$SCRIPT_DIR/../run_perf_ratio_suite.sh" \
+  --suite-name "post_fan_in benchmark suite" \
+  --usage-name "benchmark/scripts/suites/run_perf_post_fan_in.sh" \
+  --scenario-fields "producers,tasks" \
+  --scenario-format "producers:tasks tuples" \
+  --scenarios-default "1:500000,4:1000000,16:1000000" \
+  --iocoro-target "iocoro_post_fan_in" \
+  --asio-target "asio_post_fan_in" \
+  --metric-name "ops_s" \
+  --ratio-mode "direct" \
+  --ratio-field "ratio_vs_asio" \
+  --run-timeout-default 120 \
+  "$@"
@@ -0,0 +1,19 @@
+#!/usr/bin/env bash
+
+set -euo pipefail
+
+SCRIPT_DIR="$(cd -- "$(dirname -- "${BASH_SOURCE[0]}")" && pwd)"
+
+exec "$SCRIPT_DIR/../run_perf_ratio_suite.sh" \
+  --suite-name "strand_throughput benchmark suite" \
+  --usage-name "benchmark/scripts/suites/run_perf_strand_throughput.sh" \
+  --scenario-fields "strands,producers,tasks" \
+  --scenario-format "strands:producers:tasks tuples" \
+  --scenarios-default "1:0:1000000,16:0:1000000,16:4:1000000" \
+  --iocoro-target "iocoro_strand_throughput" \
+  --asio-target "asio_strand_throughput" \
+  --metric-name "ops_s" \
+  --ratio-mode "direct" \
+  --ratio-field "ratio_vs_asio" \
+  --run-timeout-default 120 \
+  "$@"
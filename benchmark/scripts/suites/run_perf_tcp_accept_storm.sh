@@ -0,0 +1,19 @@
+#!/usr/bin/env bash
+
+set -euo pipefail
+
+SCRIPT_DIR="$(cd -- "$(dirname -- "${BASH_SOURCE[0]}")" && pwd)"
+
+exec "$SCRIPT_DIR/../run_perf_ratio_suite.sh" \
+  --suite-name "tcp_accept_storm benchmark suite" \
+  --usage-name "benchmark/scripts/suites/run_perf_tcp_accept_storm.sh" \
+  --scenario-fields "connections,queue" \
+  --scenario-format "connection burst sizes and multishot queue limits" \
+  --scenarios-default "2000:0,2000:64,4000:256" \
+  --iocoro-target "iocoro_tcp_accept_storm" \
+  --asio-target "asio_tcp_accept_storm" \
+  --metric-name "cps" \
+  --ratio-mode "direct" \
+  --ratio-field "ratio_vs_asio" \
+  --run-timeout-default 120 \
+  "$@"
@@ -7,9 +7,9 @@ SCRIPT_DIR="$(cd -- "$(dirname -- "${BASH_SOURCE[0]}")" && pwd)"
 exec "$SCRIPT_DIR/../run_perf_ratio_suite.sh" \
   --suite-name "timer_churn benchmark suite" \
   --usage-name "benchmark/scripts/suites/run_perf_timer_churn.sh" \
-  --scenario-fields "sessions,waits" \
-  --scenario-format "sessions:waits tuples" \
-  --scenarios-default "1:200000,8:80000,32:20000" \
+  --scenario-fields "sessions,waits,idle,wheel" \
+  --scenario-format "sessions:waits:idle:wheel tuples" \
+  --scenarios-default "1:200000:0:0,1:200000:0:1,8:80000:100000:0,8:80000:100000:1" \
   --iocoro-target "iocoro_timer_churn" \
   --asio-target "asio_timer_churn" \
   --metric-name "ops_s" \
@@ -7,9 +7,9 @@ SCRIPT_DIR="$(cd -- "$(dirname -- "${BASH_SOURCE[0]}")" && pwd)"
 exec "$SCRIPT_DIR/../run_perf_ratio_suite.sh" \
   --suite-name "udp_send_receive benchmark suite" \
   --usage-name "benchmark/scripts/suites/run_perf_udp_send_receive.sh" \
-  --scenario-fields "sessions,msgs,msg_bytes" \
-  --scenario-format "sessions:msgs:msg_bytes tuples" \
-  --scenarios-default "1:20000:64,8:8000:64,32:2000:64,8:4000:1024,32:1000:4096" \
+  --scenario-fields "sessions,msgs,msg_bytes,batch" \
+  --scenario-format "sessions:msgs:msg_bytes:batch tuples" \
+  --scenarios-default "1:20000:64:1,8:8000:64:1,32:2000:64:1,8:4000:1024:1,32:1000:4096:1,8:8000:64:16" \
   --iocoro-target "iocoro_udp_send_receive" \
   --asio-target "asio_udp_send_receive" \
   --metric-name "pps" \
@@ -0,0 +1,43 @@
+# Checks that the liburing at `include_dir` / `library` provides what the io_uring backend uses.
+#
+# Sets in the caller's scope:
+# - `<prefix>_OK`: liburing is recent enough (2.3 or later) for the backend; otherwise callers
+#   fall back to epoll.
+# - `<prefix>_DEFINITIONS`: compile definitions for the optional features the library provides.
+
+include(CheckCXXSymbolExists)
+include(CMakePushCheckState)
+
+function(iocoro_check_liburing prefix include_dir library)
+    cmake_push_check_state(RESET)
+    set(CMAKE_REQUIRED_INCLUDES "${include_dir}")
+    set(CMAKE_REQUIRED_LIBRARIES "${library}")
+    set(CMAKE_REQUIRED_QUIET ON)
+
+    # liburing 2.3: zero-copy send, multishot receive, 64-bit cancel, sparse file tables.
+    set(ok TRUE)
+    foreach(symbol
+            io_uring_prep_send_zc
+            io_uring_prep_recv_multishot
+            io_uring_prep_multishot_accept
+            io_uring_prep_cancel64
+            io_uring_register_files_sparse
+            io_uring_enable_rings)
+        string(TOUPPER "IOCORO_LIBURING_HAS_${symbol}" var)
+        check_cxx_symbol_exists(${symbol} "liburing.h" ${var})
+        if(NOT ${var})
+            set(ok FALSE)
+        endif()
+    endforeach()
+
+    # liburing 2.4: io_uring_setup_buf_ring() / io_uring_free_buf_ring().
+    set(definitions "")
+    check_cxx_symbol_exists(io_uring_setup_buf_ring "liburing.h" IOCORO_LIBURING_HAS_SETUP_BUF_RING)
+    if(IOCORO_LIBURING_HAS_SETUP_BUF_RING)
+        list(APPEND definitions IOCORO_URING_BUF_RING)
+    endif()
+
+    cmake_pop_check_state()
+    set(${prefix}_OK ${ok} PARENT_SCOPE)
+    set(${prefix}_DEFINITIONS "${definitions}" PARENT_SCOPE)
+endfunction()
@@ -5,6 +5,7 @@
 #include <iocoro/traits/executor_traits.hpp>
 
 #include <concepts>
+#include <span>
 #include <type_traits>
 #include <utility>
 
@@ -58,6 +59,14 @@ class any_executor {
     }
     storage_.post(std::move(fn));
   }
+  /// Post every element of `fs` (each is moved from) in order. Executors with a native
+  /// `post_bulk()` enqueue them at once; others get one `post()` per element.
+  void post_bulk(std::span<detail::unique_function<void()>> fs) const {
+    if (!storage_) {
+      return;
+    }
+    storage_.post_bulk(fs);
+  }
   void dispatch(detail::unique_function<void()> fn) const {
     if (!storage_) {
       return;
@@ -4,6 +4,7 @@
 #include <iocoro/assert.hpp>
 #include <iocoro/detail/io_context_impl.hpp>
 
+#include <span>
 #include <type_traits>
 #include <utility>
 
@@ -40,6 +41,14 @@ class any_io_executor {
     storage_.post(std::move(f));
   }
 
+  /// Schedule every element of `fs` (each is moved from) at once, see `any_executor::post_bulk()`.
+  void post_bulk(std::span<detail::unique_function<void()>> fs) const {
+    if (!storage_) {
+      return;
+    }
+    storage_.post_bulk(fs);
+  }
+
   /// Execute inline when permitted; otherwise schedule like `post()`.
   void dispatch(detail::unique_function<void()> f) const {
     if (!storage_) {
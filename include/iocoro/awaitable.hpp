@@ -10,6 +10,22 @@
 
 namespace iocoro {
 
+/// Per-thread counters of the coroutine frame pool.
+using frame_pool_stats = detail::block_cache_stats;
+
+/// Counters of the calling thread's coroutine frame pool.
+///
+/// Frames are pooled only when `IOCORO_RECYCLE_FRAMES` is defined (CMake option
+/// `IOCORO_ENABLE_FRAME_RECYCLING`); otherwise the counters stay zero.
+inline auto this_thread_frame_pool_stats() noexcept -> frame_pool_stats {
+  return detail::frame_cache::stats();
+}
+
+/// Reset the calling thread's coroutine frame pool counters.
+inline void reset_this_thread_frame_pool_stats() noexcept {
+  detail::frame_cache::reset_stats();
+}
+
 template <typename T>
 class awaitable {
  public:
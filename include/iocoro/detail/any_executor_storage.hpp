@@ -8,6 +8,7 @@
 #include <cstdint>
 #include <memory>
 #include <new>
+#include <span>
 #include <type_traits>
 #include <typeinfo>
 #include <utility>
@@ -84,6 +85,11 @@ class any_executor_storage {
     vtable_->post(ptr_, std::move(fn));
   }
 
+  void post_bulk(std::span<unique_function<void()>> fs) const {
+    ensure_impl();
+    vtable_->post_bulk(ptr_, fs);
+  }
+
   void dispatch(unique_function<void()> fn) const {
     ensure_impl();
     vtable_->dispatch(ptr_, std::move(fn));
@@ -116,6 +122,7 @@ class any_executor_storage {
  private:
   struct vtable {
     void (*post)(void* object, unique_function<void()> fn);
+    void (*post_bulk)(void* object, std::span<unique_function<void()>> fs);
     void (*dispatch)(void* object, unique_function<void()> fn);
     auto (*equals)(void const* lhs, void const* rhs) noexcept -> bool;
     auto (*target)(void const* object, std::type_info const& ti) noexcept -> void const*;
@@ -131,6 +138,19 @@ class any_executor_storage {
     static_cast<Ex*>(object)->post(std::move(fn));
   }
 
+  // Executors without a native `post_bulk()` get one `post()` per element.
+  template <class Ex>
+  static void post_bulk_impl(void* object, std::span<unique_function<void()>> fs) {
+    auto* ex = static_cast<Ex*>(object);
+    if constexpr (requires { ex->post_bulk(fs); }) {
+      ex->post_bulk(fs);
+    } else {
+      for (auto& fn : fs) {
+        ex->post(std::move(fn));
+      }
+    }
+  }
+
   template <class Ex>
   static void dispatch_impl(void* object, unique_function<void()> fn) {
     static_cast<Ex*>(object)->dispatch(std::move(fn));
@@ -192,6 +212,7 @@ class any_executor_storage {
   template <class Ex>
   static inline constexpr vtable vtable_for{
     .post = &post_impl<Ex>,
+    .post_bulk = &post_bulk_impl<Ex>,
     .dispatch = &dispatch_impl<Ex>,
     .equals = &equals_impl<Ex>,
     .target = &target_impl<Ex>,
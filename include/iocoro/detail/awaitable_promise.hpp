@@ -3,6 +3,7 @@
 #include <iocoro/any_executor.hpp>
 #include <iocoro/any_io_executor.hpp>
 #include <iocoro/assert.hpp>
+#include <iocoro/detail/block_cache.hpp>
 #include <iocoro/detail/executor_cast.hpp>
 #include <iocoro/detail/executor_guard.hpp>
 #include <iocoro/detail/unique_function.hpp>
@@ -10,6 +11,7 @@
 
 #include <cassert>
 #include <coroutine>
+#include <cstddef>
 #include <exception>
 #include <memory>
 #include <optional>
@@ -33,6 +35,16 @@ struct awaitable_promise_base {
 
   awaitable_promise_base() noexcept = default;
 
+#if defined(IOCORO_RECYCLE_FRAMES)
+  // Coroutine frames come from a per-thread size-class pool instead of the global allocator.
+  // Frames are created and destroyed at a high rate on the I/O path (one per nested
+  // `awaitable` call), so steady-state traffic reuses the same few blocks.
+  static auto operator new(std::size_t size) -> void* { return frame_cache::allocate(size); }
+  static void operator delete(void* p, std::size_t size) noexcept {
+    frame_cache::deallocate(p, size);
+  }
+#endif
+
   std::suspend_always initial_suspend() noexcept { return {}; }
 
   auto final_suspend() noexcept {
@@ -71,6 +83,8 @@ struct awaitable_promise_base {
   }
 
   auto get_executor() const noexcept { return ex_; }
+  // Borrowed view of the bound executor, for awaiters that must not copy it per suspension.
+  auto executor_ref() const noexcept -> any_executor const& { return ex_; }
   void set_executor(any_executor ex) noexcept { ex_ = std::move(ex); }
 
   void inherit_executor(any_executor parent_ex) noexcept {
@@ -0,0 +1,159 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <new>
+
+namespace iocoro::detail {
+
+/// Per-thread counters of a `basic_block_cache`.
+struct block_cache_stats {
+  /// Requests served by `allocate()`.
+  std::uint64_t allocations = 0;
+  /// Requests served from the free list (no call into the global allocator).
+  std::uint64_t hits = 0;
+  /// Requests above the largest size class (always forwarded to `operator new`).
+  std::uint64_t oversized = 0;
+
+  auto hit_rate() const noexcept -> double {
+    return allocations == 0 ? 0.0 : static_cast<double>(hits) / static_cast<double>(allocations);
+  }
+};
+
+// Per-thread free-list cache for small, short-lived heap blocks.
+//
+// Design constraints:
+// - Blocks are bucketed into 64-byte size classes; requests above `max_cached_size` go straight
+//   to `operator new`. The caller passes the same size to `deallocate()` as to `allocate()`.
+// - A block may be freed on a different thread than the one that allocated it (operations are
+//   typically created by the awaiting coroutine and destroyed by whichever thread runs the
+//   reactor). It simply lands in the freeing thread's cache; each bucket is capped so memory
+//   cannot pile up on one thread.
+// - The cache state is trivially destructible so that frees arriving after the owning thread's
+//   cache has been torn down (late thread_local / static destructors) fall back to
+//   `operator delete` instead of touching a destroyed object.
+// - Under AddressSanitizer caching is disabled so use-after-free stays detectable.
+// - `Tag` keeps caches for unrelated block kinds (reactor operations, coroutine frames) apart.
+template <typename Tag, std::size_t ClassCount, std::uint32_t MaxBlocksPerClass>
+class basic_block_cache {
+ public:
+  static constexpr std::size_t granularity = 64;
+  static constexpr std::size_t class_count = ClassCount;
+  static constexpr std::size_t max_cached_size = granularity * class_count;
+  static constexpr std::uint32_t max_blocks_per_class = MaxBlocksPerClass;
+
+#if defined(__SANITIZE_ADDRESS__)
+  static constexpr bool caching_enabled = false;
+#elif defined(__has_feature)
+#if __has_feature(address_sanitizer)
+  static constexpr bool caching_enabled = false;
+#else
+  static constexpr bool caching_enabled = true;
+#endif
+#else
+  static constexpr bool caching_enabled = true;
+#endif
+
+  static auto allocate(std::size_t size) -> void* {
+    auto& st = state();
+    ++st.stats.allocations;
+    auto const idx = class_index(size);
+    if (idx >= class_count) {
+      ++st.stats.oversized;
+      return ::operator new(size);
+    }
+    if (auto* b = st.heads[idx]; b != nullptr) {
+      st.heads[idx] = b->next;
+      --st.counts[idx];
+      ++st.stats.hits;
+      return b;
+    }
+    return ::operator new(class_size(idx));
+  }
+
+  static void deallocate(void* p, std::size_t size) noexcept {
+    if (p == nullptr) {
+      return;
+    }
+    auto const idx = class_index(size);
+    if (idx >= class_count) {
+      ::operator delete(p, size);
+      return;
+    }
+    auto& st = state();
+    if (!caching_enabled || st.retired || st.counts[idx] >= max_blocks_per_class) {
+      ::operator delete(p, class_size(idx));
+      return;
+    }
+    // Registers the thread-exit release on first use.
+    static thread_local reaper r{};
+    (void)r;
+    st.heads[idx] = ::new (p) free_block{st.heads[idx]};
+    ++st.counts[idx];
+  }
+
+  // Number of blocks currently cached by the calling thread (diagnostics/tests).
+  static auto cached_count() noexcept -> std::size_t {
+    auto const& st = state();
+    std::size_t n = 0;
+    for (auto c : st.counts) {
+      n += c;
+    }
+    return n;
+  }
+
+  // Counters of the calling thread.
+  static auto stats() noexcept -> block_cache_stats { return state().stats; }
+  static void reset_stats() noexcept { state().stats = block_cache_stats{}; }
+
+ private:
+  struct free_block {
+    free_block* next;
+  };
+
+  struct cache_state {
+    free_block* heads[class_count];
+    std::uint32_t counts[class_count];
+    block_cache_stats stats;
+    bool retired;
+  };
+
+  struct reaper {
+    ~reaper() {
+      auto& st = state();
+      st.retired = true;
+      for (std::size_t i = 0; i < class_count; ++i) {
+        while (auto* b = st.heads[i]) {
+          st.heads[i] = b->next;
+          ::operator delete(b, class_size(i));
+        }
+        st.counts[i] = 0;
+      }
+    }
+  };
+
+  static constexpr auto class_index(std::size_t size) noexcept -> std::size_t {
+    return size == 0 ? 0 : (size - 1) / granularity;
+  }
+
+  static constexpr auto class_size(std::size_t idx) noexcept -> std::size_t {
+    return (idx + 1) * granularity;
+  }
+
+  static auto state() noexcept -> cache_state& {
+    static thread_local constinit cache_state st{};
+    return st;
+  }
+};
+
+struct reactor_op_cache_tag {};
+struct coroutine_frame_cache_tag {};
+
+/// Cache for reactor operation blocks (`make_reactor_op`): up to 512 bytes.
+using block_cache = basic_block_cache<reactor_op_cache_tag, 8, 64>;
+
+/// Cache for coroutine frames (opt-in, see `IOCORO_RECYCLE_FRAMES`): up to 2 KiB. Nested
+/// operations keep a handful of frames alive per in-flight call chain.
+using frame_cache = basic_block_cache<coroutine_frame_cache_tag, 32, 32>;
+
+}  // namespace iocoro::detail
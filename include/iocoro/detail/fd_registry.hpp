@@ -2,6 +2,7 @@
 
 #include <iocoro/detail/reactor_types.hpp>
 
+#include <cstddef>
 #include <cstdint>
 #include <utility>
 #include <vector>
@@ -13,6 +14,10 @@ class fd_registry {
   struct ready_result {
     reactor_op_ptr read{};
     reactor_op_ptr write{};
+    reactor_op_ptr error{};
+    // The fd has had an error-queue waiter: an error event may just mean a queued notification,
+    // so read/write waiters are woken to retry their syscall rather than aborted.
+    bool error_queue = false;
   };
 
   struct register_result {
@@ -29,10 +34,11 @@ class fd_registry {
   struct deregister_result {
     reactor_op_ptr read{};
     reactor_op_ptr write{};
+    reactor_op_ptr error{};
   };
 
-  // NOTE: fd_registry is reactor-thread-only.
-  // All accesses must be serialized by io_context_impl (reactor thread ownership).
+  // NOTE: fd_registry is not thread-safe. io_context_impl mutates it from any event-loop thread
+  // under its `registry_mtx_`.
   //
   // Token model:
   // - Each successful (re)registration assigns a fresh monotonically-increasing token.
@@ -40,22 +46,31 @@ class fd_registry {
   //   request could accidentally cancel a newer operation on the same fd/kind.
   auto register_read(int fd, reactor_op_ptr op) -> register_result;
   auto register_write(int fd, reactor_op_ptr op) -> register_result;
+  auto register_error(int fd, reactor_op_ptr op) -> register_result;
   auto cancel(int fd, fd_event_kind kind, std::uint64_t token) noexcept -> cancel_result;
   auto deregister(int fd) -> deregister_result;
   void track(int fd) noexcept;
+  // Mark `fd` as using its error queue (see `ready_result::error_queue`) until deregistered.
+  void watch_error_queue(int fd) noexcept;
 
-  auto take_ready(int fd, bool can_read, bool can_write) -> ready_result;
+  auto take_ready(int fd, bool can_read, bool can_write, bool has_error = false) -> ready_result;
 
   auto empty() const -> bool;
 
+  // Number of registered operations (read+write+error).
+  auto active_count() const noexcept -> std::size_t { return active_count_; }
+
+  // Number of fds currently tracked (added or registered and not yet deregistered).
+  auto tracked_count() const noexcept -> std::size_t { return tracked_count_; }
+
   struct drain_all_result {
     std::vector<int> fds{};
     std::vector<reactor_op_ptr> ops{};
   };
 
-  // Drain all registered operations (read+write) and clear the registry.
+  // Drain all registered operations (read+write+error) and clear the registry.
   //
-  // NOTE: fd_registry is reactor-thread-only; callers must ensure serialization.
+  // NOTE: callers must hold the same lock as for every other access.
   auto drain_all() noexcept -> drain_all_result;
 
  private:
@@ -68,20 +83,32 @@ class fd_registry {
   struct fd_ops {
     slot read{};
     slot write{};
+    slot error{};
     bool tracked = false;
+    bool error_queue = false;
   };
 
   static auto slot_for(fd_ops& ops, fd_event_kind kind) noexcept -> slot& {
-    return kind == fd_event_kind::read ? ops.read : ops.write;
+    switch (kind) {
+      case fd_event_kind::read:
+        return ops.read;
+      case fd_event_kind::write:
+        return ops.write;
+      case fd_event_kind::error:
+      default:
+        return ops.error;
+    }
   }
 
   auto register_impl(int fd, reactor_op_ptr op, fd_event_kind kind) -> register_result;
 
   // INVARIANT:
-  // - `active_count_` equals the number of non-null ops across all slots (read+write).
+  // - `active_count_` equals the number of non-null ops across all slots (read+write+error).
+  // - `tracked_count_` equals the number of entries with `tracked == true`.
   std::vector<fd_ops> operations_{};
   std::uint64_t next_token_ = 1;
   std::size_t active_count_ = 0;
+  std::size_t tracked_count_ = 0;
 };
 
 inline auto fd_registry::register_read(int fd, reactor_op_ptr op) -> register_result {
@@ -92,6 +119,10 @@ inline auto fd_registry::register_write(int fd, reactor_op_ptr op) -> register_r
   return register_impl(fd, std::move(op), fd_event_kind::write);
 }
 
+inline auto fd_registry::register_error(int fd, reactor_op_ptr op) -> register_result {
+  return register_impl(fd, std::move(op), fd_event_kind::error);
+}
+
 inline auto fd_registry::register_impl(int fd, reactor_op_ptr op,
                                        fd_event_kind kind) -> register_result {
   reactor_op_ptr old{};
@@ -109,7 +140,13 @@ inline auto fd_registry::register_impl(int fd, reactor_op_ptr op,
   }
 
   auto& ops = operations_[static_cast<std::size_t>(fd)];
-  ops.tracked = true;
+  if (!ops.tracked) {
+    ops.tracked = true;
+    ++tracked_count_;
+  }
+  if (kind == fd_event_kind::error && op) {
+    ops.error_queue = true;
+  }
   auto& slot = slot_for(ops, kind);
 
   // Edge-triggered backends can deliver readiness before the waiter is registered.
@@ -162,27 +199,30 @@ inline auto fd_registry::cancel(int fd, fd_event_kind kind,
 }
 
 inline auto fd_registry::deregister(int fd) -> deregister_result {
-  reactor_op_ptr read{};
-  reactor_op_ptr write{};
+  deregister_result out{};
 
   if (fd >= 0 && static_cast<std::size_t>(fd) < operations_.size()) {
     auto& ops = operations_[static_cast<std::size_t>(fd)];
-    read = std::move(ops.read.op);
-    write = std::move(ops.write.op);
-    ops.read.token = invalid_token;
-    ops.write.token = invalid_token;
-    ops.read.ready = false;
-    ops.write.ready = false;
-    ops.tracked = false;
-    if (read) {
-      --active_count_;
+    out.read = std::move(ops.read.op);
+    out.write = std::move(ops.write.op);
+    out.error = std::move(ops.error.op);
+    for (slot* s : {&ops.read, &ops.write, &ops.error}) {
+      s->token = invalid_token;
+      s->ready = false;
     }
-    if (write) {
-      --active_count_;
+    ops.error_queue = false;
+    if (ops.tracked) {
+      ops.tracked = false;
+      --tracked_count_;
+    }
+    for (auto const* op : {&out.read, &out.write, &out.error}) {
+      if (*op) {
+        --active_count_;
+      }
     }
   }
 
-  return deregister_result{std::move(read), std::move(write)};
+  return out;
 }
 
 inline void fd_registry::track(int fd) noexcept {
@@ -194,12 +234,25 @@ inline void fd_registry::track(int fd) noexcept {
     operations_.resize(idx + 1);
   }
   auto& ops = operations_[idx];
-  ops.tracked = true;
+  if (!ops.tracked) {
+    ops.tracked = true;
+    ++tracked_count_;
+  }
 }
 
-inline auto fd_registry::take_ready(int fd, bool can_read, bool can_write) -> ready_result {
+inline void fd_registry::watch_error_queue(int fd) noexcept {
+  if (fd < 0) {
+    return;
+  }
+  track(fd);
+  operations_[static_cast<std::size_t>(fd)].error_queue = true;
+}
+
+inline auto fd_registry::take_ready(int fd, bool can_read, bool can_write,
+                                    bool has_error) -> ready_result {
   reactor_op_ptr read{};
   reactor_op_ptr write{};
+  reactor_op_ptr error{};
 
   if (fd < 0) {
     return ready_result{};
@@ -232,8 +285,18 @@ inline auto fd_registry::take_ready(int fd, bool can_read, bool can_write) -> re
       write_slot.ready = true;
     }
   }
+  if (has_error) {
+    auto& error_slot = ops.error;
+    if (error_slot.op) {
+      error = std::move(error_slot.op);
+      error_slot.token = invalid_token;
+      --active_count_;
+    } else {
+      error_slot.ready = true;
+    }
+  }
 
-  return ready_result{std::move(read), std::move(write)};
+  return ready_result{std::move(read), std::move(write), std::move(error), ops.error_queue};
 }
 
 inline auto fd_registry::empty() const -> bool {
@@ -251,12 +314,12 @@ inline auto fd_registry::drain_all() noexcept -> drain_all_result {
 
   for (std::size_t i = 0; i < operations_.size(); ++i) {
     auto& ops = operations_[i];
-    bool const had_any =
-      ops.tracked || ops.read.op || ops.write.op || ops.read.ready || ops.write.ready;
+    bool const had_any = ops.tracked || ops.read.op || ops.write.op || ops.error.op ||
+                         ops.read.ready || ops.write.ready || ops.error.ready;
     if (had_any) {
       out.fds.push_back(static_cast<int>(i));
     }
-    for (slot* s : {&ops.read, &ops.write}) {
+    for (slot* s : {&ops.read, &ops.write, &ops.error}) {
       if (s->op) {
         out.ops.push_back(std::move(s->op));
         s->token = invalid_token;
@@ -267,6 +330,7 @@ inline auto fd_registry::drain_all() noexcept -> drain_all_result {
 
   operations_.clear();
   active_count_ = 0;
+  tracked_count_ = 0;
   return out;
 }
 
@@ -11,10 +11,15 @@
 #include <atomic>
 #include <chrono>
 #include <condition_variable>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <span>
+#include <system_error>
+#include <thread>
+#include <vector>
 
 namespace iocoro::detail {
 
@@ -27,7 +32,9 @@ class io_context_impl : public std::enable_shared_from_this<io_context_impl> {
   // Constructing on stack is not supported.
 
   io_context_impl();
-  explicit io_context_impl(std::unique_ptr<backend_interface> backend);
+  explicit io_context_impl(timer_queue_kind timers);
+  explicit io_context_impl(std::unique_ptr<backend_interface> backend,
+                           timer_queue_kind timers = timer_queue_kind::heap);
   ~io_context_impl();
 
   io_context_impl(io_context_impl const&) = delete;
@@ -37,12 +44,17 @@ class io_context_impl : public std::enable_shared_from_this<io_context_impl> {
 
   auto run() -> std::size_t;
   auto run_one() -> std::size_t;
-  auto run_for(std::chrono::milliseconds timeout) -> std::size_t;
+  auto run_for(std::chrono::steady_clock::duration timeout) -> std::size_t;
   void stop();
   void restart();
   auto stopped() const noexcept -> bool { return stopped_.load(std::memory_order_acquire); }
 
+  /// Spin for up to `max` before blocking in the backend (0 disables). Call before `run*()`.
+  void set_busy_poll(std::chrono::microseconds max) noexcept;
+
   void post(unique_function<void()> f);
+  // Enqueue all of `fs` (left empty) at once, waking the loop at most once.
+  void post_bulk(std::span<unique_function<void()>> fs);
   void dispatch(unique_function<void()> f);
 
   template <class Rep, class Period>
@@ -54,70 +66,222 @@ class io_context_impl : public std::enable_shared_from_this<io_context_impl> {
   /// Cancel a timer registration.
   ///
   /// Thread-safe: can be called from any thread. Completion/abort callbacks
-  /// and operation destruction still occur on the reactor thread.
+  /// and operation destruction still occur on an event-loop thread.
   void cancel_timer(std::uint32_t index, std::uint64_t token) noexcept;
 
   auto register_fd_read(int fd, reactor_op_ptr op) -> event_handle;
   auto register_fd_write(int fd, reactor_op_ptr op) -> event_handle;
+  /// Wait for the fd's error queue (EPOLLERR/POLLERR); the op completes rather than aborts.
+  auto register_fd_error(int fd, reactor_op_ptr op) -> event_handle;
+  /// From now until the fd is removed, error events on it wake read/write waiters instead of
+  /// aborting them (the error queue carries notifications, not only failures). Thread-safe.
+  void watch_error_queue(int fd) noexcept;
   auto add_fd(int fd) noexcept -> bool;
   void remove_fd(int fd) noexcept;
   void remove_fd_sync(int fd) noexcept;
   void cancel_fd_event(int fd, detail::fd_event_kind kind, std::uint64_t token) noexcept;
 
+  /// True if the backend executes I/O itself (completion model, e.g. io_uring).
+  auto supports_completion_io() const noexcept -> bool { return completion_io_; }
+
+  /// True if requests with opcode `op` may be submitted (see `backend_interface::supports_io_op`).
+  auto supports_completion_io(io_request::opcode op) const noexcept -> bool {
+    return ((completion_ops_ >> static_cast<unsigned>(op)) & 1U) != 0;
+  }
+
+  /// Submit a completion-model operation; `op` completes on an event-loop thread once the
+  /// kernel has stored the result through `req.result`. Requires `supports_completion_io()`.
+  auto submit_io(io_request const& req, reactor_op_ptr op) -> event_handle;
+  void cancel_io(std::uint64_t id) noexcept;
+
+  /// True if the backend can arm multishot requests (one submission, many results).
+  auto supports_multishot() const noexcept -> bool { return multishot_io_; }
+
+  /// Arm a multishot request; results go to `sink` on the reactor thread (see
+  /// `backend_interface::submit_multishot()`). Returns the id for `cancel_io()`.
+  ///
+  /// An armed stream does not keep `run()` alive; consumers waiting for its results do.
+  auto submit_multishot(io_request const& req, std::shared_ptr<io_stream_sink> sink)
+    -> std::uint64_t;
+
+  /// Provided-buffer ring of the backend (multishot receive).
+  auto provided_buffer(std::uint32_t id) noexcept -> std::span<std::byte> {
+    return backend_->provided_buffer(id);
+  }
+  void recycle_buffer(std::uint32_t id) noexcept { backend_->recycle_buffer(id); }
+
+  /// Registered-file slot for `fd`, or -1 (no completion I/O, unsupported, or table full).
+  auto register_fixed_file(int fd) noexcept -> std::int32_t {
+    return completion_io_ ? backend_->register_file(fd) : -1;
+  }
+  void unregister_fixed_file(std::int32_t slot) noexcept {
+    if (slot >= 0) {
+      backend_->unregister_file(slot);
+    }
+  }
+
+  /// Replace the registered buffers (empty: drop them). Thread-safe.
+  auto register_buffers(std::span<std::span<std::byte> const> buffers) -> std::error_code;
+
+  /// Index of the registered buffer containing `[data, data + size)`, or -1.
+  auto find_fixed_buffer(void const* data, std::size_t size) const noexcept -> std::int32_t;
+
+  /// True if writes may use `write_fixed`: unlike send(), write() raises SIGPIPE on a reset
+  /// connection, so this requires SIGPIPE to be ignored. Sampled by `register_buffers()` only.
+  auto fixed_writes() const noexcept -> bool {
+    return fixed_writes_.load(std::memory_order_relaxed);
+  }
+
   void cancel_event(event_handle h) noexcept;
 
   void add_work_guard() noexcept;
   void remove_work_guard() noexcept;
 
+  /// True if the calling thread is currently inside `run*()` for this context.
   auto running_in_this_thread() const noexcept -> bool;
 
+  /// Approximate load: tracked fds plus posted tasks not yet taken by an event-loop thread.
+  ///
+  /// Lock-free snapshot intended for load balancing (e.g. `io_context_pool`); may be stale.
+  auto load() const noexcept -> std::size_t {
+    return tracked_fds_.load(std::memory_order_relaxed) + posted_.pending_count();
+  }
+
  private:
-  // Opaque per-thread identity token.
-  // Only valid for equality comparison within the process lifetime.
-  static auto this_thread_token() noexcept -> std::uintptr_t;
-  void set_thread_id() noexcept;
+  // Per-thread record of an active `run*()` call. Frames form an intrusive stack in TLS so that
+  // a thread can (rarely) drive nested loops of different contexts.
+  struct run_frame {
+    io_context_impl const* ctx = nullptr;
+    run_frame* prev = nullptr;
+    // True while this thread holds the reactor role (timers + backend wait).
+    bool owns_reactor = false;
+  };
+
+  // Max posted tasks taken per turn when several threads drive this context.
+  static constexpr std::size_t shared_posted_batch = 16;
+
+  static auto this_thread_frames() noexcept -> run_frame*&;
+  auto current_frame() const noexcept -> run_frame*;
+  // Single-issuer backends: record the first runner thread, refuse (IOCORO_ENSURE) any other.
+  void ensure_issuer_thread();
+  void enter_run(run_frame& frame) noexcept;
+  void leave_run(run_frame& frame) noexcept;
+
+  // Reactor role (leader/followers): exactly one event-loop thread at a time processes timers
+  // and blocks in the backend; the others drain posted work and park in `wait_idle()`.
+  auto try_acquire_reactor(run_frame& frame) noexcept -> bool;
+  void release_reactor(run_frame& frame) noexcept;
+  void wait_idle(std::optional<std::chrono::steady_clock::time_point> deadline);
+  void notify_idle(bool all = false) noexcept;
+  // Interrupt the backend wait if another thread holds the reactor role.
+  void wakeup_reactor_owner() noexcept;
+
+  // True if reactor completions may resume their awaiters inline (see
+  // `inline_completion_scope`). Only for a sole runner: with several, an inline resume would
+  // keep user code on the thread holding the reactor role, starving the others of I/O work.
+  auto inline_completions() const noexcept -> bool;
+
   auto is_stopped() const noexcept -> bool;
   auto has_work() -> bool;
   void notify_state_change() noexcept;
 
+  // True if a completion run by the last `process_timers()` armed an already expired timer.
+  auto rearmed_timer_due() const noexcept -> bool;
   auto next_wait(std::optional<std::chrono::steady_clock::time_point> deadline)
-    -> std::optional<std::chrono::milliseconds>;
+    -> std::optional<std::chrono::steady_clock::duration>;
   auto process_posted() -> std::size_t;
   auto process_timers() -> std::size_t;
-  auto process_events(std::optional<std::chrono::milliseconds> max_wait = std::nullopt)
+  auto process_events(std::optional<std::chrono::steady_clock::duration> max_wait = std::nullopt)
     -> std::size_t;
+  // One reactor turn: timers, then backend wait + fd dispatch. Caller holds the reactor role.
+  auto run_reactor_turn(std::optional<std::chrono::steady_clock::time_point> deadline)
+    -> std::size_t;
+  // Busy-poll phase ahead of a blocking wait (caller holds the reactor role). Returns the
+  // handlers run; 0 with posted work pending means the caller should go drain it.
+  auto busy_poll(std::optional<std::chrono::steady_clock::time_point> deadline) -> std::size_t;
 
   auto register_fd_impl(int fd, reactor_op_ptr op, detail::fd_event_kind kind) -> event_handle;
   void remove_fd_impl(int fd) noexcept;
-  // Abort a reactor op. Must only be called on the reactor thread.
+  // Refresh `tracked_fds_`, `active_fd_ops_` and `active_timers_`. Call with `registry_mtx_`
+  // held, after every registry mutation.
+  void sync_registry_counts() noexcept;
+  // Abort a reactor op. Must only be called on an event-loop thread, without `registry_mtx_`.
   static void abort_op(reactor_op_ptr op, std::error_code ec) noexcept;
   void wakeup();
 
-  // Execute `f` on the reactor thread (registry/backend ownership thread).
+  // Execute `f` on an event-loop thread.
   //
-  // INVARIANT: registry/backend mutations and reactor op callbacks happen only on the reactor
-  // thread; this is the sole serialization mechanism for reactor state.
+  // INVARIANT: registry mutations happen under `registry_mtx_` on event-loop threads, and
+  // reactor op callbacks run on event-loop threads after the lock is released.
   //
   // Semantics:
-  // - If currently running on the reactor thread, executes inline.
+  // - If the calling thread is inside `run*()` for this context, executes inline.
   // - Otherwise, enqueues via `post()` and executes on the next event-loop iteration.
   // SAFETY: uses `weak_from_this()` to avoid self-owning cycles while still pinning lifetime
   // during callback execution.
   void dispatch_reactor(unique_function<void(io_context_impl&)> f) noexcept;
 
   std::unique_ptr<backend_interface> backend_;
+  bool completion_io_ = false;
+  // Bit `op` set: the backend runs `io_request::opcode` `op` itself.
+  std::uint32_t completion_ops_ = 0;
+  bool multishot_io_ = false;
+  bool single_issuer_ = false;
+  // Single-issuer backends: the only thread allowed to run the loop (empty until the first run).
+  std::atomic<std::thread::id> issuer_{};
 
   std::atomic<bool> stopped_{false};
-  // True while a thread is inside run/run_one/run_for. This is used to reject
-  // concurrent event-loop execution for the same io_context_impl instance.
-  std::atomic<bool> running_{false};
+  // Number of threads currently inside run/run_one/run_for.
+  std::atomic<std::size_t> runners_{0};
+  // True while some event-loop thread holds the reactor role.
+  std::atomic<bool> reactor_owned_{false};
 
+  // Guards `fd_registry_` and `timers_`. Never held while invoking op callbacks.
+  std::mutex registry_mtx_{};
   fd_registry fd_registry_{};
   timer_registry timers_{};
+  // Mirrors of the registry counts readable without `registry_mtx_` (see
+  // `sync_registry_counts()`): `has_work()` and load estimation only read these.
+  std::atomic<std::size_t> tracked_fds_{0};
+  std::atomic<std::size_t> active_fd_ops_{0};
+  std::atomic<std::size_t> active_timers_{0};
+  // Completion-model operations owned by the backend (keeps `run()` alive while in flight).
+  std::atomic<std::size_t> inflight_io_{0};
+  // Copy of the backend's registered-buffer table for `find_fixed_buffer()`.
+  mutable std::mutex fixed_buffers_mtx_{};
+  std::vector<std::span<std::byte>> fixed_buffers_{};
+  std::atomic<bool> has_fixed_buffers_{false};
+  // SIGPIPE was ignored at the last `register_buffers()` (see `fixed_writes()`).
+  std::atomic<bool> fixed_writes_{false};
   posted_queue posted_{};
   work_guard_counter work_guard_{};
+
+  // Reactor-role scratch buffers (only touched by the thread holding the reactor role).
+  struct ready_op {
+    reactor_op_ptr op{};
+    bool is_error = false;
+    int error = 0;
+  };
   std::vector<backend_event> backend_events_{};
-  std::atomic<std::uintptr_t> thread_token_{0};
+  std::vector<ready_op> ready_ops_{};
+  std::vector<reactor_op_ptr> completed_io_{};
+  std::vector<timer_registry::expired_op> expired_ops_{};
+  // Earliest expiry passed to `add_timer()` since `process_timers()` last swept (max() if none).
+  // Written inside `add_timer()`'s critical section so the sweep can check its own re-arms
+  // without taking `registry_mtx_` again.
+  std::atomic<std::chrono::steady_clock::time_point> rearmed_expiry_{
+    std::chrono::steady_clock::time_point::max()};
+
+  // Busy-poll window: shrinks while spinning finds nothing and grows back on hits, so an idle
+  // context costs little CPU and a ping-pong one keeps spinning. Reactor role only.
+  std::chrono::steady_clock::duration busy_poll_max_{};
+  std::chrono::steady_clock::duration busy_poll_window_{};
+
+  // Followers park here while another thread holds the reactor role.
+  std::mutex idle_mtx_{};
+  std::condition_variable idle_cv_{};
+  std::atomic<std::size_t> idle_waiters_{0};
+
   mutable std::mutex state_change_mtx_{};
   std::condition_variable state_change_cv_{};
 };
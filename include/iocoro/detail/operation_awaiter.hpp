@@ -1,6 +1,7 @@
 #pragma once
 
 #include <atomic>
+#include <concepts>
 #include <coroutine>
 #include <iocoro/any_executor.hpp>
 #include <iocoro/assert.hpp>
@@ -10,10 +11,10 @@
 #include <iocoro/detail/unique_function.hpp>
 #include <iocoro/error.hpp>
 #include <iocoro/result.hpp>
-#include <memory>
 #include <optional>
 #include <stop_token>
 #include <system_error>
+#include <utility>
 
 namespace iocoro::detail {
 
@@ -23,45 +24,103 @@ struct operation_cancel_callback {
   void operator()() const noexcept { handle.cancel(); }
 };
 
-/// Shared state for an in-flight reactor operation.
+/// State of an in-flight reactor operation, embedded in the awaiter.
+///
+/// The awaiter lives in the suspended coroutine's frame, which is not resumed (and so not
+/// destroyed) before the operation completes; the reactor op refers back to it by pointer.
+/// Nothing is allocated and no refcount is touched per wait (the op block itself comes from the
+/// per-thread `block_cache`).
 ///
 /// SAFETY: completion and cancellation may race; `done` is used to guarantee exactly one
 /// resumption path wins and observes the final `ec`.
+///
+/// Resumption additionally waits for `await_suspend()` to finish (`resume_gate`): when several
+/// threads drive the io_context, a completion can otherwise resume and destroy the awaiting
+/// frame while `await_suspend()` is still touching it.
+///
+/// Whichever side arrives last picks the resumption path:
+/// - `await_suspend()` (the operation completed inside `register_op()`): post, so a coroutine
+///   whose operations keep completing immediately still yields to other work.
+/// - the completion, after registration finished, from an io_context dispatch loop (see
+///   `inline_completion_scope`): `dispatch()` on the coroutine's executor. When that executor
+///   is the same io_context this resumes inline and skips a posted-queue round trip; strands
+///   and other executors still post.
+/// - any other completion: post.
 struct operation_wait_state {
   std::coroutine_handle<> h{};
-  any_executor ex{};
+  // The awaiting coroutine's executor: borrowed from its promise when possible, else `ex_copy`.
+  any_executor const* ex = nullptr;
+  any_executor ex_copy{};
   std::error_code ec{};
   std::atomic<bool> done{false};
+  std::atomic<int> resume_gate{2};
   std::optional<std::stop_callback<operation_cancel_callback>> stop_cb{};
+
+  // Called once by completion and once at the end of `await_suspend()`; the last one resumes.
+  //
+  // SAFETY: an inline resume may run the coroutine to completion, destroying this state and the
+  // executor `ex` points to. Executors return straight after invoking the function they run
+  // inline, and nothing here is touched after the call.
+  void arrive(bool from_completion) noexcept {
+    if (resume_gate.fetch_sub(1, std::memory_order_acq_rel) != 1) {
+      return;
+    }
+    auto h = std::exchange(this->h, std::coroutine_handle<>{});
+    if (!h) {
+      return;
+    }
+    IOCORO_ENSURE(ex != nullptr && *ex, "operation_awaiter: empty executor in completion");
+
+    if (from_completion && inline_completion_allowed) {
+      inline_completion_allowed = false;
+      ex->dispatch([h]() mutable noexcept { h.resume(); });
+      inline_completion_allowed = true;
+    } else {
+      ex->post([h]() mutable noexcept { h.resume(); });
+    }
+  }
 };
 
 /// Awaiter that bridges a reactor operation into coroutine suspension.
 ///
 /// Semantics:
 /// - Registers a reactor operation via `register_op`.
-/// - Captures the awaiting coroutine's executor and resumes by posting onto it.
+/// - Captures the awaiting coroutine's executor and resumes on it (see `operation_wait_state`).
 /// - If a stop token is available, requests cancellation best-effort by calling `handle.cancel()`.
+///
+/// Must not be copied once suspended: the registered operation points into it. Copying before
+/// suspension only copies the factory (GCC copies the operand of `co_await` into the frame).
+/// Await it as a named local (GCC 12 destroys a temporary awaiter of `co_await` twice).
 template <typename Factory>
 struct operation_awaiter {
   Factory register_op;
-  std::shared_ptr<operation_wait_state> st{std::make_shared<operation_wait_state>()};
+  operation_wait_state st{};
 
   explicit operation_awaiter(Factory f) : register_op(std::move(f)) {}
 
+  operation_awaiter(operation_awaiter const& other) : register_op(other.register_op) {}
+  auto operator=(operation_awaiter const&) -> operation_awaiter& = delete;
+
   bool await_ready() const noexcept { return false; }
 
   template <class Promise>
     requires requires(Promise& p) { p.get_executor(); }
   bool await_suspend(std::coroutine_handle<Promise> h) {
-    st->h = h;
-    st->ex = h.promise().get_executor();
-    IOCORO_ENSURE(st->ex, "operation_awaiter: empty executor");
+    st.h = h;
+    if constexpr (requires(Promise const& p) {
+                    { p.executor_ref() } -> std::same_as<any_executor const&>;
+                  }) {
+      st.ex = &h.promise().executor_ref();
+    } else {
+      st.ex_copy = h.promise().get_executor();
+      st.ex = &st.ex_copy;
+    }
+    IOCORO_ENSURE(*st.ex, "operation_awaiter: empty executor");
 
     struct reactor_wait_op_state {
-      std::shared_ptr<operation_wait_state> st;
+      operation_wait_state* st;
 
-      explicit reactor_wait_op_state(std::shared_ptr<operation_wait_state> s) noexcept
-          : st(std::move(s)) {}
+      explicit reactor_wait_op_state(operation_wait_state* s) noexcept : st(s) {}
 
       void on_complete() noexcept { complete(std::error_code{}); }
       void on_abort(std::error_code ec) noexcept { complete(ec); }
@@ -71,43 +130,32 @@ struct operation_awaiter {
           return;
         }
         st->ec = ec;
-
-        // SAFETY: stop callback may race with completion. Resetting unregisters it and makes
-        // cancellation best-effort and idempotent.
-        st->stop_cb.reset();
-
-        auto h = std::exchange(st->h, std::coroutine_handle<>{});
-        if (!h) {
-          return;
-        }
-        auto ex = st->ex;
-        IOCORO_ENSURE(ex, "operation_awaiter: empty executor in completion");
-
-        // Always post instead of dispatch: completion may race with await_suspend().
-        // If we dispatch inline here, the awaiting coroutine can resume and destroy
-        // its frame before await_suspend() finishes, making later h.promise() access
-        // in await_suspend() a use-after-free.
-        ex.post([h]() mutable noexcept { h.resume(); });
+        st->arrive(true);
       }
     };
 
-    auto handle = register_op(make_reactor_op<reactor_wait_op_state>(st));
+    auto handle = register_op(make_reactor_op<reactor_wait_op_state>(&st));
 
     if constexpr (requires { h.promise().get_stop_token(); }) {
       auto token = h.promise().get_stop_token();
       if (token.stop_requested()) {
         handle.cancel();
       } else if (token.stop_possible()) {
-        st->stop_cb.emplace(token, operation_cancel_callback{handle});
+        st.stop_cb.emplace(token, operation_cancel_callback{handle});
       }
     }
 
+    // SAFETY: after this call the frame (and `*this`) may already be resumed and destroyed.
+    st.arrive(false);
     return true;
   }
 
   auto await_resume() noexcept -> iocoro::result<void> {
-    if (st->ec) {
-      return iocoro::unexpected(st->ec);
+    // SAFETY: stop callback may still be registered. Resetting unregisters it (waiting for a
+    // concurrently running callback) and makes cancellation best-effort and idempotent.
+    st.stop_cb.reset();
+    if (st.ec) {
+      return iocoro::unexpected(st.ec);
     }
     return {};
   }
@@ -2,9 +2,14 @@
 
 #include <iocoro/detail/unique_function.hpp>
 
+#include <algorithm>
 #include <atomic>
+#include <cstddef>
+#include <deque>
+#include <iterator>
+#include <limits>
 #include <mutex>
-#include <queue>
+#include <span>
 #include <utility>
 
 namespace iocoro::detail {
@@ -13,46 +18,80 @@ namespace iocoro::detail {
 //
 // Design constraints:
 // - `post()` may be called from any thread.
-// - Draining (`process()`) happens on the reactor thread.
+// - Draining (`process()`) happens on event-loop threads. A batch is detached under `mtx_` and run
+//   with it released. When several threads drive the same context, each call takes a bounded
+//   batch so that a burst of posted work is shared.
+// - A taken task leaves the pending count at take time but stays outstanding until it has run
+//   (like Asio's outstanding-work count): it may post follow-up work, so other event-loop threads
+//   must not conclude the context is out of work meanwhile.
 class posted_queue {
  public:
   void post(unique_function<void()> f) {
     std::scoped_lock lk{mtx_};
-    queue_.push(std::move(f));
+    queue_.push_back(std::move(f));
+    outstanding_count_.fetch_add(1, std::memory_order_release);
     pending_count_.fetch_add(1, std::memory_order_release);
   }
 
-  auto process() -> std::size_t {
-    std::queue<unique_function<void()>> local;
-    {
-      std::scoped_lock lk{mtx_};
-      std::swap(local, queue_);
+  // Enqueue all of `fs` (left empty) in order, under one lock acquisition.
+  // The slots are allocated before anything is moved, so if that throws `fs` is left untouched.
+  void post_bulk(std::span<unique_function<void()>> fs) {
+    if (fs.empty()) {
+      return;
     }
+    std::scoped_lock lk{mtx_};
+    auto const old_size = queue_.size();
+    queue_.resize(old_size + fs.size());
+    std::ranges::move(fs, queue_.begin() + static_cast<std::ptrdiff_t>(old_size));
+    outstanding_count_.fetch_add(fs.size(), std::memory_order_release);
+    pending_count_.fetch_add(fs.size(), std::memory_order_release);
+  }
 
-    if (local.empty()) {
-      return 0;
+  static constexpr std::size_t unbounded = (std::numeric_limits<std::size_t>::max)();
+
+  auto process(std::size_t max_tasks = unbounded) -> std::size_t {
+    std::deque<unique_function<void()>> local;
+    {
+      std::scoped_lock lk{mtx_};
+      if (queue_.size() <= max_tasks) {
+        std::swap(local, queue_);
+      } else {
+        auto const last = queue_.begin() + static_cast<std::ptrdiff_t>(max_tasks);
+        local.assign(std::make_move_iterator(queue_.begin()), std::make_move_iterator(last));
+        queue_.erase(queue_.begin(), last);
+      }
+      // Taken tasks no longer count as pending: other event-loop threads must not spin on (or
+      // wait for) work this thread already owns. They stay outstanding until they have run.
+      if (!local.empty()) {
+        pending_count_.fetch_sub(local.size(), std::memory_order_acq_rel);
+      }
     }
 
     std::size_t n = 0;
     while (!local.empty()) {
       auto f = std::move(local.front());
-      local.pop();
-      (void)pending_count_.fetch_sub(1, std::memory_order_acq_rel);
+      local.pop_front();
       if (f) {
         try {
           f();
         } catch (...) {
-          std::scoped_lock lk{mtx_};
-          while (!local.empty()) {
-            queue_.push(std::move(local.front()));
-            local.pop();
+          // The rest of the batch goes back to the front of the queue, preserving FIFO order.
+          {
+            std::scoped_lock lk{mtx_};
+            pending_count_.fetch_add(local.size(), std::memory_order_release);
+            queue_.insert(queue_.begin(), std::make_move_iterator(local.begin()),
+                          std::make_move_iterator(local.end()));
           }
+          outstanding_count_.fetch_sub(n + 1, std::memory_order_acq_rel);
           throw;
         }
       }
       ++n;
     }
 
+    if (n != 0) {
+      outstanding_count_.fetch_sub(n, std::memory_order_acq_rel);
+    }
     return n;
   }
 
@@ -61,10 +100,22 @@ class posted_queue {
     return pending_count_.load(std::memory_order_acquire) > 0;
   }
 
+  // True iff there are queued posted tasks or taken ones still running.
+  auto has_outstanding_work() const -> bool {
+    return outstanding_count_.load(std::memory_order_acquire) > 0;
+  }
+
+  // Number of queued posted tasks (relaxed snapshot, for load estimation only).
+  auto pending_count() const noexcept -> std::size_t {
+    return pending_count_.load(std::memory_order_relaxed);
+  }
+
  private:
   mutable std::mutex mtx_{};
-  std::queue<unique_function<void()>> queue_{};
+  std::deque<unique_function<void()>> queue_{};
   std::atomic<std::size_t> pending_count_{0};
+  // Queued plus taken-but-unfinished tasks; dropped only after a task has run.
+  std::atomic<std::size_t> outstanding_count_{0};
 };
 
 }  // namespace iocoro::detail
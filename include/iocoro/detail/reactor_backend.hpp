@@ -1,20 +1,98 @@
 #pragma once
 
+#include <iocoro/detail/reactor_types.hpp>
+
+#include <cerrno>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <optional>
+#include <span>
 #include <system_error>
 #include <vector>
 
+#include <sys/socket.h>
+
 namespace iocoro::detail {
 
+/// Readiness reported by `backend_interface::wait()`. Kept small and trivially copyable: a
+/// busy loop produces one per ready fd. The error code is only built for error events.
 struct backend_event {
   int fd = -1;
+  /// errno of a failed poll when `is_error`; 0 reports `error::connection_reset`.
+  int error = 0;
   bool can_read = false;
   bool can_write = false;
   bool is_error = false;
-  std::error_code ec{};
+};
+
+/// Completion-model I/O request (see `backend_interface::submit_io()`).
+///
+/// Pointers (buffer, address, msghdr, result) must stay valid until the operation completes.
+struct io_request {
+  // `accept_multishot` / `recv_multishot` are armed with `submit_multishot()`; the receive
+  // variant draws its buffers from the backend's provided-buffer ring. `read_fixed` /
+  // `write_fixed` move bytes from/to a registered buffer (see `register_buffers()`). `send_zc`
+  // sends without copying; it completes only once the kernel has released `data`. `splice`
+  // moves up to `size` bytes between two descriptors, at least one of them a pipe.
+  enum class opcode : std::uint8_t {
+    recv,
+    send,
+    accept,
+    connect,
+    recvmsg,
+    sendmsg,
+    accept_multishot,
+    recv_multishot,
+    read_fixed,
+    write_fixed,
+    send_zc,
+    splice
+  };
+
+  opcode op = opcode::recv;
+  int fd = -1;
+  // recv / send / read_fixed / write_fixed / send_zc.
+  void* data = nullptr;
+  std::size_t size = 0;
+  // read_fixed / write_fixed: index of the registered buffer containing `[data, data + size)`.
+  std::uint16_t buf_index = 0;
+  // MSG_* flags (recv/send/recvmsg/sendmsg/send_zc), SOCK_* flags (accept) or SPLICE_F_* flags
+  // (splice).
+  int flags = 0;
+  // accept: optional peer address output (`addr_len` in/out).
+  // connect: destination address (`connect_len`).
+  sockaddr* addr = nullptr;
+  socklen_t* addr_len = nullptr;
+  socklen_t connect_len = 0;
+  // recvmsg / sendmsg.
+  msghdr* msg = nullptr;
+  // splice: source and destination; -1 stands for `fd`. `splice_in_offset` is the file offset
+  // to read the source at, or -1 for none (pipes, sockets).
+  int splice_in = -1;
+  int splice_out = -1;
+  std::int64_t splice_in_offset = -1;
+  // Receives the syscall-style result (`>= 0`, or `-errno`) before the operation completes.
+  std::int32_t* result = nullptr;
+  // Registered-file slot standing in for `fd` (see `register_file()`), or -1.
+  std::int32_t fixed_file = -1;
+};
+
+// Provided-buffer ring geometry (multishot receive). Buffer ids are `0 .. count - 1`.
+inline constexpr std::size_t provided_buffer_size = 4096;
+inline constexpr std::uint32_t provided_buffer_count = 256;
+inline constexpr std::uint32_t no_provided_buffer = 0xFFFFFFFFU;
+
+/// Receiver of the results of a multishot request (see `backend_interface::submit_multishot()`).
+class io_stream_sink {
+ public:
+  virtual ~io_stream_sink() = default;
+
+  // Called on the reactor thread, once per result, without backend locks held. `res` is the
+  // syscall-style result; `buffer` is the provided-buffer id holding received bytes (or
+  // `no_provided_buffer`). The last result of a stream has `more == false`.
+  virtual void on_result(std::int32_t res, std::uint32_t buffer, bool more) noexcept = 0;
 };
 
 class backend_interface {
@@ -30,17 +108,120 @@ class backend_interface {
   virtual void add_fd(int fd) = 0;
   virtual void remove_fd(int fd) noexcept = 0;
 
-  virtual auto wait(std::optional<std::chrono::milliseconds> timeout,
+  // Block for at most `timeout` (forever if empty; a zero timeout only polls). Backends honour
+  // the full `steady_clock` precision: sub-millisecond timeouts must not be rounded to 0 or 1ms.
+  virtual auto wait(std::optional<std::chrono::steady_clock::duration> timeout,
                     std::vector<backend_event>& out) -> void = 0;
   virtual void prepare_wait() noexcept {}
   virtual void wakeup() noexcept = 0;
+
+  // True if only one thread may ever call `wait()` (io_uring SINGLE_ISSUER / DEFER_TASKRUN).
+  // io_context_impl then refuses any other thread before it can take the reactor role.
+  virtual auto single_issuer() const noexcept -> bool { return false; }
+
+  // Completion-model I/O (optional).
+  //
+  // Readiness backends (epoll) leave `supports_io()` false and callers perform the syscall
+  // themselves after a readiness wait. Completion backends (io_uring) run the operation in the
+  // kernel:
+  // - `submit_io()` may be called from any event-loop thread. It returns a non-zero id for
+  //   `cancel_io()`; a cancelled operation still completes, with `-ECANCELED`.
+  // - When the kernel is done, the result is stored through `io_request::result` and the op is
+  //   handed back by the next `take_completions()` (reactor thread, after `wait()`); the caller
+  //   then invokes `on_complete()`.
+  // - `drain_io()` detaches every in-flight op without a result (fatal backend error).
+  virtual auto supports_io() const noexcept -> bool { return false; }
+  // Per-opcode refinement of `supports_io()`: opcodes the kernel does not run are reported false
+  // here and left to the readiness path. Read once, at context construction.
+  virtual auto supports_io_op(io_request::opcode /*op*/) const noexcept -> bool {
+    return supports_io();
+  }
+  virtual auto submit_io(io_request const& /*req*/, reactor_op_ptr /*op*/) -> std::uint64_t {
+    throw std::system_error(std::make_error_code(std::errc::operation_not_supported),
+                            "backend does not support completion I/O");
+  }
+  virtual void cancel_io(std::uint64_t /*id*/) noexcept {}
+  virtual void take_completions(std::vector<reactor_op_ptr>& /*out*/) {}
+  virtual void drain_io(std::vector<reactor_op_ptr>& /*out*/) noexcept {}
+
+  // Multishot requests (optional, requires `supports_io()`).
+  //
+  // One submission produces a stream of results delivered to `sink` until a final result
+  // (`more == false`): an error, end of stream, or `-ECANCELED` after `cancel_io(id)`. A kernel
+  // without multishot support ends the stream with `-EINVAL` before any other result.
+  // Buffers named by receive results belong to the caller until `recycle_buffer()`.
+  virtual auto supports_multishot() const noexcept -> bool { return false; }
+  virtual auto submit_multishot(io_request const& /*req*/,
+                                std::shared_ptr<io_stream_sink> /*sink*/) -> std::uint64_t {
+    throw std::system_error(std::make_error_code(std::errc::operation_not_supported),
+                            "backend does not support multishot I/O");
+  }
+  virtual auto provided_buffer(std::uint32_t /*id*/) noexcept -> std::span<std::byte> {
+    return {};
+  }
+  virtual void recycle_buffer(std::uint32_t /*id*/) noexcept {}
+
+  // Registered files and buffers (optional, requires `supports_io()`).
+  //
+  // `register_file()` places `fd` in the backend's file table and returns its slot, or -1 if
+  // unsupported or full (callers then keep using the plain fd). Requests naming the slot skip
+  // the kernel's per-operation file lookup. The slot stays valid until `unregister_file()`,
+  // which callers only invoke once no request names it anymore. Both may be called from any
+  // thread.
+  //
+  // `register_buffers()` replaces the registered-buffer table (an empty span just drops it) and
+  // returns 0 or `-errno`; `read_fixed` / `write_fixed` requests index into it.
+  virtual auto register_file(int /*fd*/) noexcept -> std::int32_t { return -1; }
+  virtual void unregister_file(std::int32_t /*slot*/) noexcept {}
+  virtual auto register_buffers(std::span<std::span<std::byte> const> /*buffers*/) -> int {
+    return -EOPNOTSUPP;
+  }
+};
+
+/// Construction-time tuning of the backend. Fields name the backend they apply to; the others
+/// ignore them. The io_uring fields only matter to the experimental io_uring backend.
+///
+/// `single_issuer`, `defer_taskrun` and `coop_taskrun` are hints: a kernel that does not know
+/// them, or cannot combine them with `sqpoll`, gets a ring without them (`single_issuer()`
+/// reports the outcome). Any other setup failure makes construction throw.
+struct backend_options {
+  /// epoll: events fetched per wait. A batch that comes back full doubles the buffer for the
+  /// next wait, up to `max_events_limit` (set it to `max_events` for a fixed size).
+  std::size_t max_events = 128;
+  std::size_t max_events_limit = 4096;
+
+  /// io_uring: submission queue entries; size it to the expected number of in-flight operations.
+  unsigned queue_depth = 256;
+
+  /// IORING_SETUP_SQPOLL: a kernel thread polls the submission queue, so submitting needs no
+  /// syscall while it is awake. It sleeps after `sqpoll_idle` without work (0: kernel default);
+  /// `sqpoll_cpu >= 0` pins it to that CPU.
+  bool sqpoll = false;
+  std::chrono::milliseconds sqpoll_idle{0};
+  int sqpoll_cpu = -1;
+
+  /// IORING_SETUP_SINGLE_ISSUER: only one thread submits, which lets the kernel skip locking.
+  /// The io_context must then always be run by the same thread (the first one to run it), and
+  /// `io_context::register_buffers()` must be called from that thread. `run*()` from any other
+  /// thread, concurrently or after `restart()`, fails an `IOCORO_ENSURE`.
+  bool single_issuer = false;
+
+  /// IORING_SETUP_DEFER_TASKRUN (implies `single_issuer`): completion work runs when the loop
+  /// waits instead of interrupting it.
+  bool defer_taskrun = false;
+
+  /// IORING_SETUP_COOP_TASKRUN: completions do not interrupt the loop thread with an IPI.
+  bool coop_taskrun = false;
 };
 
 // Backend selection:
 // - Default is epoll (no additional dependencies).
-// - Define `IOCORO_BACKEND_URING` to use io_uring. This requires liburing headers and linking
-//   against liburing.
+// - Define `IOCORO_BACKEND_URING` to use io_uring (experimental: no green CI run yet; see
+//   `IOCORO_ENABLE_URING` in CMakeLists.txt). This requires liburing 2.3
+//   or later (headers and library). Also define `IOCORO_URING_BUF_RING` with liburing 2.4 or
+//   later to enable the provided-buffer ring behind multishot receives. The CMake build checks
+//   both.
 // - Define `IOCORO_BACKEND_EPOLL` to force epoll explicitly.
-auto make_backend() -> std::unique_ptr<backend_interface>;
+auto make_backend(backend_options const& opts = {}) -> std::unique_ptr<backend_interface>;
 
 }  // namespace iocoro::detail
@@ -1,6 +1,9 @@
 #pragma once
 
+#include <iocoro/detail/block_cache.hpp>
+
 #include <concepts>
+#include <cstddef>
 #include <cstdint>
 #include <memory>
 #include <system_error>
@@ -10,11 +13,13 @@ namespace iocoro::detail {
 
 class io_context_impl;
 
-enum class fd_event_kind : std::uint8_t { read, write };
+// `error`: the socket's error queue has entries (MSG_ZEROCOPY completions); epoll/poll report
+// it as EPOLLERR/POLLERR.
+enum class fd_event_kind : std::uint8_t { read, write, error };
 static constexpr std::uint64_t invalid_token = 0;
 
 struct event_handle {
-  enum class kind : std::uint8_t { none, timer, fd };
+  enum class kind : std::uint8_t { none, timer, fd, io };
 
   struct fd_data {
     int fd = -1;
@@ -27,36 +32,51 @@ struct event_handle {
     std::uint64_t token = invalid_token;
   };
 
-  // Weak reference for safe cancellation. The control block is owned by
-  // io_context_impl (via shared_ptr) and any executors/objects that keep it alive.
-  std::weak_ptr<io_context_impl> impl{};
+  // Completion-model operation submitted to the backend (`io_context_impl::submit_io()`).
+  struct io_data {
+    std::uint64_t id = invalid_token;
+  };
+
+  // Plain pointer: copying a handle costs no refcount traffic. Whoever keeps a handle to cancel
+  // it later must keep the context alive meanwhile (sockets and timers do, through the
+  // executor they hold). Staleness is detected by the token / id, not by the pointer.
+  io_context_impl* impl = nullptr;
   kind type = kind::none;
 
   fd_data fd{};
   timer_data timer{};
+  io_data io{};
 
-  static auto make_fd(std::weak_ptr<io_context_impl> impl_, int fd_, fd_event_kind kind_,
+  static auto make_fd(io_context_impl* impl_, int fd_, fd_event_kind kind_,
                       std::uint64_t token_) noexcept -> event_handle {
     return event_handle{
-      .impl = std::move(impl_),
+      .impl = impl_,
       .type = kind::fd,
       .fd = fd_data{fd_, kind_, token_},
     };
   }
 
-  static auto make_timer(std::weak_ptr<io_context_impl> impl_, std::uint32_t index,
+  static auto make_timer(io_context_impl* impl_, std::uint32_t index,
                          std::uint64_t token_) noexcept -> event_handle {
     return event_handle{
-      .impl = std::move(impl_),
+      .impl = impl_,
       .type = kind::timer,
       .timer = timer_data{index, token_},
     };
   }
 
+  static auto make_io(io_context_impl* impl_, std::uint64_t id) noexcept -> event_handle {
+    return event_handle{
+      .impl = impl_,
+      .type = kind::io,
+      .io = io_data{id},
+    };
+  }
+
   static auto invalid_handle() noexcept -> event_handle { return event_handle{}; }
 
   auto valid() const noexcept -> bool {
-    if (impl.expired()) {
+    if (impl == nullptr) {
       return false;
     }
     switch (type) {
@@ -64,6 +84,8 @@ struct event_handle {
         return fd.fd >= 0 && fd.token != invalid_token;
       case kind::timer:
         return timer.token != invalid_token;
+      case kind::io:
+        return io.id != invalid_token;
       case kind::none:
       default:
         return false;
@@ -87,6 +109,8 @@ struct reactor_vtable {
   void (*destroy)(void*) noexcept = nullptr;
 };
 
+/// Header of a reactor operation; the typed state lives in the same allocation
+/// (`reactor_op_block<State>` derives from it), so `block` points back at this object.
 struct reactor_op {
   reactor_vtable const* vt{};
   void* block{};
@@ -94,13 +118,9 @@ struct reactor_op {
 
 struct reactor_op_deleter {
   void operator()(reactor_op* op) const noexcept {
-    if (!op) {
-      return;
-    }
-    if (op->vt && op->block) {
+    if (op && op->vt) {
       op->vt->destroy(op->block);
     }
-    delete op;
   }
 };
 
@@ -113,11 +133,21 @@ concept reactor_state_noexcept = requires(State& s, std::error_code ec) {
 };
 
 template <typename State>
-struct reactor_op_block {
+struct reactor_op_block final : reactor_op {
   State state;
 
   template <typename... Args>
-  explicit reactor_op_block(Args&&... args) : state(std::forward<Args>(args)...) {}
+  explicit reactor_op_block(reactor_vtable const* vt_, Args&&... args)
+      : reactor_op{vt_, nullptr}, state(std::forward<Args>(args)...) {
+    block = this;
+  }
+
+  // Blocks are recycled through the per-thread cache: a steady stream of waits does not hit
+  // the global allocator.
+  static auto operator new(std::size_t size) -> void* { return block_cache::allocate(size); }
+  static void operator delete(void* p, std::size_t size) noexcept {
+    block_cache::deallocate(p, size);
+  }
 };
 
 template <typename State>
@@ -150,9 +180,31 @@ inline reactor_vtable const* reactor_vtable_for() noexcept {
 
 template <typename State, typename... Args>
 inline auto make_reactor_op(Args&&... args) -> reactor_op_ptr {
-  auto* block = new reactor_op_block<State>{std::forward<Args>(args)...};
-  auto* op = new reactor_op{reactor_vtable_for<State>(), block};
-  return reactor_op_ptr{op};
+  auto* block =
+    new reactor_op_block<State>{reactor_vtable_for<State>(), std::forward<Args>(args)...};
+  return reactor_op_ptr{block};
 }
 
+/// Inline-completion window of the current thread.
+///
+/// Open while an io_context runs completions from its own dispatch loops (ready fds, completed
+/// I/O, expired timers). Only then may a completed waiter resume inline (see
+/// `operation_wait_state`); completions raised anywhere else, such as inside a backend or by a
+/// `cancel()` issued from user code, keep being posted. The resuming side closes the window
+/// while it runs user code.
+///
+/// A scope opened with `open == false` keeps the window closed (and closes an enclosing one).
+inline thread_local bool inline_completion_allowed = false;
+
+struct inline_completion_scope {
+  bool prev;
+
+  explicit inline_completion_scope(bool open = true) noexcept
+      : prev(std::exchange(inline_completion_allowed, open)) {}
+  ~inline_completion_scope() { inline_completion_allowed = prev; }
+
+  inline_completion_scope(inline_completion_scope const&) = delete;
+  auto operator=(inline_completion_scope const&) -> inline_completion_scope& = delete;
+};
+
 }  // namespace iocoro::detail
@@ -11,6 +11,7 @@
 #include <iocoro/detail/socket/socket_impl_base.hpp>
 
 #include <atomic>
+#include <cstddef>
 #include <cstdint>
 #include <mutex>
 #include <system_error>
@@ -88,12 +89,20 @@ class acceptor_impl {
   /// - error_code on failure
   auto async_accept() -> awaitable<result<int>>;
 
+  /// Accept through one multishot request queueing up to `queue_limit` connections (0 = off).
+  ///
+  /// Only effective with multishot support; set it before the first accept.
+  void set_multishot_accept(std::size_t queue_limit) noexcept {
+    multishot_limit_.store(queue_limit, std::memory_order_relaxed);
+  }
+
  private:
   socket_impl_base base_;
 
   mutable std::mutex mtx_{};
   bool listening_{false};
   op_state accept_op_;
+  std::atomic<std::size_t> multishot_limit_{0};
 };
 
 }  // namespace iocoro::detail::socket
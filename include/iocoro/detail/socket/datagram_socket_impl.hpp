@@ -113,8 +113,11 @@ class datagram_socket_impl {
   /// - The entire buffer is sent as a single datagram (message boundary preserved).
   /// - If the socket is connected, the destination MUST match the connected endpoint.
   /// - Returns the number of bytes sent (should equal buffer size for datagram sockets).
+  /// - A non-zero `segment_size` (at most 65535) asks the kernel to split the buffer into
+  ///   datagrams of that size, the last one possibly shorter (UDP GSO, `UDP_SEGMENT` cmsg).
   auto async_send_to(std::span<std::byte const> buffer, sockaddr const* dest_addr,
-                     socklen_t dest_len) -> awaitable<result<std::size_t>>;
+                     socklen_t dest_len,
+                     std::size_t segment_size = 0) -> awaitable<result<std::size_t>>;
 
   /// Receive a datagram and retrieve the source endpoint.
   ///
@@ -123,8 +126,30 @@ class datagram_socket_impl {
   /// - The entire message is received in one operation (message boundary preserved).
   /// - If the buffer is too small, an error (message_size) is returned.
   /// - src_len must be initialized to the size of the src_addr buffer before calling.
-  auto async_receive_from(std::span<std::byte> buffer, sockaddr* src_addr,
-                          socklen_t* src_len) -> awaitable<result<std::size_t>>;
+  /// - If `segment_size` is non-null, it receives the size of the datagrams the kernel coalesced
+  ///   into the buffer (UDP GRO, `UDP_GRO` cmsg), or the received size if nothing was coalesced.
+  auto async_receive_from(std::span<std::byte> buffer, sockaddr* src_addr, socklen_t* src_len,
+                          std::size_t* segment_size = nullptr) -> awaitable<result<std::size_t>>;
+
+  /// Send several datagrams with one `sendmmsg()` per readiness.
+  ///
+  /// Each entry is a prepared native message: `msg_iov` holds the bytes of one datagram and
+  /// `msg_name` its destination (may be null on a connected socket; otherwise it must match the
+  /// connected endpoint, as for `async_send_to()`). Returns how many datagrams from the front of
+  /// `msgs` were sent (at least one unless `msgs` is empty); `msg_len` holds each one's size.
+  ///
+  /// There is no io_uring equivalent, so completion-model backends issue the same syscall after
+  /// waiting for writability through the ring.
+  auto async_send_batch(std::span<mmsghdr> msgs) -> awaitable<result<std::size_t>>;
+
+  /// Receive several datagrams with one `recvmmsg()` per readiness.
+  ///
+  /// Each entry names one receive buffer (`msg_iov`) and, optionally, storage for the source
+  /// address (`msg_name`, with `msg_namelen` set to its capacity). Returns how many entries from
+  /// the front of `msgs` were filled (at least one); for each, `msg_len` is the number of bytes
+  /// stored, `msg_namelen` the source address length and `msg_hdr.msg_flags` has `MSG_TRUNC` set
+  /// if the datagram did not fit.
+  auto async_receive_batch(std::span<mmsghdr> msgs) -> awaitable<result<std::size_t>>;
 
  private:
   enum class dgram_state : std::uint8_t {
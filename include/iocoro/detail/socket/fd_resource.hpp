@@ -2,9 +2,11 @@
 
 #include <iocoro/any_io_executor.hpp>
 #include <iocoro/detail/reactor_types.hpp>
+#include <iocoro/detail/socket/multishot_stream.hpp>
 
 #include <atomic>
 #include <cstdint>
+#include <memory>
 #include <mutex>
 #include <utility>
 
@@ -21,7 +23,8 @@ namespace iocoro::detail::socket {
 /// - Physical `::close(fd)` happens in the destructor (or after `release_fd()` is called).
 class fd_resource {
  public:
-  fd_resource(any_io_executor ex, int fd) noexcept : ex_(std::move(ex)), fd_(fd) {}
+  fd_resource(any_io_executor ex, int fd, std::int32_t fixed_file = -1) noexcept
+      : ex_(std::move(ex)), fd_(fd), fixed_file_(fixed_file) {}
 
   fd_resource(fd_resource const&) = delete;
   auto operator=(fd_resource const&) -> fd_resource& = delete;
@@ -30,13 +33,19 @@ class fd_resource {
 
   ~fd_resource() noexcept {
     cancel_all_handles();
+    end_read_stream();
+
+    auto* ctx = ex_.io_context_ptr();
+    // No request names the slot anymore: every in-flight operation pins this object.
+    if (ctx != nullptr) {
+      ctx->unregister_fixed_file(fixed_file_);
+    }
 
     auto fd = release_fd();
     if (fd < 0) {
       return;
     }
 
-    auto* ctx = ex_.io_context_ptr();
     if (ctx != nullptr) {
       ctx->remove_fd_sync(fd);
     }
@@ -49,8 +58,20 @@ class fd_resource {
 
   auto native_handle() const noexcept -> int { return fd_.load(std::memory_order_acquire); }
 
+  /// Registered-file slot of the fd in the io_context's backend, or -1.
+  auto fixed_file() const noexcept -> std::int32_t { return fixed_file_; }
+
   auto release_fd() noexcept -> int { return fd_.exchange(-1, std::memory_order_acq_rel); }
 
+  /// MSG_ZEROCOPY bookkeeping of the fd. Only the active writer touches it (one at a time).
+  struct zerocopy_state {
+    enum class mode : std::uint8_t { unknown, enabled, unsupported };
+    mode state = mode::unknown;
+    // Notification id the kernel assigns to the next zero-copy send (counts from 0 per socket).
+    std::uint32_t next_id = 0;
+  };
+  auto zerocopy() noexcept -> zerocopy_state& { return zerocopy_; }
+
   void add_inflight() noexcept { inflight_.fetch_add(1, std::memory_order_acq_rel); }
 
   void remove_inflight() noexcept { inflight_.fetch_sub(1, std::memory_order_acq_rel); }
@@ -117,6 +138,34 @@ class fd_resource {
     h.cancel();
   }
 
+  /// Multishot request feeding the read side (accept or receive), if one was set up.
+  auto read_stream() const noexcept -> std::shared_ptr<multishot_stream> {
+    std::scoped_lock lk{mtx_};
+    return read_stream_;
+  }
+
+  void set_read_stream(std::shared_ptr<multishot_stream> st) noexcept {
+    std::scoped_lock lk{mtx_};
+    read_stream_ = std::move(st);
+  }
+
+  /// Detach the multishot stream and cancel its request. An armed request pins the file in the
+  /// kernel, so this must happen on close; queued results are released with the stream.
+  void end_read_stream() noexcept {
+    std::shared_ptr<multishot_stream> st{};
+    {
+      std::scoped_lock lk{mtx_};
+      st = std::exchange(read_stream_, {});
+    }
+    if (!st) {
+      return;
+    }
+    auto* ctx = ex_.io_context_ptr();
+    if (auto const id = st->id(); ctx != nullptr && id != 0) {
+      ctx->cancel_io(id);
+    }
+  }
+
   void cancel_all_handles() noexcept {
     event_handle rh{};
     event_handle wh{};
@@ -132,6 +181,7 @@ class fd_resource {
  private:
   any_io_executor ex_{};
   std::atomic<int> fd_{-1};
+  std::int32_t fixed_file_ = -1;
   std::atomic<bool> closing_{false};
   std::atomic<std::uint32_t> inflight_{0};
   std::atomic<std::uint64_t> read_cancel_epoch_{0};
@@ -139,6 +189,8 @@ class fd_resource {
   mutable std::mutex mtx_{};
   event_handle read_handle_{};
   event_handle write_handle_{};
+  std::shared_ptr<multishot_stream> read_stream_{};
+  zerocopy_state zerocopy_{};
 };
 
 }  // namespace iocoro::detail::socket
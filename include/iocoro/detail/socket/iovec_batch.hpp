@@ -0,0 +1,43 @@
+#pragma once
+
+#include <iocoro/net/buffer.hpp>
+
+#include <array>
+#include <cstddef>
+
+#include <sys/uio.h>
+
+namespace iocoro::detail::socket {
+
+/// Scatter/gather list for one `readv`/`sendmsg`-style call.
+///
+/// Empty buffers are dropped. Buffers past `max_buffers` are left out; a "some" operation
+/// transfers at most the listed bytes anyway, and composed operations pick the rest up on a
+/// later call. The array lives inline so an in-flight operation can keep it in its own frame.
+struct iovec_batch {
+  static constexpr std::size_t max_buffers = 64;
+
+  std::array<::iovec, max_buffers> iov{};
+  std::size_t count = 0;
+  std::size_t total = 0;
+
+  // Mutable sequences convert to `const_buffer` too; the batch is only read or written through
+  // as its caller asked.
+  template <net::const_buffer_sequence Buffers>
+  static auto gather(Buffers const& buffers) noexcept -> iovec_batch {
+    iovec_batch batch{};
+    for (net::const_buffer const b : buffers) {
+      if (batch.count == max_buffers) {
+        break;
+      }
+      if (b.empty()) {
+        continue;
+      }
+      batch.iov[batch.count++] = ::iovec{const_cast<void*>(b.data()), b.size()};
+      batch.total += b.size();
+    }
+    return batch;
+  }
+};
+
+}  // namespace iocoro::detail::socket
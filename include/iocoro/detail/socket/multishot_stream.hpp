@@ -0,0 +1,176 @@
+#pragma once
+
+#include <iocoro/detail/io_context_impl.hpp>
+#include <iocoro/detail/reactor_backend.hpp>
+#include <iocoro/detail/reactor_types.hpp>
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <utility>
+
+#include <unistd.h>
+
+namespace iocoro::detail::socket {
+
+/// Consumer side of a multishot request (accept, or receive with provided buffers).
+///
+/// The backend delivers results on the reactor thread through `on_result()`; they queue here
+/// until the socket's single reader takes them, and a parked reader is completed directly.
+///
+/// Backpressure: once `limit` results are queued the stream cancels its own request, so further
+/// connections/bytes stay in the kernel until the reader catches up and re-arms it.
+///
+/// Cancellation: a final `-ECANCELED` is only reported to a parked reader. Without one it is the
+/// result of backpressure or of a stale cancel and merely disarms the stream.
+class multishot_stream final : public io_stream_sink {
+ public:
+  enum class kind : std::uint8_t { accept, recv };
+
+  struct item {
+    std::int32_t res = 0;
+    std::uint32_t buffer = no_provided_buffer;
+  };
+
+  // The context is held weakly: while armed, the stream is owned by the context's backend.
+  multishot_stream(std::weak_ptr<io_context_impl> ctx, kind k, std::size_t limit) noexcept
+      : ctx_(std::move(ctx)), kind_(k), limit_(limit == 0 ? 1 : limit) {}
+
+  multishot_stream(multishot_stream const&) = delete;
+  auto operator=(multishot_stream const&) -> multishot_stream& = delete;
+  multishot_stream(multishot_stream&&) = delete;
+  auto operator=(multishot_stream&&) -> multishot_stream& = delete;
+
+  ~multishot_stream() override {
+    for (auto const& it : queue_) {
+      dispose(it);
+    }
+  }
+
+  void on_result(std::int32_t res, std::uint32_t buffer, bool more) noexcept override {
+    reactor_op_ptr waiter{};
+    std::uint64_t disarm_id = 0;
+    {
+      std::scoped_lock lk{mtx_};
+      if (!more) {
+        armed_ = false;
+        if (res == -EINVAL && !delivered_) {
+          unsupported_ = true;
+        }
+      }
+      bool const report = res != -ECANCELED || more || waiter_ != nullptr;
+      if (report) {
+        try {
+          queue_.push_back(item{res, buffer});
+          delivered_ = delivered_ || res >= 0;
+        } catch (...) {
+          dispose(item{res, buffer});
+        }
+      } else {
+        dispose(item{res, buffer});
+      }
+      if (more && armed_ && !disarm_requested_ && queue_.size() >= limit_) {
+        disarm_requested_ = true;
+        disarm_id = id_;
+      }
+      waiter = std::move(waiter_);
+    }
+    if (disarm_id != 0) {
+      if (auto ctx = ctx_.lock()) {
+        ctx->cancel_io(disarm_id);
+      }
+    }
+    if (waiter) {
+      waiter->vt->on_complete(waiter->block);
+    }
+  }
+
+  // Reader side: at most one reader at a time (the owning socket's op_state enforces it).
+
+  auto try_take(item& out) -> bool {
+    std::scoped_lock lk{mtx_};
+    if (queue_.empty()) {
+      return false;
+    }
+    out = queue_.front();
+    queue_.pop_front();
+    return true;
+  }
+
+  /// True if the request must be (re-)armed before the reader can park.
+  auto needs_arm() const -> bool {
+    std::scoped_lock lk{mtx_};
+    return !armed_ && !unsupported_ && queue_.size() < limit_;
+  }
+
+  /// True once the kernel rejected the request; callers fall back to one operation per call.
+  auto unsupported() const -> bool {
+    std::scoped_lock lk{mtx_};
+    return unsupported_;
+  }
+
+  // Arming is split around the submission: results may arrive (on another event-loop thread)
+  // before `submit_multishot()` even returns.
+  void begin_arm() {
+    std::scoped_lock lk{mtx_};
+    id_ = 0;
+    armed_ = true;
+    disarm_requested_ = false;
+  }
+  void set_id(std::uint64_t id) {
+    std::scoped_lock lk{mtx_};
+    id_ = id;
+  }
+  void abort_arm() noexcept {
+    std::scoped_lock lk{mtx_};
+    armed_ = false;
+  }
+
+  auto id() const -> std::uint64_t {
+    std::scoped_lock lk{mtx_};
+    return id_;
+  }
+
+  /// Park `op` until the next result. Returns false (leaving `op` untouched) if a result is
+  /// already queued or the stream is no longer armed.
+  auto park(reactor_op_ptr& op) -> bool {
+    std::scoped_lock lk{mtx_};
+    if (!queue_.empty() || !armed_) {
+      return false;
+    }
+    waiter_ = std::move(op);
+    return true;
+  }
+
+  /// Release what `it` refers to (an accepted fd or a provided buffer) without consuming it.
+  void dispose(item const& it) noexcept {
+    if (kind_ == kind::accept) {
+      if (it.res >= 0) {
+        (void)::close(it.res);
+      }
+    } else if (it.buffer != no_provided_buffer) {
+      if (auto ctx = ctx_.lock()) {
+        ctx->recycle_buffer(it.buffer);
+      }
+    }
+  }
+
+ private:
+  std::weak_ptr<io_context_impl> ctx_;
+  kind kind_;
+  std::size_t limit_;
+
+  mutable std::mutex mtx_{};
+  std::deque<item> queue_{};
+  reactor_op_ptr waiter_{};
+  std::uint64_t id_ = 0;
+  bool armed_ = false;
+  bool disarm_requested_ = false;
+  bool delivered_ = false;
+  bool unsupported_ = false;
+};
+
+}  // namespace iocoro::detail::socket
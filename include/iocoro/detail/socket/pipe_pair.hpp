@@ -0,0 +1,99 @@
+#pragma once
+
+#include <iocoro/error.hpp>
+#include <iocoro/result.hpp>
+
+#include <iocoro/detail/socket_utils.hpp>
+
+#include <algorithm>
+#include <cerrno>
+#include <cstddef>
+#include <utility>
+
+#include <fcntl.h>
+#include <unistd.h>
+
+namespace iocoro::detail::socket {
+
+/// Owned, non-blocking pipe used as the in-kernel buffer of a splice.
+///
+/// `splice(2)` needs a pipe on one side, so moving bytes file -> socket or socket -> socket goes
+/// through one of these without ever reaching user space. Owners keep it across operations and
+/// decide what happens to bytes left in it when one fails.
+class pipe_pair {
+ public:
+  pipe_pair() noexcept = default;
+
+  pipe_pair(pipe_pair const&) = delete;
+  auto operator=(pipe_pair const&) -> pipe_pair& = delete;
+
+  pipe_pair(pipe_pair&& other) noexcept
+      : read_fd_(std::exchange(other.read_fd_, -1)),
+        write_fd_(std::exchange(other.write_fd_, -1)),
+        capacity_(std::exchange(other.capacity_, 0)) {}
+  auto operator=(pipe_pair&& other) noexcept -> pipe_pair& {
+    if (this != &other) {
+      reset();
+      read_fd_ = std::exchange(other.read_fd_, -1);
+      write_fd_ = std::exchange(other.write_fd_, -1);
+      capacity_ = std::exchange(other.capacity_, 0);
+    }
+    return *this;
+  }
+
+  ~pipe_pair() { reset(); }
+
+  /// Kernel default pipe capacity, and the largest one `open()` asks for.
+  static constexpr std::size_t default_capacity = std::size_t{64} * 1024;
+  static constexpr std::size_t max_capacity = std::size_t{1024} * 1024;
+
+  /// Create the pipe, grown towards `capacity` bytes (clamped to `max_capacity`). Growing is
+  /// best-effort: an unprivileged process cannot exceed `/proc/sys/fs/pipe-max-size`.
+  static auto open(std::size_t capacity = default_capacity) noexcept -> result<pipe_pair> {
+    int fds[2]{-1, -1};
+    if (::pipe2(fds, O_NONBLOCK | O_CLOEXEC) != 0) {
+      return unexpected(map_socket_errno(errno));
+    }
+    pipe_pair p{};
+    p.read_fd_ = fds[0];
+    p.write_fd_ = fds[1];
+    p.capacity_ = default_capacity;
+    p.reserve(capacity);
+    return p;
+  }
+
+  /// Grow the pipe towards `capacity` bytes, best-effort like `open()`. Each size is only tried
+  /// once: asking for no more than before costs no syscall, even if growing failed.
+  void reserve(std::size_t capacity) noexcept {
+    auto const size = (std::min)(capacity, max_capacity);
+    if (write_fd_ < 0 || size <= capacity_) {
+      return;
+    }
+    (void)::fcntl(write_fd_, F_SETPIPE_SZ, static_cast<int>(size));
+    capacity_ = size;
+  }
+
+  auto is_open() const noexcept -> bool { return read_fd_ >= 0; }
+  auto read_fd() const noexcept -> int { return read_fd_; }
+  auto write_fd() const noexcept -> int { return write_fd_; }
+
+  void reset() noexcept {
+    if (read_fd_ >= 0) {
+      (void)::close(read_fd_);
+      read_fd_ = -1;
+    }
+    if (write_fd_ >= 0) {
+      (void)::close(write_fd_);
+      write_fd_ = -1;
+    }
+    capacity_ = 0;
+  }
+
+ private:
+  int read_fd_ = -1;
+  int write_fd_ = -1;
+  // Largest capacity asked for so far (the kernel may have granted less).
+  std::size_t capacity_ = 0;
+};
+
+}  // namespace iocoro::detail::socket
@@ -5,6 +5,7 @@
 #include <iocoro/awaitable.hpp>
 #include <iocoro/detail/io_context_impl.hpp>
 #include <iocoro/detail/operation_awaiter.hpp>
+#include <iocoro/detail/scope_guard.hpp>
 #include <iocoro/detail/socket/fd_resource.hpp>
 #include <iocoro/error.hpp>
 #include <iocoro/result.hpp>
@@ -12,8 +13,11 @@
 #include <iocoro/this_coro.hpp>
 
 #include <atomic>
+#include <cstddef>
+#include <cstdint>
 #include <memory>
 #include <mutex>
+#include <span>
 #include <system_error>
 #include <utility>
 
@@ -172,25 +176,175 @@ class socket_impl_base {
 
   auto wait_read_ready() -> awaitable<result<void>> {
     auto res = acquire_resource();
-    return wait_ready_impl(std::move(res), true);
+    return wait_ready_impl(std::move(res), fd_event_kind::read);
   }
 
   auto wait_write_ready() -> awaitable<result<void>> {
     auto res = acquire_resource();
-    return wait_ready_impl(std::move(res), false);
+    return wait_ready_impl(std::move(res), fd_event_kind::write);
   }
 
   auto wait_read_ready(std::shared_ptr<fd_resource> const& res) -> awaitable<result<void>> {
-    return wait_ready_impl(res, true);
+    return wait_ready_impl(res, fd_event_kind::read);
   }
 
   auto wait_write_ready(std::shared_ptr<fd_resource> const& res) -> awaitable<result<void>> {
-    return wait_ready_impl(res, false);
+    return wait_ready_impl(res, fd_event_kind::write);
+  }
+
+  /// Wait until the socket's error queue may have entries (readiness model only).
+  ///
+  /// Belongs to the write side: `cancel_write()` aborts it. Registering such a wait also stops
+  /// error events on this fd from aborting read/write waiters (see `fd_registry`).
+  auto wait_error_ready(std::shared_ptr<fd_resource> const& res) -> awaitable<result<void>> {
+    return wait_ready_impl(res, fd_event_kind::error);
+  }
+
+  /// See `io_context_impl::watch_error_queue()`; call before the first error-queue producer.
+  void watch_error_queue(std::shared_ptr<fd_resource> const& res) noexcept {
+    ctx_impl_->watch_error_queue(res->native_handle());
+  }
+
+  /// True if I/O should be submitted through `async_io()` (completion-model backend).
+  auto completion_io() const noexcept -> bool { return ctx_impl_->supports_completion_io(); }
+
+  /// Like `completion_io()`, for requests with opcode `op` only.
+  auto completion_io(io_request::opcode op) const noexcept -> bool {
+    return ctx_impl_->supports_completion_io(op);
+  }
+
+  /// Run `req` in the backend (completion model) and wait for the kernel's result.
+  ///
+  /// `req.fd` and `req.result` are filled in here. Returns the syscall-style result (`>= 0`, or
+  /// `-errno`); `cancel_read()` / `cancel_write()` (selected by `is_read`) make an in-flight
+  /// operation complete with `-ECANCELED`. Callers keep their usual EINTR/EAGAIN handling: an
+  /// `-EAGAIN` result simply falls back to a readiness wait.
+  auto async_io(std::shared_ptr<fd_resource> const& res, io_request req,
+                bool is_read) -> awaitable<result<int>> {
+    auto inflight = make_operation_guard(res);
+    if (!inflight) {
+      if (res && res->closing()) {
+        co_return unexpected(error::operation_aborted);
+      }
+      co_return unexpected(error::not_open);
+    }
+    auto pinned = inflight.resource();
+
+    co_await this_coro::on(dispatch_ex_);
+    auto const cancel_epoch = is_read ? pinned->read_cancel_epoch() : pinned->write_cancel_epoch();
+    std::int32_t io_result = 0;
+    req.fd = pinned->native_handle();
+    req.fixed_file = pinned->fixed_file();
+    req.result = &io_result;
+    // The awaiter is a named local on purpose: GCC 12 destroys a temporary awaiter of a
+    // `co_await` expression twice, which over-releases the `pinned` copy held by the lambda.
+    auto awaiter = detail::operation_awaiter{
+      [this, pinned, is_read, cancel_epoch, &req](detail::reactor_op_ptr rop) mutable {
+        event_handle h = ctx_impl_->submit_io(req, std::move(rop));
+        if (is_read) {
+          pinned->set_read_handle(h, cancel_epoch);
+        } else {
+          pinned->set_write_handle(h, cancel_epoch);
+        }
+        return h;
+      }};
+    auto r = co_await awaiter;
+    if (!r) {
+      co_return unexpected(r.error());
+    }
+    // No closing() check here: the operation already took effect (bytes moved, fd accepted) and
+    // the caller decides how to report it.
+    co_return io_result;
+  }
+
+  /// Registered buffer holding all of `buffer` (completion I/O only), or -1.
+  ///
+  /// Reads/writes from such a buffer go out as `read_fixed` / `write_fixed` requests, which skip
+  /// pinning the pages on every call. Writes only qualify while `io_context_impl::fixed_writes()`.
+  auto fixed_buffer_index(std::span<std::byte const> buffer, bool is_write) const noexcept
+    -> std::int32_t {
+    if (is_write && !ctx_impl_->fixed_writes()) {
+      return -1;
+    }
+    return ctx_impl_->find_fixed_buffer(buffer.data(), buffer.size());
+  }
+
+  /// True if read-side multishot requests are available (see `async_multishot()`).
+  auto multishot_io() const noexcept -> bool { return ctx_impl_->supports_multishot(); }
+
+  /// Take the next result of the multishot request `req` feeding the read side of `res`.
+  ///
+  /// The request is armed on first use, and again whenever it ended (error, backpressure, a
+  /// stale cancel) with nothing queued. `cancel_read()` aborts a waiting reader, which then
+  /// receives `-ECANCELED`. If the result is `-EINVAL` and `stream->unsupported()`, the kernel
+  /// rejected the request and callers fall back to one operation per call.
+  auto async_multishot(std::shared_ptr<fd_resource> const& res, multishot_stream::kind k,
+                       std::size_t limit,
+                       io_request req) -> awaitable<result<multishot_stream::item>> {
+    auto inflight = make_operation_guard(res);
+    if (!inflight) {
+      if (res && res->closing()) {
+        co_return unexpected(error::operation_aborted);
+      }
+      co_return unexpected(error::not_open);
+    }
+    auto pinned = inflight.resource();
+
+    co_await this_coro::on(dispatch_ex_);
+    auto stream = pinned->read_stream();
+    if (!stream) {
+      stream = std::make_shared<multishot_stream>(ctx_impl_->weak_from_this(), k, limit);
+      pinned->set_read_stream(stream);
+    }
+
+    for (;;) {
+      multishot_stream::item it{};
+      if (stream->try_take(it)) {
+        co_return it;
+      }
+      if (stream->unsupported()) {
+        co_return multishot_stream::item{.res = -EINVAL};
+      }
+      if (stream->needs_arm()) {
+        req.fd = pinned->native_handle();
+        req.fixed_file = pinned->fixed_file();
+        stream->begin_arm();
+        try {
+          stream->set_id(ctx_impl_->submit_multishot(req, stream));
+        } catch (...) {
+          stream->abort_arm();
+          throw;
+        }
+      }
+
+      // A parked reader is not known to the reactor; keep `run()` alive while it waits.
+      ctx_impl_->add_work_guard();
+      auto work = detail::make_scope_exit([this]() noexcept { ctx_impl_->remove_work_guard(); });
+      auto const cancel_epoch = pinned->read_cancel_epoch();
+      // Named awaiter: see async_io().
+      auto awaiter = detail::operation_awaiter{
+        [this, pinned, stream, cancel_epoch](detail::reactor_op_ptr rop) mutable {
+          if (!stream->park(rop)) {
+            // A result is already queued (or the stream ended): loop around.
+            rop->vt->on_complete(rop->block);
+            return event_handle{};
+          }
+          auto h = event_handle::make_io(ctx_impl_, stream->id());
+          pinned->set_read_handle(h, cancel_epoch);
+          return h;
+        }};
+      auto r = co_await awaiter;
+      if (!r) {
+        co_return unexpected(r.error());
+      }
+    }
   }
 
  private:
-  auto wait_ready_impl(std::shared_ptr<fd_resource> const& res,
-                       bool is_read) -> awaitable<result<void>> {
+  // `res` by value: a coroutine keeps only a reference parameter, and `wait_read_ready()`
+  // passes a temporary.
+  auto wait_ready_impl(std::shared_ptr<fd_resource> res,
+                       fd_event_kind kind) -> awaitable<result<void>> {
     auto inflight = make_operation_guard(res);
     if (!inflight) {
       if (res && res->closing()) {
@@ -201,12 +355,24 @@ class socket_impl_base {
     auto pinned = inflight.resource();
 
     co_await this_coro::on(dispatch_ex_);
+    bool const is_read = kind == fd_event_kind::read;
     auto const cancel_epoch = is_read ? pinned->read_cancel_epoch() : pinned->write_cancel_epoch();
-    auto r = co_await detail::operation_awaiter{
-      [this, pinned, is_read, cancel_epoch](detail::reactor_op_ptr rop) mutable {
-        event_handle h = is_read
-                           ? ctx_impl_->register_fd_read(pinned->native_handle(), std::move(rop))
-                           : ctx_impl_->register_fd_write(pinned->native_handle(), std::move(rop));
+    // Named awaiter: see async_io().
+    auto awaiter = detail::operation_awaiter{
+      [this, pinned, kind, is_read, cancel_epoch](detail::reactor_op_ptr rop) mutable {
+        auto const fd = pinned->native_handle();
+        event_handle h{};
+        switch (kind) {
+          case fd_event_kind::read:
+            h = ctx_impl_->register_fd_read(fd, std::move(rop));
+            break;
+          case fd_event_kind::write:
+            h = ctx_impl_->register_fd_write(fd, std::move(rop));
+            break;
+          case fd_event_kind::error:
+            h = ctx_impl_->register_fd_error(fd, std::move(rop));
+            break;
+        }
         if (is_read) {
           pinned->set_read_handle(h, cancel_epoch);
         } else {
@@ -214,6 +380,7 @@ class socket_impl_base {
         }
         return h;
       }};
+    auto r = co_await awaiter;
     if (r && pinned->closing()) {
       co_return unexpected(error::operation_aborted);
     }
@@ -225,6 +392,7 @@ class socket_impl_base {
     }
     res->mark_closing();
     res->cancel_all_handles();
+    res->end_read_stream();
   }
 
   any_io_executor ex_{};
@@ -2,22 +2,27 @@
 
 #include <iocoro/error.hpp>
 #include <iocoro/io_context.hpp>
+#include <iocoro/received_buffer.hpp>
 #include <iocoro/result.hpp>
 #include <iocoro/shutdown.hpp>
 
 #include <iocoro/detail/scope_guard.hpp>
+#include <iocoro/detail/socket/iovec_batch.hpp>
 #include <iocoro/detail/socket/op_state.hpp>
+#include <iocoro/detail/socket/pipe_pair.hpp>
 #include <iocoro/detail/socket/socket_impl_base.hpp>
 
 #include <atomic>
 #include <cstddef>
 #include <cstdint>
+#include <memory>
 #include <mutex>
 #include <span>
 #include <system_error>
 #include <utility>
 
 // Native socket address types (POSIX).
+#include <poll.h>
 #include <sys/socket.h>
 
 namespace iocoro::detail::socket {
@@ -152,14 +157,87 @@ class stream_socket_impl {
   /// Read at most `size` bytes into `data`.
   auto async_read_some(std::span<std::byte> buffer) -> awaitable<result<std::size_t>>;
 
+  /// Scatter read (`readv`/`recvmsg`) into the buffers of `buffers`, in order.
+  auto async_read_some(iovec_batch buffers) -> awaitable<result<std::size_t>>;
+
+  /// Receive the next chunk of bytes into a buffer chosen by the implementation.
+  ///
+  /// With multishot support the first call arms one receive that keeps filling buffers from the
+  /// io_context's provided-buffer ring; later calls take already-filled buffers without a
+  /// submission. Otherwise (or while the ring is exhausted) this reads up to
+  /// `provided_buffer_size` bytes into an owned buffer. Shares the read side with
+  /// `async_read_some()`; do not interleave the two on one socket.
+  auto async_receive_buffer() -> awaitable<result<received_buffer>>;
+
   /// Write at most `size` bytes from `data`.
   auto async_write_some(std::span<std::byte const> buffer) -> awaitable<result<std::size_t>>;
 
+  /// Gather write (`sendmsg`) from the buffers of `buffers`, in order.
+  auto async_write_some(iovec_batch buffers) -> awaitable<result<std::size_t>>;
+
+  /// Write at most `size` bytes from `data` without copying them into the socket buffer.
+  ///
+  /// Completes only once the kernel no longer references `buffer`: after the MSG_ZEROCOPY
+  /// notification on the socket's error queue (readiness model, `SO_ZEROCOPY` is enabled on
+  /// first use) or the IORING_OP_SEND_ZC notification (completion model). While that wait is
+  /// pending, `cancel_write()` does not end it; `close()` does. Sockets that do not support
+  /// zero-copy (e.g. AF_UNIX) get a plain copying send.
+  auto async_write_some_zerocopy(std::span<std::byte const> buffer)
+    -> awaitable<result<std::size_t>>;
+
+  /// Send up to `count` bytes of the file `file_fd`, read from `offset`, without copying them
+  /// through user space.
+  ///
+  /// Readiness model: sendfile(2). Completion model: IORING_OP_SPLICE, file -> pipe -> socket.
+  /// Returns 0 if `offset` is at or past the end of the file.
+  ///
+  /// The pipe belongs to the socket and is reused by later calls. The count returned is what
+  /// reached the socket: if sending fails after part of a chunk, the rest is discarded with the
+  /// pipe and the caller resumes at `offset` plus that count.
+  auto async_sendfile_some(int file_fd, std::uint64_t offset, std::size_t count)
+    -> awaitable<result<std::size_t>>;
+
+  /// Move up to `count` received bytes into the pipe whose write end is `pipe_fd`.
+  ///
+  /// Read side, like `async_read_some()`; returns 0 at end of stream. The pipe must have room:
+  /// a full pipe fails the operation with EAGAIN (`std::errc::resource_unavailable_try_again`).
+  auto async_splice_read_some(int pipe_fd, std::size_t count) -> awaitable<result<std::size_t>>;
+
+  /// Send up to `count` bytes out of the pipe whose read end is `pipe_fd`.
+  ///
+  /// Write side, like `async_write_some()`. The pipe must not be empty; an empty pipe fails the
+  /// operation with EAGAIN as well.
+  auto async_splice_write_some(int pipe_fd, std::size_t count) -> awaitable<result<std::size_t>>;
+
   auto shutdown(shutdown_type what) -> result<void>;
 
  private:
   enum class conn_state : std::uint8_t { disconnected, connecting, connected };
 
+  // One transfer on the socket, retried on EINTR and after a readiness wait on EAGAIN: `req`
+  // through the backend if `use_io` (completion model), otherwise `syscall()`, which returns the
+  // byte count or -1 with `errno` set. `is_read` selects the side: its op_state epoch, its
+  // cancellation and the readiness waited for. If the transfer also involves a pipe (`pipe.fd`,
+  // polled for `pipe.events`), an EAGAIN while that pipe is not ready is returned as an error:
+  // the pipe, not the socket, is what would block.
+  template <typename Syscall>
+  auto transfer_some(std::shared_ptr<fd_resource> const& res, std::uint64_t epoch, bool is_read,
+                     bool use_io, io_request req, Syscall syscall,
+                     pollfd pipe = {.fd = -1, .events = 0, .revents = 0})
+    -> awaitable<result<std::size_t>>;
+
+  // sendfile(2) and splice(2) take no MSG_NOSIGNAL: on a reset connection (or a pipe without
+  // readers) they raise SIGPIPE. Unless it is ignored, each call runs under a `sigpipe_block`.
+  // The disposition is looked up once, by the first such call on this socket. (IORING_OP_SPLICE
+  // runs on io-wq workers, which block signals; the completion model needs neither.)
+  auto sigpipe_ignored() const noexcept -> bool;
+
+  // One splice(2) between the socket and `in` / `out` (-1 for the socket itself; `in_offset`
+  // applies to a file source), through `transfer_some()`.
+  auto splice_some(std::shared_ptr<fd_resource> const& res, std::uint64_t epoch, bool is_read,
+                   bool use_io, int in, int out, std::int64_t in_offset,
+                   std::size_t count) -> awaitable<result<std::size_t>>;
+
   struct shutdown_state {
     std::atomic<bool> read{false};
     std::atomic<bool> write{false};
@@ -174,6 +252,14 @@ class stream_socket_impl {
   op_state write_op_{};
   op_state connect_op_{};
   shutdown_state shutdown_{};
+  // Completion-model `async_sendfile_some()`: opened on first use, empty between calls. Only
+  // touched by the write side, which `write_op_` keeps to one operation at a time.
+  pipe_pair sendfile_pipe_{};
+
+  static constexpr std::uint8_t sigpipe_unknown = 0;
+  static constexpr std::uint8_t sigpipe_ignored_state = 1;
+  static constexpr std::uint8_t sigpipe_raised_state = 2;
+  mutable std::atomic<std::uint8_t> sigpipe_state_{sigpipe_unknown};
 };
 
 }  // namespace iocoro::detail::socket
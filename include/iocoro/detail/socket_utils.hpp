@@ -9,7 +9,10 @@
 
 // Native socket APIs for endpoint conversion.
 #include <fcntl.h>
+#include <pthread.h>
+#include <signal.h>
 #include <sys/socket.h>
+#include <time.h>
 
 namespace iocoro::detail::socket {
 
@@ -59,6 +62,56 @@ inline constexpr auto send_no_signal_flags() noexcept -> int {
 #endif
 }
 
+/// True if SIGPIPE is currently ignored process-wide.
+inline auto sigpipe_ignored() noexcept -> bool {
+  struct sigaction sa{};
+  return ::sigaction(SIGPIPE, nullptr, &sa) == 0 && sa.sa_handler == SIG_IGN;
+}
+
+/// Keeps the SIGPIPE of one system call on the calling thread from reaching the process.
+///
+/// sendfile(2) and splice(2) into a reset connection (or a pipe without readers) fail with EPIPE
+/// and, unlike send(), take no MSG_NOSIGNAL: they raise SIGPIPE as well. While alive (and
+/// `active`), this blocks SIGPIPE on the current thread; `failed(errno)` after the call takes the
+/// signal an EPIPE left pending. Scope it to the system call, never across a `co_await`.
+class sigpipe_block {
+ public:
+  explicit sigpipe_block(bool active) noexcept {
+    if (!active) {
+      return;
+    }
+    ::sigemptyset(&sigpipe_);
+    ::sigaddset(&sigpipe_, SIGPIPE);
+    active_ = ::pthread_sigmask(SIG_BLOCK, &sigpipe_, &old_mask_) == 0 &&
+              ::sigismember(&old_mask_, SIGPIPE) == 0;
+  }
+
+  sigpipe_block(sigpipe_block const&) = delete;
+  auto operator=(sigpipe_block const&) -> sigpipe_block& = delete;
+
+  ~sigpipe_block() {
+    if (active_) {
+      (void)::pthread_sigmask(SIG_SETMASK, &old_mask_, nullptr);
+    }
+  }
+
+  // The call failed with `err`; preserves `errno`.
+  void failed(int err) noexcept {
+    if (!active_ || err != EPIPE) {
+      return;
+    }
+    timespec const zero{};
+    while (::sigtimedwait(&sigpipe_, nullptr, &zero) < 0 && errno == EINTR) {
+    }
+    errno = err;
+  }
+
+ private:
+  sigset_t sigpipe_{};
+  sigset_t old_mask_{};
+  bool active_ = false;
+};
+
 inline auto is_accept_transient_error(int err) noexcept -> bool {
   switch (err) {
     case ENETDOWN:
@@ -13,10 +13,12 @@
 #include <memory>
 #include <mutex>
 #include <optional>
+#include <span>
 #include <stop_token>
 #include <type_traits>
 #include <utility>
 #include <variant>
+#include <vector>
 
 namespace iocoro::detail {
 
@@ -82,21 +84,48 @@ auto spawn_entry_point_with_completion(std::shared_ptr<spawn_state_with_completi
   co_return;
 }
 
+/// A spawned coroutine that is set up but not started yet: `start` must be posted onto `ex`.
+struct prepared_spawn {
+  any_executor ex{};
+  unique_function<void()> start{};
+};
+
 template <typename T>
-void spawn_detached_impl(spawn_context ctx, awaitable<T> a) {
+auto prepare_detached(spawn_context ctx, awaitable<T> a) -> prepared_spawn {
   auto h = a.release();
 
   init_spawned_promise(h.promise(), std::move(ctx));
   h.promise().detach();
 
-  auto exec = h.promise().get_executor();
-  exec.post([h]() mutable {
-    try {
-      h.resume();
-    } catch (...) {
-      // Detached mode: swallow exceptions
+  return prepared_spawn{h.promise().get_executor(), [h]() mutable {
+                          try {
+                            h.resume();
+                          } catch (...) {
+                            // Detached mode: swallow exceptions
+                          }
+                        }};
+}
+
+template <typename T>
+void spawn_detached_impl(spawn_context ctx, awaitable<T> a) {
+  auto p = prepare_detached(std::move(ctx), std::move(a));
+  p.ex.post(std::move(p.start));
+}
+
+/// Start prepared coroutines in order. Each run of consecutive spawns on the same executor is
+/// submitted with one `post_bulk()`.
+inline void start_spawned(std::span<prepared_spawn> spawns) {
+  std::vector<unique_function<void()>> run{};
+  run.reserve(spawns.size());
+  std::size_t i = 0;
+  while (i < spawns.size()) {
+    auto const& ex = spawns[i].ex;
+    run.clear();
+    for (; i < spawns.size() && spawns[i].ex == ex; ++i) {
+      run.push_back(std::move(spawns[i].start));
     }
-  });
+    ex.post_bulk(run);
+  }
 }
 
 template <typename T>
@@ -172,11 +201,19 @@ struct result_state_completion {
 };
 
 template <typename T, typename Factory, typename Completion>
-void spawn_task(spawn_context ctx, Factory&& factory, Completion&& completion) {
+auto prepare_spawn_task(spawn_context ctx, Factory&& factory, Completion&& completion)
+  -> prepared_spawn {
   auto state = std::make_shared<spawn_state_with_completion<T>>(
     std::forward<Factory>(factory), std::forward<Completion>(completion));
   auto entry = spawn_entry_point_with_completion<T>(std::move(state));
-  spawn_detached_impl(std::move(ctx), std::move(entry));
+  return prepare_detached(std::move(ctx), std::move(entry));
+}
+
+template <typename T, typename Factory, typename Completion>
+void spawn_task(spawn_context ctx, Factory&& factory, Completion&& completion) {
+  auto p = prepare_spawn_task<T>(std::move(ctx), std::forward<Factory>(factory),
+                                 std::forward<Completion>(completion));
+  p.ex.post(std::move(p.start));
 }
 
 /// Awaiter for retrieving the result of a spawned coroutine.
@@ -4,8 +4,12 @@
 #include <iocoro/error.hpp>
 
 #include <algorithm>
+#include <array>
+#include <bit>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
+#include <limits>
 #include <memory>
 #include <optional>
 #include <utility>
@@ -19,13 +23,41 @@ enum class timer_state : std::uint8_t {
   cancelled,
 };
 
-// NOTE: timer_registry is reactor-thread-only.
-// All accesses must be serialized by io_context_impl (reactor thread ownership).
+/// Ordering structure used by `timer_registry`.
+///
+/// - `heap`: binary min-heap keyed by expiry. O(log n) add/expire; cancelled entries stay
+///   queued until they reach the top. Exact (clock) resolution.
+/// - `wheel`: hierarchical timing wheel with 1ms ticks (4 levels x 64 slots, ~4.6h span before
+///   entries are re-cascaded). O(1) add and cancel, and cancellation unlinks the entry
+///   immediately. Expiry is rounded up to the next tick, so a timer may fire up to 1ms late
+///   (never early). Suited to large numbers of re-armed timeouts.
+enum class timer_queue_kind : std::uint8_t {
+  heap,
+  wheel,
+};
+
+// NOTE: timer_registry is not thread-safe. io_context_impl mutates it from any event-loop thread
+// under its `registry_mtx_`.
 class timer_registry {
  public:
+  explicit timer_registry(timer_queue_kind kind = timer_queue_kind::heap) noexcept
+      : kind_{kind}, origin_{std::chrono::steady_clock::now()} {
+    wheel_heads_.fill(npos);
+  }
+
+  auto kind() const noexcept -> timer_queue_kind { return kind_; }
+
   struct register_result {
     std::uint32_t index = 0;
     std::uint64_t token = invalid_token;
+    // True if the new timer is now the earliest pending expiry.
+    bool earliest = false;
+  };
+
+  // An expired or cancelled timer operation detached from the registry.
+  struct expired_op {
+    reactor_op_ptr op{};
+    bool completed = false;
   };
 
   // Token model (ABA defense):
@@ -35,26 +67,51 @@ class timer_registry {
   struct cancel_result {
     reactor_op_ptr op{};
     bool cancelled = false;
+    // True if the cancelled node stays queued until the next `take_expired()` (heap only).
+    bool deferred = false;
   };
 
   auto add_timer(std::chrono::steady_clock::time_point expiry,
                  reactor_op_ptr op) -> register_result;
   auto cancel(std::uint32_t index, std::uint64_t token) noexcept -> cancel_result;
-  auto next_timeout() -> std::optional<std::chrono::milliseconds>;
+  // Time until the earliest pending expiry, at full `steady_clock` precision.
+  auto next_timeout() -> std::optional<std::chrono::steady_clock::duration>;
+  auto next_timeout(std::chrono::steady_clock::time_point now)
+    -> std::optional<std::chrono::steady_clock::duration>;
   auto process_expired() -> std::size_t;
   auto empty() const -> bool;
+  // Number of pending timers (`empty()` iff 0).
+  auto active_count() const noexcept -> std::size_t { return active_count_; }
+
+  // Detach expired/cancelled operations into `out` without invoking callbacks.
+  //
+  // This lets io_context_impl mutate the registry under its registry lock and run the
+  // callbacks after releasing it (see `complete_expired()`).
+  void take_expired(std::vector<expired_op>& out);
+  void take_expired(std::vector<expired_op>& out, std::chrono::steady_clock::time_point now);
+
+  // Invoke callbacks for operations detached by `take_expired()` and clear `ops`.
+  // Returns the number of completed (not aborted) operations.
+  static auto complete_expired(std::vector<expired_op>& ops) noexcept -> std::size_t;
 
   // Drain all registered timer operations and clear the registry.
   //
-  // NOTE: timer_registry is reactor-thread-only; callers must ensure serialization.
+  // NOTE: callers must hold the same lock as for every other access.
   auto drain_all() noexcept -> std::vector<reactor_op_ptr>;
 
  private:
+  static constexpr std::uint32_t npos = (std::numeric_limits<std::uint32_t>::max)();
+
   struct timer_node {
     std::chrono::steady_clock::time_point expiry{};
     reactor_op_ptr op{};
     std::uint64_t token = 1;
     timer_state state{timer_state::pending};
+    // Wheel bookkeeping: absolute expiry tick and intrusive links within `wheel_heads_[list]`.
+    std::int64_t tick = 0;
+    std::uint32_t list = npos;
+    std::uint32_t prev = npos;
+    std::uint32_t next = npos;
   };
 
   auto push_heap(std::uint32_t index) -> void;
@@ -63,10 +120,37 @@ class timer_registry {
   void advance_token(timer_node& node) noexcept;
   auto recycle_node(std::uint32_t index) -> void;
 
+  // Timing wheel: level L has 64 slots of 64^L ticks each; a tick is 1ms.
+  static constexpr std::uint32_t wheel_bits = 6;
+  static constexpr std::uint32_t wheel_slots = 1U << wheel_bits;
+  static constexpr std::uint32_t wheel_levels = 4;
+  static constexpr std::int64_t wheel_span = std::int64_t{1} << (wheel_bits * wheel_levels);
+  // List index of timers that are already due (expiry tick <= current tick).
+  static constexpr std::uint32_t due_list = wheel_levels * wheel_slots;
+  static constexpr std::int64_t no_tick = (std::numeric_limits<std::int64_t>::max)();
+
+  auto to_tick_ceil(std::chrono::steady_clock::time_point t) const noexcept -> std::int64_t;
+  auto to_tick_floor(std::chrono::steady_clock::time_point t) const noexcept -> std::int64_t;
+  auto tick_time(std::int64_t tick) const noexcept -> std::chrono::steady_clock::time_point;
+
+  void wheel_insert(std::uint32_t index) noexcept;
+  void wheel_unlink(std::uint32_t index) noexcept;
+  // Earliest tick at which the wheel has to act (expire a level-0 slot or cascade a higher one).
+  auto wheel_next_tick() const noexcept -> std::int64_t;
+  void wheel_advance(std::int64_t now_tick, std::vector<expired_op>& out);
+  void wheel_expire_list(std::uint32_t list, std::vector<expired_op>& out);
+  void wheel_clear() noexcept;
+
+  timer_queue_kind kind_;
   std::vector<timer_node> nodes_{};
   std::vector<std::uint32_t> heap_{};
   std::vector<std::uint32_t> free_{};
   std::size_t active_count_ = 0;
+
+  std::chrono::steady_clock::time_point origin_;
+  std::int64_t current_tick_ = 0;
+  std::array<std::uint32_t, due_list + 1> wheel_heads_{};
+  std::array<std::uint64_t, wheel_levels> wheel_occupied_{};
 };
 
 inline auto timer_registry::add_timer(std::chrono::steady_clock::time_point expiry,
@@ -86,9 +170,17 @@ inline auto timer_registry::add_timer(std::chrono::steady_clock::time_point expi
   node.state = timer_state::pending;
   ++active_count_;
 
+  if (kind_ == timer_queue_kind::wheel) {
+    auto const before = (wheel_heads_[due_list] != npos) ? current_tick_ : wheel_next_tick();
+    node.tick = to_tick_ceil(expiry);
+    wheel_insert(index);
+    auto const after = (wheel_heads_[due_list] != npos) ? current_tick_ : wheel_next_tick();
+    return register_result{index, node.token, after < before};
+  }
+
   push_heap(index);
 
-  return register_result{index, node.token};
+  return register_result{index, node.token, top_index() == index};
 }
 
 inline auto timer_registry::cancel(std::uint32_t index,
@@ -106,41 +198,75 @@ inline auto timer_registry::cancel(std::uint32_t index,
   node.state = timer_state::cancelled;
   auto op = std::move(node.op);
   node.op = {};
-  return cancel_result{std::move(op), true};
+  if (kind_ == timer_queue_kind::wheel) {
+    // Eager removal: the slot is reusable right away and never wakes the reactor.
+    wheel_unlink(index);
+    recycle_node(index);
+    return cancel_result{std::move(op), true, false};
+  }
+  return cancel_result{std::move(op), true, true};
 }
 
-inline auto timer_registry::next_timeout() -> std::optional<std::chrono::milliseconds> {
-  if (heap_.empty()) {
-    return std::nullopt;
+inline auto timer_registry::next_timeout()
+  -> std::optional<std::chrono::steady_clock::duration> {
+  return next_timeout(std::chrono::steady_clock::now());
+}
+
+inline auto timer_registry::next_timeout(std::chrono::steady_clock::time_point now)
+  -> std::optional<std::chrono::steady_clock::duration> {
+  if (kind_ == timer_queue_kind::wheel) {
+    if (wheel_heads_[due_list] != npos) {
+      return std::chrono::steady_clock::duration::zero();
+    }
+    auto const tick = wheel_next_tick();
+    if (tick == no_tick) {
+      return std::nullopt;
+    }
+    auto const at = tick_time(tick);
+    if (at <= now) {
+      return std::chrono::steady_clock::duration::zero();
+    }
+    return at - now;
   }
 
-  auto const idx = top_index();
-  auto const& node = nodes_[idx];
-  if (node.state == timer_state::cancelled) {
-    // NOTE: Cancelled nodes are cleaned up by `process_expired()`. Returning 0 ensures the
-    // reactor wakes up promptly to drain cancelled entries instead of sleeping until the next
-    // expiry.
-    return std::chrono::milliseconds(0);
+  // Cancelled entries carry no operation (it was handed out by `cancel()`), so they can be
+  // reclaimed here instead of forcing a zero-timeout wakeup just to pop them.
+  while (!heap_.empty() && nodes_[top_index()].state == timer_state::cancelled) {
+    recycle_node(pop_heap());
+  }
+  if (heap_.empty()) {
+    return std::nullopt;
   }
 
-  auto const now = std::chrono::steady_clock::now();
+  auto const& node = nodes_[top_index()];
   if (node.expiry <= now) {
-    return std::chrono::milliseconds(0);
+    return std::chrono::steady_clock::duration::zero();
   }
-  return std::chrono::duration_cast<std::chrono::milliseconds>(node.expiry - now);
+  // Exact remaining time: truncating to milliseconds would turn the final sub-millisecond
+  // stretch before every expiry into a run of zero-timeout (busy) polls.
+  return node.expiry - now;
 }
 
 inline auto timer_registry::process_expired() -> std::size_t {
-  std::size_t count = 0;
-  struct ready_entry {
-    reactor_op_ptr op{};
-    bool completed = false;
-  };
-  std::vector<ready_entry> ready{};
-  ready.reserve(8);
+  std::vector<expired_op> ready{};
+  take_expired(ready);
+  return complete_expired(ready);
+}
+
+inline void timer_registry::take_expired(std::vector<expired_op>& out) {
+  take_expired(out, std::chrono::steady_clock::now());
+}
+
+inline void timer_registry::take_expired(std::vector<expired_op>& out,
+                                         std::chrono::steady_clock::time_point now) {
+  if (kind_ == timer_queue_kind::wheel) {
+    wheel_advance(to_tick_floor(now), out);
+    return;
+  }
+
   auto push_ready = [&](reactor_op_ptr op, bool completed) {
     if (op) {
-      ready.push_back(ready_entry{std::move(op), completed});
+      out.push_back(expired_op{std::move(op), completed});
     }
   };
 
@@ -160,7 +286,6 @@ inline auto timer_registry::process_expired() -> std::size_t {
       continue;
     }
 
-    auto const now = std::chrono::steady_clock::now();
     if (node.expiry > now) {
       break;
     }
@@ -176,10 +301,15 @@ inline auto timer_registry::process_expired() -> std::size_t {
     recycle_node(idx);
     push_ready(std::move(op), true);
   }
+}
 
+inline auto timer_registry::complete_expired(std::vector<expired_op>& ops) noexcept
+  -> std::size_t {
   // SAFETY: callbacks may re-enter the reactor (posting/cancelling timers).
-  // We therefore collect ready operations first and only invoke callbacks after registry mutation.
-  for (auto& entry : ready) {
+  // Callers therefore collect ready operations first and only invoke callbacks after registry
+  // mutation.
+  std::size_t count = 0;
+  for (auto& entry : ops) {
     if (entry.completed) {
       entry.op->vt->on_complete(entry.op->block);
       ++count;
@@ -187,7 +317,7 @@ inline auto timer_registry::process_expired() -> std::size_t {
       entry.op->vt->on_abort(entry.op->block, error::operation_aborted);
     }
   }
-
+  ops.clear();
   return count;
 }
 
@@ -250,6 +380,7 @@ inline auto timer_registry::drain_all() noexcept -> std::vector<reactor_op_ptr>
   }
 
   heap_.clear();
+  wheel_clear();
   free_.clear();
   free_.reserve(nodes_.size());
   for (std::uint32_t i = 0; i < static_cast<std::uint32_t>(nodes_.size()); ++i) {
@@ -259,4 +390,161 @@ inline auto timer_registry::drain_all() noexcept -> std::vector<reactor_op_ptr>
   return out;
 }
 
+inline auto timer_registry::to_tick_ceil(std::chrono::steady_clock::time_point t) const noexcept
+  -> std::int64_t {
+  return std::chrono::ceil<std::chrono::milliseconds>(t - origin_).count();
+}
+
+inline auto timer_registry::to_tick_floor(std::chrono::steady_clock::time_point t) const noexcept
+  -> std::int64_t {
+  return std::chrono::floor<std::chrono::milliseconds>(t - origin_).count();
+}
+
+inline auto timer_registry::tick_time(std::int64_t tick) const noexcept
+  -> std::chrono::steady_clock::time_point {
+  return origin_ + std::chrono::milliseconds{tick};
+}
+
+inline void timer_registry::wheel_insert(std::uint32_t index) noexcept {
+  auto& node = nodes_[index];
+  auto const delta = node.tick - current_tick_;
+
+  std::uint32_t list = due_list;
+  if (delta > 0) {
+    // Entries beyond the wheel span park in the farthest top-level slot and are re-placed by
+    // their real tick when that slot cascades.
+    auto const placed = current_tick_ + std::min(delta, wheel_span - 1);
+    std::uint32_t level = 0;
+    while (level + 1 < wheel_levels &&
+           (placed - current_tick_) >= (std::int64_t{1} << (wheel_bits * (level + 1)))) {
+      ++level;
+    }
+    auto const slot =
+      static_cast<std::uint32_t>((placed >> (wheel_bits * level)) & (wheel_slots - 1));
+    list = level * wheel_slots + slot;
+    wheel_occupied_[level] |= std::uint64_t{1} << slot;
+  }
+
+  node.list = list;
+  node.prev = npos;
+  node.next = wheel_heads_[list];
+  if (node.next != npos) {
+    nodes_[node.next].prev = index;
+  }
+  wheel_heads_[list] = index;
+}
+
+inline void timer_registry::wheel_unlink(std::uint32_t index) noexcept {
+  auto& node = nodes_[index];
+  auto const list = node.list;
+  if (list == npos) {
+    return;
+  }
+  if (node.prev != npos) {
+    nodes_[node.prev].next = node.next;
+  } else {
+    wheel_heads_[list] = node.next;
+  }
+  if (node.next != npos) {
+    nodes_[node.next].prev = node.prev;
+  }
+  if (list != due_list && wheel_heads_[list] == npos) {
+    wheel_occupied_[list / wheel_slots] &= ~(std::uint64_t{1} << (list % wheel_slots));
+  }
+  node.list = npos;
+  node.prev = npos;
+  node.next = npos;
+}
+
+inline auto timer_registry::wheel_next_tick() const noexcept -> std::int64_t {
+  auto best = no_tick;
+  for (std::uint32_t level = 0; level < wheel_levels; ++level) {
+    auto const mask = wheel_occupied_[level];
+    if (mask == 0) {
+      continue;
+    }
+    // First occupied slot strictly after the current position at this level (wrapping).
+    auto const shift = wheel_bits * level;
+    auto const pos = current_tick_ >> shift;
+    auto const start = static_cast<int>((pos + 1) & (wheel_slots - 1));
+    auto const k = std::countr_zero(std::rotr(mask, start)) + 1;
+    auto const tick = (pos + k) << shift;
+    best = std::min(best, tick);
+  }
+  return best;
+}
+
+inline void timer_registry::wheel_advance(std::int64_t now_tick, std::vector<expired_op>& out) {
+  wheel_expire_list(due_list, out);
+
+  while (current_tick_ < now_tick) {
+    // Jump over ticks at which no slot needs attention.
+    auto const next = wheel_next_tick();
+    if (next > now_tick) {
+      current_tick_ = now_tick;
+      break;
+    }
+    current_tick_ = next;
+
+    // Cascade every level whose lower digits just wrapped, highest first, so entries can
+    // fall through several levels in one tick.
+    std::uint32_t top = 0;
+    while (top + 1 < wheel_levels &&
+           (current_tick_ & ((std::int64_t{1} << (wheel_bits * (top + 1))) - 1)) == 0) {
+      ++top;
+    }
+    for (auto level = top; level > 0; --level) {
+      auto const slot = static_cast<std::uint32_t>((current_tick_ >> (wheel_bits * level)) &
+                                                   (wheel_slots - 1));
+      auto const list = level * wheel_slots + slot;
+      auto idx = wheel_heads_[list];
+      wheel_heads_[list] = npos;
+      wheel_occupied_[level] &= ~(std::uint64_t{1} << slot);
+      while (idx != npos) {
+        auto const next_idx = nodes_[idx].next;
+        wheel_insert(idx);
+        idx = next_idx;
+      }
+    }
+
+    wheel_expire_list(static_cast<std::uint32_t>(current_tick_ & (wheel_slots - 1)), out);
+    wheel_expire_list(due_list, out);
+  }
+}
+
+inline void timer_registry::wheel_expire_list(std::uint32_t list, std::vector<expired_op>& out) {
+  auto idx = wheel_heads_[list];
+  if (idx == npos) {
+    return;
+  }
+  wheel_heads_[list] = npos;
+  if (list != due_list) {
+    wheel_occupied_[list / wheel_slots] &= ~(std::uint64_t{1} << (list % wheel_slots));
+  }
+  while (idx != npos) {
+    auto& node = nodes_[idx];
+    auto const next_idx = node.next;
+    node.list = npos;
+    node.prev = npos;
+    node.next = npos;
+    node.state = timer_state::fired;
+    auto op = std::move(node.op);
+    recycle_node(idx);
+    if (op) {
+      out.push_back(expired_op{std::move(op), true});
+    }
+    idx = next_idx;
+  }
+}
+
+inline void timer_registry::wheel_clear() noexcept {
+  wheel_heads_.fill(npos);
+  wheel_occupied_.fill(0);
+  for (auto& node : nodes_) {
+    node.list = npos;
+    node.prev = npos;
+    node.next = npos;
+  }
+}
+
 }  // namespace iocoro::detail
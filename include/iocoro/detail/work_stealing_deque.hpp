@@ -0,0 +1,119 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+
+namespace iocoro::detail {
+
+// Bounded Chase-Lev work-stealing deque of pointers.
+//
+// Design constraints:
+// - One owner thread pushes and pops at the bottom (LIFO); other threads steal from the top.
+//   The owner's `pop()` only needs a CAS when it races a thief for the last element. LIFO keeps
+//   the owner on the hottest task, but a task that keeps re-posting itself would then run ahead
+//   of older local work forever, so the owner falls back to `take()` (FIFO) now and then. The
+//   memory orderings follow Lê et al., "Correct and Efficient Work-Stealing for Weak Memory
+//   Models" (PPoPP 2013).
+// - The ring does not grow: `push()` reports a full deque and the caller spills elsewhere. This
+//   keeps the slots at a fixed address, so no retired buffers have to be reclaimed.
+// - `steal()` returns nullptr both when the deque is empty and when it lost a race for the top
+//   element; `take()` retries until one of them holds.
+template <typename T, std::size_t Capacity>
+class work_stealing_deque {
+  static_assert(Capacity != 0 && (Capacity & (Capacity - 1)) == 0,
+                "work_stealing_deque: Capacity must be a power of two");
+
+ public:
+  static constexpr std::size_t capacity = Capacity;
+
+  work_stealing_deque() noexcept = default;
+
+  work_stealing_deque(work_stealing_deque const&) = delete;
+  auto operator=(work_stealing_deque const&) -> work_stealing_deque& = delete;
+  work_stealing_deque(work_stealing_deque&&) = delete;
+  auto operator=(work_stealing_deque&&) -> work_stealing_deque& = delete;
+
+  /// Owner only. Returns false (leaving `item` with the caller) if the deque is full.
+  auto push(T* item) noexcept -> bool {
+    auto const b = bottom_.load(std::memory_order_relaxed);
+    auto const t = top_.load(std::memory_order_acquire);
+    if (b - t >= static_cast<std::int64_t>(Capacity)) {
+      return false;
+    }
+    slot(b).store(item, std::memory_order_relaxed);
+    // A release store rather than the paper's fence: same code on x86, and visible to TSan.
+    bottom_.store(b + 1, std::memory_order_release);
+    return true;
+  }
+
+  /// Owner only. Takes the newest element, or returns nullptr if the deque is empty.
+  auto pop() noexcept -> T* {
+    auto const b = bottom_.load(std::memory_order_relaxed) - 1;
+    // Seq-cst store and load stand in for the paper's fence (again for TSan): a thief either sees
+    // the reserved bottom or the owner sees the thief's top.
+    bottom_.store(b, std::memory_order_seq_cst);
+    auto t = top_.load(std::memory_order_seq_cst);
+    if (t > b) {
+      bottom_.store(b + 1, std::memory_order_relaxed);
+      return nullptr;
+    }
+    T* item = slot(b).load(std::memory_order_relaxed);
+    if (t == b) {
+      // Last element: race the thieves for it through `top_`.
+      if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                        std::memory_order_relaxed)) {
+        item = nullptr;
+      }
+      bottom_.store(b + 1, std::memory_order_relaxed);
+    }
+    return item;
+  }
+
+  /// Any thread. Takes the oldest element.
+  auto steal() noexcept -> T* {
+    auto t = top_.load(std::memory_order_acquire);
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    auto const b = bottom_.load(std::memory_order_acquire);
+    if (t >= b) {
+      return nullptr;
+    }
+    // A stale read here (the slot being reused by the owner) is discarded by the failing CAS.
+    T* item = slot(t).load(std::memory_order_relaxed);
+    if (!top_.compare_exchange_strong(t, t + 1, std::memory_order_seq_cst,
+                                      std::memory_order_relaxed)) {
+      return nullptr;
+    }
+    return item;
+  }
+
+  /// Any thread. Like `steal()`, but only returns nullptr once the deque was seen empty.
+  auto take() noexcept -> T* {
+    while (true) {
+      if (T* item = steal()) {
+        return item;
+      }
+      if (empty()) {
+        return nullptr;
+      }
+    }
+  }
+
+  /// Any thread; a snapshot that may be stale by the time it returns.
+  auto empty() const noexcept -> bool {
+    auto const t = top_.load(std::memory_order_seq_cst);
+    auto const b = bottom_.load(std::memory_order_seq_cst);
+    return b <= t;
+  }
+
+ private:
+  auto slot(std::int64_t i) noexcept -> std::atomic<T*>& {
+    return slots_[static_cast<std::size_t>(i) & (Capacity - 1)];
+  }
+
+  alignas(64) std::atomic<std::int64_t> top_{0};
+  alignas(64) std::atomic<std::int64_t> bottom_{0};
+  alignas(64) std::atomic<T*> slots_[Capacity]{};
+};
+
+}  // namespace iocoro::detail
@@ -1,17 +1,23 @@
 #include <iocoro/detail/reactor_backend.hpp>
 #include <iocoro/detail/scope_guard.hpp>
 #include <iocoro/detail/wake_state.hpp>
-#include <iocoro/error.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cerrno>
+#include <chrono>
 #include <cstdint>
+#include <ctime>
+#include <limits>
 #include <memory>
 #include <system_error>
+#include <vector>
 
 #include <sys/epoll.h>
 #include <sys/eventfd.h>
 #include <sys/resource.h>
+#include <sys/syscall.h>
+#include <sys/timerfd.h>
 #include <unistd.h>
 
 namespace iocoro::detail {
@@ -52,11 +58,30 @@ void drain_eventfd(int eventfd) noexcept {
   }
 }
 
+auto to_timespec(std::chrono::steady_clock::duration d) noexcept -> timespec {
+  auto const ns = std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
+  timespec ts{};
+  ts.tv_sec = static_cast<std::time_t>(ns / 1'000'000'000);
+  ts.tv_nsec = static_cast<long>(ns % 1'000'000'000);
+  return ts;
+}
+
+// `epoll_wait` timeout in whole milliseconds, rounded up so it never returns before `d`.
+auto to_timeout_ms(std::chrono::steady_clock::duration d) noexcept -> int {
+  auto const ms = std::chrono::ceil<std::chrono::milliseconds>(d).count();
+  return static_cast<int>(
+    std::min<long long>(ms, static_cast<long long>(std::numeric_limits<int>::max())));
+}
+
 }  // namespace
 
 class backend_epoll final : public backend_interface {
  public:
-  backend_epoll() {
+  explicit backend_epoll(backend_options const& opts)
+      : max_events_limit_(std::max<std::size_t>(opts.max_events_limit, opts.max_events)) {
+    events_.resize(std::clamp<std::size_t>(opts.max_events, 1, max_events_cap));
+    max_events_limit_ = std::clamp<std::size_t>(max_events_limit_, 1, max_events_cap);
+
     epoll_fd_ = ::epoll_create1(EPOLL_CLOEXEC);
     if (epoll_fd_ < 0) {
       throw std::system_error(errno, std::generic_category(), "epoll_create1 failed");
@@ -84,17 +109,20 @@ class backend_epoll final : public backend_interface {
       cap = static_cast<std::size_t>(lim.rlim_cur);
     }
     fd_capacity_ = cap;
-    fd_generations_ = std::make_unique<std::atomic<std::uint32_t>[]>(fd_capacity_);
-    fd_active_ = std::make_unique<std::atomic<std::uint8_t>[]>(fd_capacity_);
-    for (std::size_t i = 0; i < fd_capacity_; ++i) {
-      fd_generations_[i].store(0, std::memory_order_relaxed);
-      fd_active_[i].store(0, std::memory_order_relaxed);
+    // Only the directory is sized to the limit; tag chunks are allocated on first use.
+    fd_chunks_ = std::make_unique<std::atomic<fd_chunk*>[]>(chunk_count());
+    for (std::size_t i = 0; i < chunk_count(); ++i) {
+      fd_chunks_[i].store(nullptr, std::memory_order_relaxed);
     }
   }
 
   ~backend_epoll() override {
+    close_if_valid(timerfd_);
     close_if_valid(eventfd_);
     close_if_valid(epoll_fd_);
+    for (std::size_t i = 0; i < chunk_count(); ++i) {
+      delete fd_chunks_[i].load(std::memory_order_relaxed);
+    }
   }
 
   void add_fd(int fd) override {
@@ -103,12 +131,10 @@ class backend_epoll final : public backend_interface {
                               "epoll add_fd: fd out of range");
     }
 
-    std::uint32_t gen = 1;
-    gen = fd_generations_[fd].fetch_add(1, std::memory_order_acq_rel) + 1;
-    if (gen == 0) {
-      gen = fd_generations_[fd].fetch_add(1, std::memory_order_acq_rel) + 1;
-    }
-    fd_active_[fd].store(1, std::memory_order_release);
+    // Bump the generation and set the active bit in one step.
+    auto& tag = tag_for(fd);
+    std::uint32_t const gen = (tag.load(std::memory_order_relaxed) | 1U) + 2U;
+    tag.store(gen, std::memory_order_release);
 
     std::uint32_t events =
       static_cast<std::uint32_t>(EPOLLET | EPOLLIN | EPOLLOUT | EPOLLERR | EPOLLHUP | EPOLLRDHUP);
@@ -134,25 +160,17 @@ class backend_epoll final : public backend_interface {
     if (epoll_fd_ < 0 || fd < 0) {
       return;
     }
-    if (static_cast<std::size_t>(fd) < fd_capacity_) {
-      fd_active_[fd].store(0, std::memory_order_release);
+    if (auto* tag = find_tag(fd)) {
+      tag->fetch_and(~1U, std::memory_order_release);
     }
     ::epoll_ctl(epoll_fd_, EPOLL_CTL_DEL, fd, nullptr);
   }
 
-  auto wait(std::optional<std::chrono::milliseconds> timeout,
+  auto wait(std::optional<std::chrono::steady_clock::duration> timeout,
             std::vector<backend_event>& out) -> void override {
     auto wait_guard = detail::make_scope_exit([this]() noexcept { wakeup_.finish_wait(); });
 
-    int timeout_ms = -1;
-    if (timeout.has_value()) {
-      timeout_ms = static_cast<int>(timeout->count());
-    }
-
-    constexpr int max_events = 128;
-    epoll_event events[max_events]{};
-
-    int nfds = ::epoll_wait(epoll_fd_, events, max_events, timeout_ms);
+    int const nfds = wait_events(timeout, events_.data(), static_cast<int>(events_.size()));
     if (nfds < 0) {
       if (errno == EINTR) {
         return;
@@ -164,24 +182,25 @@ class backend_epoll final : public backend_interface {
     out.reserve(static_cast<std::size_t>(nfds));
 
     for (int i = 0; i < nfds; ++i) {
-      std::uint64_t const data = events[i].data.u64;
+      std::uint64_t const data = events_[i].data.u64;
       int const fd = unpack_fd(data);
       std::uint32_t const gen = unpack_gen(data);
-      std::uint32_t const ev = events[i].events;
+      std::uint32_t const ev = events_[i].events;
 
       if (fd == eventfd_) {
         drain_eventfd(eventfd_);
         wakeup_.consume_notification();
         continue;
       }
-
-      if (fd < 0 || static_cast<std::size_t>(fd) >= fd_capacity_) {
-        continue;
-      }
-      if (fd_active_[fd].load(std::memory_order_acquire) == 0) {
+      if (fd == timerfd_) {
+        // Sub-millisecond timeout fallback fired; the caller re-checks timers on return.
+        drain_eventfd(timerfd_);
         continue;
       }
-      if (fd_generations_[fd].load(std::memory_order_acquire) != gen) {
+
+      // A removed fd has its active bit cleared, so it can never match the event's tag.
+      auto const* tag = find_tag(fd);
+      if (tag == nullptr || tag->load(std::memory_order_acquire) != gen) {
         continue;
       }
 
@@ -199,14 +218,13 @@ class backend_epoll final : public backend_interface {
       e.can_read = has_error || has_hup || has_read;
       e.can_write = has_error || has_hup || has_write;
 
-      if (has_error) {
-        e.ec = error::connection_reset;
-      }
-
       out.push_back(e);
     }
 
-    return;
+    // A full batch means more events were probably left pending: fetch more next time.
+    if (static_cast<std::size_t>(nfds) == events_.size() && events_.size() < max_events_limit_) {
+      events_.resize(std::min(events_.size() * 2, max_events_limit_));
+    }
   }
 
   void prepare_wait() noexcept override { wakeup_.begin_wait(); }
@@ -231,16 +249,124 @@ class backend_epoll final : public backend_interface {
   }
 
  private:
+  // Timeout precision:
+  // - Empty, zero and whole-millisecond timeouts use plain `epoll_wait`.
+  // - Anything finer uses `epoll_pwait2` (Linux 5.11+), which takes a timespec.
+  // - If the kernel (or a seccomp filter) rejects `epoll_pwait2`, a one-shot timerfd registered
+  //   with the epoll set carries the exact deadline instead; `epoll_wait` keeps a rounded-up
+  //   millisecond timeout as a backstop. A timerfd left armed by an earlier wait can only cause
+  //   one spurious empty return.
+  auto wait_events(std::optional<std::chrono::steady_clock::duration> timeout,
+                   epoll_event* events, int max_events) -> int {
+    if (!timeout.has_value()) {
+      return ::epoll_wait(epoll_fd_, events, max_events, -1);
+    }
+    if (*timeout <= std::chrono::steady_clock::duration::zero()) {
+      return ::epoll_wait(epoll_fd_, events, max_events, 0);
+    }
+    if (*timeout % std::chrono::milliseconds{1} == std::chrono::steady_clock::duration::zero()) {
+      return ::epoll_wait(epoll_fd_, events, max_events, to_timeout_ms(*timeout));
+    }
+
+#if defined(SYS_epoll_pwait2)
+    if (has_pwait2_) {
+      auto const ts = to_timespec(*timeout);
+      auto const n = ::syscall(SYS_epoll_pwait2, epoll_fd_, events, max_events, &ts, nullptr, 0);
+      if (n >= 0 || (errno != ENOSYS && errno != EPERM)) {
+        return static_cast<int>(n);
+      }
+      has_pwait2_ = false;
+    }
+#endif
+
+    // Without a timerfd the rounded-up timeout alone applies.
+    (void)arm_timerfd(*timeout);
+    return ::epoll_wait(epoll_fd_, events, max_events, to_timeout_ms(*timeout));
+  }
+
+  auto arm_timerfd(std::chrono::steady_clock::duration timeout) noexcept -> bool {
+    if (timerfd_ < 0) {
+      if (timerfd_failed_) {
+        return false;
+      }
+      timerfd_ = ::timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC);
+      if (timerfd_ < 0) {
+        timerfd_failed_ = true;
+        return false;
+      }
+      epoll_event ev{};
+      ev.events = EPOLLIN | EPOLLET;
+      ev.data.u64 = pack_fd_gen(timerfd_, 0);
+      if (::epoll_ctl(epoll_fd_, EPOLL_CTL_ADD, timerfd_, &ev) < 0) {
+        close_if_valid(timerfd_);
+        timerfd_failed_ = true;
+        return false;
+      }
+    }
+    itimerspec spec{};
+    spec.it_value = to_timespec(timeout);
+    return ::timerfd_settime(timerfd_, 0, &spec, nullptr) == 0;
+  }
+
+  // Per-fd registration tag: generation in the upper 31 bits, "active" in bit 0. The tag is
+  // the 32 bits carried by each epoll event, so one compare filters removed and reused fds.
+  //
+  // Tags live in fixed-size chunks behind a directory sized to RLIMIT_NOFILE (a two-level
+  // table): memory follows the fds actually registered rather than the limit. Chunks are never
+  // freed before the backend, so a published chunk pointer stays valid for lock-free readers.
+  static constexpr std::size_t fd_chunk_shift = 12;
+  static constexpr std::size_t fd_chunk_size = std::size_t{1} << fd_chunk_shift;
+
+  struct fd_chunk {
+    std::atomic<std::uint32_t> tags[fd_chunk_size]{};
+  };
+
+  auto chunk_count() const noexcept -> std::size_t {
+    return (fd_capacity_ + fd_chunk_size - 1) >> fd_chunk_shift;
+  }
+
+  auto find_tag(int fd) const noexcept -> std::atomic<std::uint32_t>* {
+    if (fd < 0 || static_cast<std::size_t>(fd) >= fd_capacity_) {
+      return nullptr;
+    }
+    auto const i = static_cast<std::size_t>(fd);
+    auto* chunk = fd_chunks_[i >> fd_chunk_shift].load(std::memory_order_acquire);
+    return chunk == nullptr ? nullptr : &chunk->tags[i & (fd_chunk_size - 1)];
+  }
+
+  // `fd` must be in range. Allocates its chunk on first use (racing adders agree via CAS).
+  auto tag_for(int fd) -> std::atomic<std::uint32_t>& {
+    auto const i = static_cast<std::size_t>(fd);
+    auto& slot = fd_chunks_[i >> fd_chunk_shift];
+    auto* chunk = slot.load(std::memory_order_acquire);
+    if (chunk == nullptr) {
+      auto fresh = std::make_unique<fd_chunk>();
+      if (slot.compare_exchange_strong(chunk, fresh.get(), std::memory_order_acq_rel,
+                                       std::memory_order_acquire)) {
+        chunk = fresh.release();
+      }
+    }
+    return chunk->tags[i & (fd_chunk_size - 1)];
+  }
+
+  // epoll_wait() takes an int count; also keeps a misconfigured buffer within reason.
+  static constexpr std::size_t max_events_cap = std::size_t{1} << 20;
+
+  std::vector<epoll_event> events_{};
+  std::size_t max_events_limit_;
+
   int epoll_fd_ = -1;
   int eventfd_ = -1;
+  int timerfd_ = -1;
+  bool has_pwait2_ = true;
+  bool timerfd_failed_ = false;
   std::size_t fd_capacity_ = 0;
-  std::unique_ptr<std::atomic<std::uint32_t>[]> fd_generations_{};
-  std::unique_ptr<std::atomic<std::uint8_t>[]> fd_active_{};
+  std::unique_ptr<std::atomic<fd_chunk*>[]> fd_chunks_{};
   wake_state wakeup_{};
 };
 
-inline auto make_backend() -> std::unique_ptr<backend_interface> {
-  return std::make_unique<backend_epoll>();
+inline auto make_backend(backend_options const& opts) -> std::unique_ptr<backend_interface> {
+  return std::make_unique<backend_epoll>(opts);
 }
 
 }  // namespace iocoro::detail
@@ -1,19 +1,25 @@
 #include <iocoro/detail/reactor_backend.hpp>
 #include <iocoro/detail/scope_guard.hpp>
 #include <iocoro/detail/wake_state.hpp>
-#include <iocoro/error.hpp>
 
+#include <algorithm>
 #include <atomic>
 #include <cerrno>
+#include <chrono>
+#include <cstddef>
 #include <cstdint>
-#include <limits>
+#include <memory>
 #include <mutex>
+#include <optional>
+#include <span>
 #include <system_error>
-#include <unordered_map>
+#include <thread>
+#include <vector>
 
 #include <liburing.h>
 #include <poll.h>
 #include <sys/eventfd.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 namespace iocoro::detail {
@@ -23,6 +29,8 @@ namespace {
 constexpr std::uint64_t tag_poll = 0;
 constexpr std::uint64_t tag_wakeup = 1;
 constexpr std::uint64_t tag_remove = 2;
+// Completion-model operation; the remaining bits carry the operation id (see `op_slot`).
+constexpr std::uint64_t tag_op = 3;
 
 constexpr std::uint64_t fd_shift = 2;
 constexpr std::uint64_t gen_shift = 34;
@@ -42,6 +50,117 @@ auto unpack_gen(std::uint64_t data) noexcept -> std::uint32_t {
   return static_cast<std::uint32_t>(data >> gen_shift);
 }
 
+auto pack_op(std::uint64_t id) noexcept -> std::uint64_t {
+  return (id << fd_shift) | tag_op;
+}
+auto unpack_op(std::uint64_t data) noexcept -> std::uint64_t {
+  return data >> fd_shift;
+}
+
+// Buffer group of the provided-buffer ring used by multishot receives.
+constexpr unsigned short buf_group_id = 0;
+
+// Size of the sparse registered-file table; sockets beyond it keep using plain fds.
+constexpr unsigned fixed_file_slots = 4096;
+
+void prep_io(io_uring_sqe* sqe, io_request const& req) noexcept {
+  switch (req.op) {
+    case io_request::opcode::recv:
+      ::io_uring_prep_recv(sqe, req.fd, req.data, req.size, req.flags);
+      break;
+    case io_request::opcode::send:
+      ::io_uring_prep_send(sqe, req.fd, req.data, req.size, req.flags);
+      break;
+    case io_request::opcode::accept:
+      ::io_uring_prep_accept(sqe, req.fd, req.addr, req.addr_len, req.flags);
+      break;
+    case io_request::opcode::connect:
+      ::io_uring_prep_connect(sqe, req.fd, req.addr, req.connect_len);
+      break;
+    case io_request::opcode::recvmsg:
+      ::io_uring_prep_recvmsg(sqe, req.fd, req.msg, static_cast<unsigned>(req.flags));
+      break;
+    case io_request::opcode::sendmsg:
+      ::io_uring_prep_sendmsg(sqe, req.fd, req.msg, static_cast<unsigned>(req.flags));
+      break;
+    case io_request::opcode::accept_multishot:
+      ::io_uring_prep_multishot_accept(sqe, req.fd, req.addr, req.addr_len, req.flags);
+      break;
+    case io_request::opcode::recv_multishot:
+      ::io_uring_prep_recv_multishot(sqe, req.fd, nullptr, 0, req.flags);
+      sqe->flags |= IOSQE_BUFFER_SELECT;
+      sqe->buf_group = buf_group_id;
+      break;
+    // Offset -1: sockets have no file position.
+    case io_request::opcode::read_fixed:
+      ::io_uring_prep_read_fixed(sqe, req.fd, req.data, static_cast<unsigned>(req.size),
+                                 static_cast<__u64>(-1), req.buf_index);
+      break;
+    case io_request::opcode::write_fixed:
+      ::io_uring_prep_write_fixed(sqe, req.fd, req.data, static_cast<unsigned>(req.size),
+                                  static_cast<__u64>(-1), req.buf_index);
+      break;
+    case io_request::opcode::send_zc:
+      ::io_uring_prep_send_zc(sqe, req.fd, req.data, req.size, req.flags, 0);
+      break;
+    case io_request::opcode::splice: {
+      // `fd` may be either end, so the registered slot is applied here: IOSQE_FIXED_FILE
+      // covers the destination, SPLICE_F_FD_IN_FIXED the source.
+      bool const fixed = req.fixed_file >= 0;
+      auto const self = fixed ? req.fixed_file : req.fd;
+      auto flags = static_cast<unsigned>(req.flags);
+      int in = req.splice_in;
+      int out = req.splice_out;
+      if (in < 0) {
+        in = self;
+        flags |= fixed ? SPLICE_F_FD_IN_FIXED : 0U;
+      }
+      if (out < 0) {
+        out = self;
+      }
+      ::io_uring_prep_splice(sqe, in, req.splice_in_offset, out, -1,
+                             static_cast<unsigned>(req.size), flags);
+      if (fixed && req.splice_out < 0) {
+        sqe->flags |= IOSQE_FIXED_FILE;
+      }
+      return;
+    }
+  }
+  if (req.fixed_file >= 0) {
+    sqe->fd = req.fixed_file;
+    sqe->flags |= IOSQE_FIXED_FILE;
+  }
+}
+
+// The io_uring opcode behind a request kind (the probe is indexed by these).
+auto kernel_opcode(io_request::opcode op) noexcept -> int {
+  switch (op) {
+    case io_request::opcode::recv:
+    case io_request::opcode::recv_multishot:
+      return IORING_OP_RECV;
+    case io_request::opcode::send:
+      return IORING_OP_SEND;
+    case io_request::opcode::accept:
+    case io_request::opcode::accept_multishot:
+      return IORING_OP_ACCEPT;
+    case io_request::opcode::connect:
+      return IORING_OP_CONNECT;
+    case io_request::opcode::recvmsg:
+      return IORING_OP_RECVMSG;
+    case io_request::opcode::sendmsg:
+      return IORING_OP_SENDMSG;
+    case io_request::opcode::read_fixed:
+      return IORING_OP_READ_FIXED;
+    case io_request::opcode::write_fixed:
+      return IORING_OP_WRITE_FIXED;
+    case io_request::opcode::send_zc:
+      return IORING_OP_SEND_ZC;
+    case io_request::opcode::splice:
+      return IORING_OP_SPLICE;
+  }
+  return IORING_OP_NOP;
+}
+
 void close_if_valid(int& fd) noexcept {
   if (fd >= 0) {
     ::close(fd);
@@ -63,12 +182,11 @@ void drain_eventfd(int eventfd) noexcept {
   }
 }
 
-auto to_timespec(std::chrono::milliseconds ms) noexcept -> __kernel_timespec {
-  auto const clamped =
-    std::min<long long>(ms.count(), static_cast<long long>(std::numeric_limits<int>::max()));
+auto to_timespec(std::chrono::steady_clock::duration d) noexcept -> __kernel_timespec {
+  auto const ns = std::chrono::duration_cast<std::chrono::nanoseconds>(d).count();
   __kernel_timespec ts{};
-  ts.tv_sec = static_cast<__kernel_time64_t>(clamped / 1000);
-  ts.tv_nsec = static_cast<long>(static_cast<long long>(clamped % 1000) * 1000LL * 1000LL);
+  ts.tv_sec = static_cast<__kernel_time64_t>(ns / 1'000'000'000);
+  ts.tv_nsec = static_cast<long long>(ns % 1'000'000'000);
   return ts;
 }
 
@@ -76,10 +194,47 @@ auto to_timespec(std::chrono::milliseconds ms) noexcept -> __kernel_timespec {
 
 class backend_uring final : public backend_interface {
  public:
-  backend_uring() {
-    int const ret = ::io_uring_queue_init(256, &ring_, 0);
+  explicit backend_uring(backend_options const& opts) {
+    unsigned flags = 0;
+    if (opts.sqpoll) {
+      flags |= IORING_SETUP_SQPOLL;
+      if (opts.sqpoll_cpu >= 0) {
+        flags |= IORING_SETUP_SQ_AFF;
+      }
+    }
+    if (opts.single_issuer || opts.defer_taskrun) {
+      // Started disabled so that the issuer is the thread that first runs the loop (see
+      // `wait()`), not the one constructing the io_context.
+      flags |= IORING_SETUP_SINGLE_ISSUER | IORING_SETUP_R_DISABLED;
+    }
+    if (opts.defer_taskrun) {
+      flags |= IORING_SETUP_DEFER_TASKRUN;
+    }
+    if (opts.coop_taskrun) {
+      flags |= IORING_SETUP_COOP_TASKRUN;
+    }
+    auto setup = [&] {
+      io_uring_params params{};
+      params.flags = flags;
+      params.sq_thread_idle = static_cast<unsigned>(opts.sqpoll_idle.count());
+      params.sq_thread_cpu = static_cast<unsigned>(std::max(opts.sqpoll_cpu, 0));
+      return ::io_uring_queue_init_params(opts.queue_depth, &ring_, &params);
+    };
+    int ret = setup();
+    // The issuer and task-run flags only change where completion work runs. A kernel that does
+    // not know them (COOP_TASKRUN 5.19, SINGLE_ISSUER 6.0, DEFER_TASKRUN 6.1), or cannot combine
+    // them with SQPOLL, fails the setup with -EINVAL: retry without the task-run flags, then
+    // without the single issuer.
+    for (unsigned const hint : {IORING_SETUP_DEFER_TASKRUN | IORING_SETUP_COOP_TASKRUN,
+                                IORING_SETUP_SINGLE_ISSUER | IORING_SETUP_R_DISABLED}) {
+      if (ret == -EINVAL && (flags & hint) != 0) {
+        flags &= ~hint;
+        ret = setup();
+      }
+    }
+    single_issuer_ = (flags & IORING_SETUP_SINGLE_ISSUER) != 0;
     if (ret < 0) {
-      throw std::system_error(-ret, std::generic_category(), "io_uring_queue_init failed");
+      throw std::system_error(-ret, std::generic_category(), "io_uring_queue_init_params failed");
     }
 
     eventfd_ = ::eventfd(0, EFD_NONBLOCK | EFD_CLOEXEC);
@@ -88,20 +243,60 @@ class backend_uring final : public backend_interface {
       throw std::system_error(errno, std::generic_category(), "eventfd failed");
     }
 
+    // Completion-model I/O needs every socket opcode plus async cancel; older kernels keep the
+    // readiness (poll) emulation only. Past that, each request kind is used exactly when the
+    // kernel reports its opcode (SEND_ZC needs 6.0, for instance).
+    if (auto* probe = ::io_uring_get_probe_ring(&ring_); probe != nullptr) {
+      supports_io_ = true;
+      for (int op : {IORING_OP_RECV, IORING_OP_SEND, IORING_OP_ACCEPT, IORING_OP_CONNECT,
+                     IORING_OP_RECVMSG, IORING_OP_SENDMSG, IORING_OP_ASYNC_CANCEL}) {
+        if (::io_uring_opcode_supported(probe, op) == 0) {
+          supports_io_ = false;
+        }
+      }
+      for (auto op = 0U; op <= static_cast<unsigned>(io_request::opcode::splice); ++op) {
+        auto const kind = static_cast<io_request::opcode>(op);
+        if (supports_io_ && ::io_uring_opcode_supported(probe, kernel_opcode(kind)) != 0) {
+          io_ops_ |= 1U << op;
+        }
+      }
+      ::io_uring_free_probe(probe);
+    }
+    // Sparse tables need 5.19; older kernels simply run without registered files.
+    if (supports_io_ && ::io_uring_register_files_sparse(&ring_, fixed_file_slots) == 0) {
+      free_file_slots_.reserve(fixed_file_slots);
+      for (auto slot = static_cast<std::int32_t>(fixed_file_slots); slot-- > 0;) {
+        free_file_slots_.push_back(slot);
+      }
+    }
+
     arm_wakeup();
   }
 
   ~backend_uring() override {
     close_if_valid(eventfd_);
+#if defined(IOCORO_URING_BUF_RING)
+    if (buf_ring_ != nullptr) {
+      ::io_uring_free_buf_ring(&ring_, buf_ring_, provided_buffer_count, buf_group_id);
+    }
+#endif
     ::io_uring_queue_exit(&ring_);
   }
 
   void add_fd(int fd) override {
     int constexpr mask = POLLIN | POLLOUT | POLLERR | POLLHUP | POLLRDHUP;
+    if (fd < 0) {
+      throw std::system_error(std::make_error_code(std::errc::invalid_argument),
+                              "uring add_fd: negative fd");
+    }
 
     {
       std::scoped_lock lk{poll_mtx_};
-      auto& st = polls_[fd];
+      auto const index = static_cast<std::size_t>(fd);
+      if (index >= polls_.size()) {
+        polls_.resize(std::max(index + 1, polls_.size() * 2));
+      }
+      auto& st = polls_[index];
       st.desired_mask = mask;
 
       if (st.armed) {
@@ -127,15 +322,14 @@ class backend_uring final : public backend_interface {
   void remove_fd(int fd) noexcept override {
     {
       std::scoped_lock lk{poll_mtx_};
-      auto it = polls_.find(fd);
-      if (it == polls_.end()) {
+      auto* st_ptr = find_poll(fd);
+      if (st_ptr == nullptr) {
         return;
       }
 
-      auto& st = it->second;
+      auto& st = *st_ptr;
       st.desired_mask = 0;
       if (!st.armed) {
-        polls_.erase(it);
         return;
       }
 
@@ -147,30 +341,43 @@ class backend_uring final : public backend_interface {
     wakeup();
   }
 
-  auto wait(std::optional<std::chrono::milliseconds> timeout,
+  auto wait(std::optional<std::chrono::steady_clock::duration> timeout,
             std::vector<backend_event>& out) -> void override {
     out.clear();
     auto wait_guard = detail::make_scope_exit([this]() noexcept { wakeup_.finish_wait(); });
 
-    // Drain any interest updates recorded by other threads.
-    // These are submitted by the reactor thread to avoid concurrent ring access.
+    if (single_issuer_) {
+      enable_for_this_thread();
+    }
+
+    // Turn the updates recorded since the last turn (by any thread) into SQEs. Only the thread
+    // inside wait() touches the submission queue; everything queued here reaches the kernel
+    // together with the wait itself, in a single io_uring_enter().
     flush_pending_updates();
+    if (!completed_.empty()) {
+      // Requests cancelled before submission are already complete; do not block on them.
+      timeout = std::chrono::steady_clock::duration::zero();
+    }
 
     io_uring_cqe* first = nullptr;
     int wait_ret = 0;
 
     if (timeout.has_value()) {
       auto ts = to_timespec(*timeout);
-      wait_ret = ::io_uring_wait_cqe_timeout(&ring_, &first, &ts);
+      wait_ret = ::io_uring_submit_and_wait_timeout(&ring_, &first, 1, &ts, nullptr);
     } else {
-      wait_ret = ::io_uring_wait_cqe(&ring_, &first);
+      wait_ret = ::io_uring_submit_and_wait_timeout(&ring_, &first, 1, nullptr, nullptr);
     }
 
     if (wait_ret < 0) {
       if (wait_ret == -EINTR || wait_ret == -EAGAIN || wait_ret == -ETIME) {
         return;
       }
-      throw std::system_error(-wait_ret, std::generic_category(), "io_uring_wait_cqe failed");
+      throw std::system_error(-wait_ret, std::generic_category(),
+                              "io_uring_submit_and_wait_timeout failed");
+    }
+    if (first == nullptr) {
+      return;
     }
 
     std::vector<pending_add> local_arms{};
@@ -199,15 +406,183 @@ class backend_uring final : public backend_interface {
     }
 
     for (auto const& arm : local_arms) {
-      submit_poll_add(arm.fd, arm.mask, arm.user_data);
+      prep_poll_add(arm.fd, arm.mask, arm.user_data);
     }
 
-    // Apply any interest updates that arrived while we were handling CQEs.
+    // Queue interest updates that arrived while we were handling CQEs; the next wait() submits
+    // them along with the re-arms above.
     flush_pending_updates();
   }
 
   void prepare_wait() noexcept override { wakeup_.begin_wait(); }
 
+  auto single_issuer() const noexcept -> bool override { return single_issuer_; }
+
+  auto supports_io() const noexcept -> bool override { return supports_io_; }
+
+  auto supports_io_op(io_request::opcode op) const noexcept -> bool override {
+    return (io_ops_ & (1U << static_cast<unsigned>(op))) != 0;
+  }
+
+  auto submit_io(io_request const& req, reactor_op_ptr op) -> std::uint64_t override {
+    std::uint64_t id = 0;
+    {
+      std::scoped_lock lk{ops_mtx_};
+      // Everything that may allocate happens first: on failure `op` is still the caller's.
+      reserve_pending_io();
+      auto& slot = slots_[acquire_slot()];
+      slot.op = std::move(op);
+      slot.result = req.result;
+      id = slot_id(slot);
+      pending_ios_.push_back(pending_io{id, req});
+    }
+    // No-op unless the reactor is blocked; otherwise the next wait() submits the request.
+    wakeup();
+    return id;
+  }
+
+  // Multishot accept and receive come with the same kernels as the one-shot opcodes; a kernel
+  // that lacks them rejects the first request with -EINVAL.
+  auto supports_multishot() const noexcept -> bool override { return supports_io_; }
+
+  auto submit_multishot(io_request const& req, std::shared_ptr<io_stream_sink> sink)
+    -> std::uint64_t override {
+    std::uint64_t id = 0;
+    {
+      std::scoped_lock lk{ops_mtx_};
+      reserve_pending_io();
+      auto& slot = slots_[acquire_slot()];
+      slot.sink = std::move(sink);
+      id = slot_id(slot);
+      pending_ios_.push_back(pending_io{id, req});
+    }
+    wakeup();
+    return id;
+  }
+
+  auto provided_buffer(std::uint32_t id) noexcept -> std::span<std::byte> override {
+    return {buf_storage_.get() + std::size_t{id} * provided_buffer_size, provided_buffer_size};
+  }
+
+  void recycle_buffer(std::uint32_t id) noexcept override {
+    std::scoped_lock lk{buf_mtx_};
+    ::io_uring_buf_ring_add(buf_ring_, provided_buffer(id).data(), provided_buffer_size,
+                            static_cast<unsigned short>(id),
+                            ::io_uring_buf_ring_mask(provided_buffer_count), 0);
+    ::io_uring_buf_ring_advance(buf_ring_, 1);
+  }
+
+  // Slots are only recycled once their socket is gone, so no queued SQE can name a reused slot.
+  //
+  // With a single issuer, only the loop thread may call io_uring_register(): table updates are
+  // then queued and applied by the next `wait()`, ahead of the requests naming the slot.
+  auto register_file(int fd) noexcept -> std::int32_t override {
+    std::scoped_lock lk{register_mtx_};
+    if (free_file_slots_.empty()) {
+      return -1;
+    }
+    auto const slot = free_file_slots_.back();
+    if (single_issuer_) {
+      try {
+        pending_files_.push_back(pending_file{slot, fd});
+      } catch (...) {
+        return -1;
+      }
+    } else if (::io_uring_register_files_update(&ring_, static_cast<unsigned>(slot), &fd, 1) !=
+               1) {
+      return -1;
+    }
+    free_file_slots_.pop_back();
+    return slot;
+  }
+
+  void unregister_file(std::int32_t slot) noexcept override {
+    {
+      std::scoped_lock lk{register_mtx_};
+      if (!single_issuer_) {
+        int const none = -1;
+        // In-flight requests hold their own file reference; clearing the slot cannot affect
+        // them.
+        (void)::io_uring_register_files_update(&ring_, static_cast<unsigned>(slot), &none, 1);
+        free_file_slots_.push_back(slot);
+        return;
+      }
+      try {
+        pending_files_.push_back(pending_file{slot, -1});
+      } catch (...) {
+        // Leak the slot rather than reuse one the table may still map.
+        return;
+      }
+    }
+    // The table entry keeps the socket open: clear it promptly.
+    wakeup();
+  }
+
+  auto register_buffers(std::span<std::span<std::byte> const> buffers) -> int override {
+    std::vector<iovec> iov{};
+    iov.reserve(buffers.size());
+    for (auto const& b : buffers) {
+      iov.push_back(iovec{b.data(), b.size()});
+    }
+    std::scoped_lock lk{register_mtx_};
+    if (int const ret = ::io_uring_unregister_buffers(&ring_); ret < 0 && ret != -ENXIO) {
+      return ret;
+    }
+    if (iov.empty()) {
+      return 0;
+    }
+    return ::io_uring_register_buffers(&ring_, iov.data(), static_cast<unsigned>(iov.size()));
+  }
+
+  void cancel_io(std::uint64_t id) noexcept override {
+    {
+      std::scoped_lock lk{ops_mtx_};
+      if (find_slot(id) == nullptr) {
+        return;
+      }
+      try {
+        pending_cancels_.push_back(id);
+      } catch (...) {
+        return;
+      }
+    }
+    wakeup();
+  }
+
+  void take_completions(std::vector<reactor_op_ptr>& out) override {
+    for (auto& op : completed_) {
+      out.push_back(std::move(op));
+    }
+    completed_.clear();
+  }
+
+  void drain_io(std::vector<reactor_op_ptr>& out) noexcept override {
+    take_completions(out);
+    // One slot at a time: sinks are called without the lock (they may cancel their request).
+    for (std::size_t index = 0;; ++index) {
+      std::shared_ptr<io_stream_sink> sink{};
+      {
+        std::scoped_lock lk{ops_mtx_};
+        if (index >= slots_.size()) {
+          break;
+        }
+        auto& slot = slots_[index];
+        if (!slot.in_use) {
+          continue;
+        }
+        if (slot.sink) {
+          sink = std::move(slot.sink);
+        } else {
+          out.push_back(std::move(slot.op));
+        }
+        release_slot(index);
+      }
+      if (sink) {
+        sink->on_result(-ECANCELED, no_provided_buffer, false);
+      }
+    }
+  }
+
   void wakeup() noexcept override {
     if (eventfd_ < 0) {
       return;
@@ -242,6 +617,29 @@ class backend_uring final : public backend_interface {
     std::uint64_t user_data = 0;
   };
 
+  // In-flight completion-model request: a one-shot op or a multishot stream (`sink`).
+  //
+  // Slots are recycled, so submitting allocates nothing once the slab has grown to the peak
+  // number of in-flight requests. An id is `gen << 32 | index`; the generation changes when a
+  // slot is released, so a late cancel (or CQE) naming a finished request matches nothing.
+  struct op_slot {
+    reactor_op_ptr op{};
+    std::shared_ptr<io_stream_sink> sink{};
+    std::int32_t* result = nullptr;
+    // send_zc: the result, held back until the buffer-release notification.
+    std::optional<std::int32_t> deferred_result{};
+    std::uint32_t gen = 1;
+    std::uint32_t next_free = 0;
+    bool in_use = false;
+  };
+  static constexpr std::uint32_t no_slot = 0xFFFFFFFFU;
+  // `pack_op()` keeps 62 bits of the id.
+  static constexpr std::uint32_t slot_gen_mask = 0x3FFFFFFFU;
+  struct pending_io {
+    std::uint64_t id = 0;
+    io_request req{};
+  };
+
   struct uring_poll_state {
     bool armed = false;
     bool cancel_requested = false;
@@ -252,19 +650,64 @@ class backend_uring final : public backend_interface {
     std::uint32_t next_gen = 1;
   };
 
+  // Prepares SQEs for queued updates without submitting them (reactor thread, inside wait()).
   void flush_pending_updates() {
-    std::vector<pending_add> pending_adds{};
-    std::vector<pending_remove> pending_removes{};
+    if (single_issuer_) {
+      flush_file_updates();
+    }
     {
       std::scoped_lock lk{poll_mtx_};
-      pending_adds.swap(pending_adds_);
-      pending_removes.swap(pending_removes_);
+      flush_adds_.swap(pending_adds_);
+      flush_removes_.swap(pending_removes_);
     }
-    for (auto const& r : pending_removes) {
-      submit_poll_remove(r.fd, r.user_data);
+    {
+      std::scoped_lock lk{ops_mtx_};
+      flush_ios_.swap(pending_ios_);
+      flush_cancels_.swap(pending_cancels_);
+    }
+    auto clear = detail::make_scope_exit([this]() noexcept {
+      flush_adds_.clear();
+      flush_removes_.clear();
+      flush_ios_.clear();
+      flush_cancels_.clear();
+    });
+
+    for (auto const& r : flush_removes_) {
+      prep_poll_remove(r.fd, r.user_data);
     }
-    for (auto const& a : pending_adds) {
-      submit_poll_add(a.fd, a.mask, a.user_data);
+    for (auto const& a : flush_adds_) {
+      prep_poll_add(a.fd, a.mask, a.user_data);
+    }
+
+    // A request cancelled before it ever reached the kernel completes right here.
+    for (auto& id : flush_cancels_) {
+      auto it = std::find_if(flush_ios_.begin(), flush_ios_.end(),
+                             [id](pending_io const& p) { return p.id == id; });
+      if (it != flush_ios_.end()) {
+        flush_ios_.erase(it);
+        if (!end_stream(id, -ECANCELED)) {
+          complete_op(id, -ECANCELED);
+        }
+        id = 0;
+      }
+    }
+    // SQEs are consumed in order, so each cancel follows the request it targets.
+    for (auto const& p : flush_ios_) {
+      if (p.req.op == io_request::opcode::recv_multishot && !ensure_buf_ring()) {
+        end_stream(p.id, -EINVAL);
+        continue;
+      }
+      auto* sqe = acquire_sqe();
+      prep_io(sqe, p.req);
+      ::io_uring_sqe_set_data64(sqe, pack_op(p.id));
+    }
+    for (auto const id : flush_cancels_) {
+      if (id == 0) {
+        continue;
+      }
+      auto* sqe = acquire_sqe();
+      ::io_uring_prep_cancel64(sqe, pack_op(id), 0);
+      ::io_uring_sqe_set_data64(sqe, pack_fd(0, tag_remove));
     }
   }
 
@@ -282,6 +725,27 @@ class backend_uring final : public backend_interface {
     if (tag == tag_remove) {
       return;
     }
+    if (tag == tag_op) {
+      auto const id = unpack_op(data);
+      std::uint32_t const buffer = (cqe->flags & IORING_CQE_F_BUFFER) != 0
+                                     ? cqe->flags >> IORING_CQE_BUFFER_SHIFT
+                                     : no_provided_buffer;
+      bool const more = (cqe->flags & IORING_CQE_F_MORE) != 0;
+      if (!deliver_stream(id, cqe->res, buffer, more)) {
+        if (buffer != no_provided_buffer) {
+          // Late result of a stream already ended (drained context).
+          recycle_buffer(buffer);
+        }
+        if (more) {
+          // Zero-copy send: the result comes first, the buffer-release notification
+          // (IORING_CQE_F_NOTIF) later; the op completes with the latter.
+          defer_result(id, cqe->res);
+        } else {
+          complete_op(id, cqe->res);
+        }
+      }
+      return;
+    }
 
     int const fd = unpack_fd(data);
     std::uint32_t const gen = unpack_gen(data);
@@ -289,13 +753,15 @@ class backend_uring final : public backend_interface {
     std::uint32_t const ev = (res >= 0) ? static_cast<std::uint32_t>(res) : 0U;
     bool const is_cancelled = (res == -ECANCELED);
     bool generation_matched = false;
+    bool withdrawn = false;
 
     {
       std::scoped_lock lk{poll_mtx_};
-      auto it = polls_.find(fd);
-      if (it != polls_.end()) {
-        auto& st = it->second;
+      if (auto* st_ptr = find_poll(fd); st_ptr != nullptr) {
+        auto& st = *st_ptr;
         generation_matched = (st.armed && st.active_gen == gen);
+        // `remove_fd()` only queues the POLL_REMOVE; the poll may fire before it is processed.
+        withdrawn = (st.desired_mask == 0);
         if (generation_matched) {
           st.armed = false;
           st.cancel_requested = false;
@@ -311,13 +777,10 @@ class backend_uring final : public backend_interface {
           st.active_user_data = pack_fd(fd, tag_poll, st.active_gen);
           local_arms.push_back(pending_add{fd, st.active_mask, st.active_user_data});
         }
-        if (!st.armed && st.desired_mask == 0) {
-          polls_.erase(it);
-        }
       }
     }
 
-    if (!generation_matched || is_cancelled) {
+    if (!generation_matched || is_cancelled || withdrawn) {
       return;
     }
 
@@ -335,75 +798,275 @@ class backend_uring final : public backend_interface {
     e.can_read = is_error || has_hup || has_read;
     e.can_write = is_error || has_hup || has_write;
 
-    if (is_error) {
-      if (res < 0) {
-        e.ec = std::error_code{-res, std::generic_category()};
-      } else {
-        e.ec = error::connection_reset;
-      }
+    if (res < 0) {
+      e.error = -res;
     }
 
     out.push_back(e);
   }
 
-  void arm_wakeup() {
-    submit_poll_add_entry(eventfd_, POLLIN | POLLERR | POLLHUP, pack_fd(0, tag_wakeup));
+  void complete_op(std::uint64_t id, std::int32_t res) {
+    reactor_op_ptr op{};
+    {
+      std::scoped_lock lk{ops_mtx_};
+      auto* slot = find_slot(id);
+      if (slot == nullptr || slot->sink) {
+        return;
+      }
+      if (slot->result != nullptr) {
+        *slot->result = slot->deferred_result.value_or(res);
+      }
+      op = std::move(slot->op);
+      release_slot(static_cast<std::uint32_t>(id));
+    }
+    completed_.push_back(std::move(op));
   }
 
-  void submit_poll_add(int fd, int mask, std::uint64_t user_data) {
-    submit_poll_add_entry(fd, mask, user_data);
+  void defer_result(std::uint64_t id, std::int32_t res) {
+    std::scoped_lock lk{ops_mtx_};
+    if (auto* slot = find_slot(id); slot != nullptr) {
+      slot->deferred_result = res;
+    }
   }
 
-  void submit_poll_remove(int fd, std::uint64_t user_data) {
-    std::scoped_lock lk{ring_mtx_};
-    auto* sqe = ::io_uring_get_sqe(&ring_);
-    if (sqe == nullptr) {
-      (void)::io_uring_submit(&ring_);
-      sqe = ::io_uring_get_sqe(&ring_);
-      if (sqe == nullptr) {
-        return;
+  // Slab helpers; callers hold `ops_mtx_`.
+
+  // Returns a free slot, growing the slab if needed (may throw; nothing changes then).
+  auto acquire_slot() -> std::uint32_t {
+    std::uint32_t index = free_slot_;
+    if (index == no_slot) {
+      slots_.emplace_back();
+      index = static_cast<std::uint32_t>(slots_.size() - 1);
+    } else {
+      free_slot_ = slots_[index].next_free;
+    }
+    slots_[index].in_use = true;
+    return index;
+  }
+
+  void release_slot(std::uint32_t index) noexcept {
+    auto& slot = slots_[index];
+    slot.op.reset();
+    slot.sink.reset();
+    slot.result = nullptr;
+    slot.deferred_result.reset();
+    slot.in_use = false;
+    slot.gen = (slot.gen + 1) & slot_gen_mask;
+    if (slot.gen == 0) {
+      slot.gen = 1;
+    }
+    slot.next_free = free_slot_;
+    free_slot_ = index;
+  }
+
+  auto slot_id(op_slot const& slot) const noexcept -> std::uint64_t {
+    auto const index = static_cast<std::uint64_t>(&slot - slots_.data());
+    return (static_cast<std::uint64_t>(slot.gen) << 32) | index;
+  }
+
+  auto find_slot(std::uint64_t id) noexcept -> op_slot* {
+    auto const index = static_cast<std::size_t>(id & 0xFFFFFFFFULL);
+    if (index >= slots_.size()) {
+      return nullptr;
+    }
+    auto& slot = slots_[index];
+    if (!slot.in_use || slot.gen != static_cast<std::uint32_t>(id >> 32)) {
+      return nullptr;
+    }
+    return &slot;
+  }
+
+  // Room for one more pending request, grown geometrically.
+  void reserve_pending_io() {
+    if (pending_ios_.size() == pending_ios_.capacity()) {
+      pending_ios_.reserve(std::max<std::size_t>(16, pending_ios_.capacity() * 2));
+    }
+  }
+
+  // Callers hold `poll_mtx_`.
+  auto find_poll(int fd) noexcept -> uring_poll_state* {
+    auto const index = static_cast<std::size_t>(fd);
+    return index < polls_.size() ? &polls_[index] : nullptr;
+  }
+
+  // Single issuer: apply queued registered-file updates (reactor thread).
+  void flush_file_updates() noexcept {
+    std::scoped_lock lk{register_mtx_};
+    for (auto const& u : pending_files_) {
+      (void)::io_uring_register_files_update(&ring_, static_cast<unsigned>(u.slot), &u.fd, 1);
+      if (u.fd < 0) {
+        free_file_slots_.push_back(u.slot);
       }
     }
-    ::io_uring_prep_poll_remove(sqe, user_data);
-    ::io_uring_sqe_set_data64(sqe, pack_fd(fd, tag_remove));
-    (void)::io_uring_submit(&ring_);
+    pending_files_.clear();
   }
 
-  void submit_poll_add_entry(int fd, int mask, std::uint64_t user_data) {
-    std::scoped_lock lk{ring_mtx_};
-    auto* sqe = ::io_uring_get_sqe(&ring_);
-    if (sqe == nullptr) {
-      int const submit = ::io_uring_submit(&ring_);
-      if (submit < 0) {
-        throw std::system_error(-submit, std::generic_category(), "io_uring_submit failed");
+  // Single issuer: the first thread to wait becomes the issuer; the kernel would reject any
+  // other with EEXIST. io_context_impl refuses other runners before they get here (see
+  // `single_issuer()`); this is only the backstop for direct backend use.
+  void enable_for_this_thread() {
+    auto const self = std::this_thread::get_id();
+    if (issuer_ == self) {
+      return;
+    }
+    if (issuer_ != std::thread::id{}) {
+      throw std::system_error(EEXIST, std::generic_category(),
+                              "io_uring single_issuer: io_context run from a second thread");
+    }
+    if (int const ret = ::io_uring_enable_rings(&ring_); ret < 0) {
+      throw std::system_error(-ret, std::generic_category(), "io_uring_enable_rings failed");
+    }
+    issuer_ = self;
+  }
+
+  // Hands a multishot result to its sink (outside the lock: sinks may cancel their own request).
+  auto deliver_stream(std::uint64_t id, std::int32_t res, std::uint32_t buffer, bool more)
+    -> bool {
+    std::shared_ptr<io_stream_sink> sink{};
+    {
+      std::scoped_lock lk{ops_mtx_};
+      auto* slot = find_slot(id);
+      if (slot == nullptr || !slot->sink) {
+        return false;
       }
-      sqe = ::io_uring_get_sqe(&ring_);
-      if (sqe == nullptr) {
-        throw std::system_error(std::make_error_code(std::errc::no_buffer_space),
-                                "io_uring_get_sqe failed");
+      if (more) {
+        sink = slot->sink;
+      } else {
+        sink = std::move(slot->sink);
+        release_slot(static_cast<std::uint32_t>(id));
       }
     }
+    sink->on_result(res, buffer, more);
+    return true;
+  }
 
-    ::io_uring_prep_poll_add(sqe, fd, mask);
-    ::io_uring_sqe_set_data64(sqe, user_data);
+  auto end_stream(std::uint64_t id, std::int32_t res) -> bool {
+    return deliver_stream(id, res, no_provided_buffer, false);
+  }
+
+  // Registers the provided-buffer ring on first use (reactor thread); false if the kernel
+  // cannot, in which case multishot receives end with -EINVAL and their callers fall back.
+  //
+  // Without `IOCORO_URING_BUF_RING` (liburing older than 2.4, see CMakeLists.txt) there is no
+  // ring to register, and multishot receives always fall back.
+  auto ensure_buf_ring() -> bool {
+#if !defined(IOCORO_URING_BUF_RING)
+    return false;
+#else
+    if (buf_ring_ != nullptr) {
+      return true;
+    }
+    if (buf_ring_failed_) {
+      return false;
+    }
+    auto storage = std::make_unique_for_overwrite<std::byte[]>(
+      std::size_t{provided_buffer_count} * provided_buffer_size);
+    int ret = 0;
+    auto* br =
+      ::io_uring_setup_buf_ring(&ring_, provided_buffer_count, buf_group_id, 0, &ret);
+    if (br == nullptr) {
+      buf_ring_failed_ = true;
+      return false;
+    }
+    std::scoped_lock lk{buf_mtx_};
+    buf_storage_ = std::move(storage);
+    buf_ring_ = br;
+    auto const mask = ::io_uring_buf_ring_mask(provided_buffer_count);
+    for (std::uint32_t id = 0; id < provided_buffer_count; ++id) {
+      ::io_uring_buf_ring_add(buf_ring_, provided_buffer(id).data(), provided_buffer_size,
+                              static_cast<unsigned short>(id), mask, static_cast<int>(id));
+    }
+    ::io_uring_buf_ring_advance(buf_ring_, static_cast<int>(provided_buffer_count));
+    return true;
+#endif
+  }
+
+  // Returns a free SQE, submitting what is queued so far only when the submission queue is full.
+  auto acquire_sqe() -> io_uring_sqe* {
+    auto* sqe = ::io_uring_get_sqe(&ring_);
+    if (sqe != nullptr) {
+      return sqe;
+    }
     int const submit = ::io_uring_submit(&ring_);
     if (submit < 0) {
       throw std::system_error(-submit, std::generic_category(), "io_uring_submit failed");
     }
+    sqe = ::io_uring_get_sqe(&ring_);
+    if (sqe == nullptr) {
+      throw std::system_error(std::make_error_code(std::errc::no_buffer_space),
+                              "io_uring_get_sqe failed");
+    }
+    return sqe;
+  }
+
+  void arm_wakeup() {
+    prep_poll_add(eventfd_, POLLIN | POLLERR | POLLHUP, pack_fd(0, tag_wakeup));
+  }
+
+  void prep_poll_remove(int fd, std::uint64_t user_data) {
+    auto* sqe = acquire_sqe();
+    ::io_uring_prep_poll_remove(sqe, user_data);
+    ::io_uring_sqe_set_data64(sqe, pack_fd(fd, tag_remove));
+  }
+
+  void prep_poll_add(int fd, int mask, std::uint64_t user_data) {
+    auto* sqe = acquire_sqe();
+    ::io_uring_prep_poll_add(sqe, fd, mask);
+    ::io_uring_sqe_set_data64(sqe, user_data);
   }
 
+  // The submission queue is only touched by the thread inside wait() (and the constructor);
+  // other threads record updates in the pending lists below and wake the reactor.
   io_uring ring_{};
   int eventfd_ = -1;
-  std::unordered_map<int, uring_poll_state> polls_{};
+  // Poll state indexed by fd, grown on demand.
+  std::vector<uring_poll_state> polls_{};
   std::mutex poll_mtx_{};
-  std::mutex ring_mtx_{};
   wake_state wakeup_{};
   std::vector<pending_add> pending_adds_{};
   std::vector<pending_remove> pending_removes_{};
+
+  // Completion-model operations and armed multishot requests (see `op_slot`).
+  bool supports_io_ = false;
+  // Bit `1 << opcode` per `io_request::opcode` the kernel runs (empty without `supports_io_`).
+  std::uint32_t io_ops_ = 0;
+  std::mutex ops_mtx_{};
+  std::vector<op_slot> slots_{};
+  std::uint32_t free_slot_ = no_slot;
+  std::vector<pending_io> pending_ios_{};
+  std::vector<std::uint64_t> pending_cancels_{};
+
+  // Provided-buffer ring for multishot receives: `provided_buffer_count` buffers of
+  // `provided_buffer_size` bytes, buffer id == index. Consumers return buffers from any thread.
+  std::mutex buf_mtx_{};
+  io_uring_buf_ring* buf_ring_ = nullptr;
+  std::unique_ptr<std::byte[]> buf_storage_{};
+  bool buf_ring_failed_ = false;
+
+  // Registered files (free slots of the sparse table) and buffers; updated from any thread.
+  std::mutex register_mtx_{};
+  std::vector<std::int32_t> free_file_slots_{};
+  struct pending_file {
+    std::int32_t slot = -1;
+    int fd = -1;
+  };
+  std::vector<pending_file> pending_files_{};
+
+  // IORING_SETUP_SINGLE_ISSUER: the ring starts disabled and is enabled by the first `wait()`.
+  bool single_issuer_ = false;
+  std::thread::id issuer_{};
+
+  // Scratch batches of `flush_pending_updates()`, kept to reuse their capacity.
+  std::vector<pending_add> flush_adds_{};
+  std::vector<pending_remove> flush_removes_{};
+  std::vector<pending_io> flush_ios_{};
+  std::vector<std::uint64_t> flush_cancels_{};
+  // Filled by `wait()` and drained by `take_completions()` (reactor thread only).
+  std::vector<reactor_op_ptr> completed_{};
 };
 
-inline auto make_backend() -> std::unique_ptr<backend_interface> {
-  return std::make_unique<backend_uring>();
+inline auto make_backend(backend_options const& opts) -> std::unique_ptr<backend_interface> {
+  return std::make_unique<backend_uring>(opts);
 }
 
 }  // namespace iocoro::detail
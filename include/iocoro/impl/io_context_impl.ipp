@@ -9,7 +9,7 @@
 //
 // Default: epoll (no extra dependencies).
 //
-// To force io_uring backend (requires liburing headers + linking `-luring`):
+// To force io_uring backend (experimental; requires liburing headers + linking `-luring`):
 // - Define `IOCORO_BACKEND_URING`.
 //
 // To force epoll explicitly:
@@ -34,21 +34,39 @@
 #include <algorithm>
 #include <chrono>
 #include <condition_variable>
+#include <cstdint>
 #include <mutex>
+#include <thread>
 #include <utility>
 
+#include <signal.h>
+
 namespace iocoro::detail {
 
-inline auto io_context_impl::this_thread_token() noexcept -> std::uintptr_t {
-  static thread_local int tls_anchor = 0;
-  return reinterpret_cast<std::uintptr_t>(&tls_anchor);
+inline auto io_context_impl::this_thread_frames() noexcept -> run_frame*& {
+  static thread_local run_frame* top = nullptr;
+  return top;
 }
 
-inline io_context_impl::io_context_impl() : backend_(make_backend()) {}
+inline io_context_impl::io_context_impl() : io_context_impl(make_backend()) {}
+
+inline io_context_impl::io_context_impl(timer_queue_kind timers)
+    : io_context_impl(make_backend(), timers) {}
 
-inline io_context_impl::io_context_impl(std::unique_ptr<backend_interface> backend)
-    : backend_(std::move(backend)) {
+inline io_context_impl::io_context_impl(std::unique_ptr<backend_interface> backend,
+                                        timer_queue_kind timers)
+    : backend_(std::move(backend)), timers_(timers) {
   IOCORO_ENSURE(backend_ != nullptr, "io_context_impl: null backend");
+  completion_io_ = backend_->supports_io();
+  if (completion_io_) {
+    for (auto op = 0U; op <= static_cast<unsigned>(io_request::opcode::splice); ++op) {
+      if (backend_->supports_io_op(static_cast<io_request::opcode>(op))) {
+        completion_ops_ |= 1U << op;
+      }
+    }
+  }
+  multishot_io_ = completion_io_ && backend_->supports_multishot();
+  single_issuer_ = backend_->single_issuer();
 }
 
 inline io_context_impl::~io_context_impl() {
@@ -57,14 +75,12 @@ inline io_context_impl::~io_context_impl() {
 }
 
 inline auto io_context_impl::run() -> std::size_t {
-  IOCORO_ENSURE(!running_.exchange(true, std::memory_order_acq_rel),
-                "io_context_impl::run(): concurrent event loops are not supported");
-  auto running_guard = detail::make_scope_exit([this]() noexcept {
-    thread_token_.store(0, std::memory_order_release);
-    running_.store(false, std::memory_order_release);
-    notify_state_change();
-  });
-  set_thread_id();
+  IOCORO_ENSURE(!running_in_this_thread(),
+                "io_context_impl::run(): re-entrant event loops are not supported");
+  ensure_issuer_thread();
+  run_frame frame{};
+  enter_run(frame);
+  auto running_guard = detail::make_scope_exit([this, &frame]() noexcept { leave_run(frame); });
 
   std::size_t count = 0;
   while (true) {
@@ -75,54 +91,71 @@ inline auto io_context_impl::run() -> std::size_t {
     if (is_stopped() || !has_work()) {
       break;
     }
-    count += process_timers();
-    if (is_stopped() || !has_work()) {
-      break;
-    }
-    auto wait = next_wait(std::nullopt);
-    if (posted_.has_pending_tasks()) {
-      wait = std::chrono::milliseconds{0};
+    if (!try_acquire_reactor(frame)) {
+      // Another thread is waiting on the backend; park until it hands over or work arrives.
+      if (!posted_.has_pending_tasks()) {
+        wait_idle(std::nullopt);
+      }
+      continue;
     }
-    count += process_events(wait);
+    auto reactor_guard =
+      detail::make_scope_exit([this, &frame]() noexcept { release_reactor(frame); });
+    count += run_reactor_turn(std::nullopt);
   }
   return count;
 }
 
 inline auto io_context_impl::run_one() -> std::size_t {
-  IOCORO_ENSURE(!running_.exchange(true, std::memory_order_acq_rel),
-                "io_context_impl::run_one(): concurrent event loops are not supported");
-  auto running_guard = detail::make_scope_exit([this]() noexcept {
-    thread_token_.store(0, std::memory_order_release);
-    running_.store(false, std::memory_order_release);
-    notify_state_change();
-  });
-  set_thread_id();
+  IOCORO_ENSURE(!running_in_this_thread(),
+                "io_context_impl::run_one(): re-entrant event loops are not supported");
+  ensure_issuer_thread();
+  run_frame frame{};
+  enter_run(frame);
+  auto running_guard = detail::make_scope_exit([this, &frame]() noexcept { leave_run(frame); });
+
+  for (;;) {
+    if (is_stopped() || !has_work()) {
+      return 0;
+    }
 
-  if (is_stopped() || !has_work()) {
-    return 0;
-  }
+    std::size_t count;
+    if (count = process_posted(); count > 0) {
+      return count;
+    }
 
-  std::size_t count;
-  if (count = process_posted(); count > 0) {
-    return count;
-  }
+    if (!try_acquire_reactor(frame)) {
+      wait_idle(std::nullopt);
+      continue;
+    }
+    auto reactor_guard =
+      detail::make_scope_exit([this, &frame]() noexcept { release_reactor(frame); });
 
-  if (count = process_timers(); count > 0) {
-    return count;
-  }
+    if (count = process_timers(); count > 0) {
+      return count;
+    }
+    if (count = busy_poll(std::nullopt); count > 0) {
+      return count;
+    }
+    if (posted_.has_pending_tasks()) {
+      continue;
+    }
 
-  return process_events(next_wait(std::nullopt));
+    backend_->prepare_wait();
+    auto wait = next_wait(std::nullopt);
+    if (posted_.has_pending_tasks()) {
+      wait = std::chrono::steady_clock::duration::zero();
+    }
+    return process_events(wait);
+  }
 }
 
-inline auto io_context_impl::run_for(std::chrono::milliseconds timeout) -> std::size_t {
-  IOCORO_ENSURE(!running_.exchange(true, std::memory_order_acq_rel),
-                "io_context_impl::run_for(): concurrent event loops are not supported");
-  auto running_guard = detail::make_scope_exit([this]() noexcept {
-    thread_token_.store(0, std::memory_order_release);
-    running_.store(false, std::memory_order_release);
-    notify_state_change();
-  });
-  set_thread_id();
+inline auto io_context_impl::run_for(std::chrono::steady_clock::duration timeout) -> std::size_t {
+  IOCORO_ENSURE(!running_in_this_thread(),
+                "io_context_impl::run_for(): re-entrant event loops are not supported");
+  ensure_issuer_thread();
+  run_frame frame{};
+  enter_run(frame);
+  auto running_guard = detail::make_scope_exit([this, &frame]() noexcept { leave_run(frame); });
 
   auto const deadline = std::chrono::steady_clock::now() + timeout;
   std::size_t count = 0;
@@ -141,16 +174,80 @@ inline auto io_context_impl::run_for(std::chrono::milliseconds timeout) -> std::
       break;
     }
 
-    count += process_timers();
-    if (is_stopped() || !has_work()) {
-      break;
+    if (!try_acquire_reactor(frame)) {
+      if (!posted_.has_pending_tasks()) {
+        wait_idle(deadline);
+      }
+      continue;
     }
+    auto reactor_guard =
+      detail::make_scope_exit([this, &frame]() noexcept { release_reactor(frame); });
+    count += run_reactor_turn(deadline);
+  }
+  return count;
+}
 
-    auto wait = next_wait(deadline);
-    if (posted_.has_pending_tasks()) {
-      wait = std::chrono::milliseconds{0};
+inline auto io_context_impl::run_reactor_turn(
+  std::optional<std::chrono::steady_clock::time_point> deadline) -> std::size_t {
+  auto count = process_timers();
+  if (is_stopped() || !has_work()) {
+    return count;
+  }
+  if (count > 0 && inline_completions() && rearmed_timer_due()) {
+    // A coroutine resumed inline above re-armed an already expired timer. A posted resumption
+    // would have ended this turn early (see below); do the same rather than poll the backend.
+    return count;
+  }
+  if (auto const n = busy_poll(deadline); n > 0 || posted_.has_pending_tasks()) {
+    return count + n;
+  }
+
+  // Open the wake window before sampling timers/posted work: a timer added or a task posted by
+  // another thread after the sample then reliably interrupts the blocking wait.
+  backend_->prepare_wait();
+  auto wait = next_wait(deadline);
+  if (posted_.has_pending_tasks()) {
+    wait = std::chrono::steady_clock::duration::zero();
+  }
+  count += process_events(wait);
+  return count;
+}
+
+inline void io_context_impl::set_busy_poll(std::chrono::microseconds max) noexcept {
+  busy_poll_max_ = std::max(max, std::chrono::microseconds::zero());
+  busy_poll_window_ = busy_poll_max_;
+}
+
+inline auto io_context_impl::busy_poll(
+  std::optional<std::chrono::steady_clock::time_point> deadline) -> std::size_t {
+  constexpr auto zero = std::chrono::steady_clock::duration::zero();
+  if (busy_poll_max_ == zero) {
+    return 0;
+  }
+  // Never spin past a timer expiry or the run_for() deadline.
+  auto window = busy_poll_window_;
+  if (auto const limit = next_wait(deadline); limit.has_value()) {
+    if (*limit <= zero) {
+      return 0;
+    }
+    window = std::min(window, *limit);
+  }
+
+  auto const end = std::chrono::steady_clock::now() + window;
+  std::size_t count = 0;
+  while (!is_stopped() && !posted_.has_pending_tasks()) {
+    if (count = process_events(zero); count > 0) {
+      break;
+    }
+    if (std::chrono::steady_clock::now() >= end) {
+      break;
     }
-    count += process_events(wait);
+  }
+
+  if (count > 0 || posted_.has_pending_tasks()) {
+    busy_poll_window_ = std::min(busy_poll_window_ * 2, busy_poll_max_);
+  } else if (!is_stopped()) {
+    busy_poll_window_ = std::max(busy_poll_window_ / 2, busy_poll_max_ / 16);
   }
   return count;
 }
@@ -158,6 +255,7 @@ inline auto io_context_impl::run_for(std::chrono::milliseconds timeout) -> std::
 inline void io_context_impl::stop() {
   stopped_.store(true, std::memory_order_release);
   wakeup();
+  notify_idle(true);
 }
 
 inline void io_context_impl::restart() {
@@ -169,6 +267,18 @@ inline void io_context_impl::post(unique_function<void()> f) {
   if (!running_in_this_thread()) {
     wakeup();
   }
+  notify_idle();
+}
+
+inline void io_context_impl::post_bulk(std::span<unique_function<void()>> fs) {
+  if (fs.empty()) {
+    return;
+  }
+  posted_.post_bulk(fs);
+  if (!running_in_this_thread()) {
+    wakeup();
+  }
+  notify_idle();
 }
 
 inline void io_context_impl::dispatch(unique_function<void()> f) {
@@ -181,14 +291,25 @@ inline void io_context_impl::dispatch(unique_function<void()> f) {
 
 inline auto io_context_impl::add_timer(std::chrono::steady_clock::time_point expiry,
                                        reactor_op_ptr op) -> event_handle {
-  // IMPORTANT: Once the loop is running, registry/backend is owned by the reactor thread.
+  // IMPORTANT: Once the loop is running, registrations come from event-loop threads.
   // Before the loop starts, we allow single-threaded setup by the caller.
-  if (running_.load(std::memory_order_acquire)) {
+  if (runners_.load(std::memory_order_acquire) > 0) {
     IOCORO_ENSURE(running_in_this_thread(),
                   "io_context_impl::add_timer(): must run on io_context thread");
   }
-  auto result = timers_.add_timer(expiry, std::move(op));
-  auto h = event_handle::make_timer(weak_from_this(), result.index, result.token);
+  timer_registry::register_result result{};
+  {
+    std::scoped_lock lk{registry_mtx_};
+    result = timers_.add_timer(expiry, std::move(op));
+    sync_registry_counts();
+    if (expiry < rearmed_expiry_.load(std::memory_order_relaxed)) {
+      rearmed_expiry_.store(expiry, std::memory_order_relaxed);
+    }
+  }
+  if (result.earliest) {
+    wakeup_reactor_owner();
+  }
+  auto h = event_handle::make_timer(this, result.index, result.token);
   return h;
 }
 
@@ -196,8 +317,17 @@ inline void io_context_impl::cancel_timer(std::uint32_t index, std::uint64_t tok
   // Thread-safe entrypoint: always route cancellation to the reactor thread so that
   // registry mutation and abort callbacks occur in a single-threaded context.
   dispatch_reactor([index, token](io_context_impl& self) mutable noexcept {
-    auto res = self.timers_.cancel(index, token);
+    timer_registry::cancel_result res{};
+    {
+      std::scoped_lock lk{self.registry_mtx_};
+      res = self.timers_.cancel(index, token);
+      self.sync_registry_counts();
+    }
     abort_op(std::move(res.op), error::operation_aborted);
+    if (res.deferred) {
+      // The cancelled node is reclaimed by the next reactor turn.
+      self.wakeup_reactor_owner();
+    }
   });
 }
 
@@ -209,6 +339,16 @@ inline auto io_context_impl::register_fd_write(int fd, reactor_op_ptr op) -> eve
   return register_fd_impl(fd, std::move(op), detail::fd_event_kind::write);
 }
 
+inline auto io_context_impl::register_fd_error(int fd, reactor_op_ptr op) -> event_handle {
+  return register_fd_impl(fd, std::move(op), detail::fd_event_kind::error);
+}
+
+inline void io_context_impl::watch_error_queue(int fd) noexcept {
+  std::scoped_lock lk{registry_mtx_};
+  fd_registry_.watch_error_queue(fd);
+  sync_registry_counts();
+}
+
 inline auto io_context_impl::add_fd(int fd) noexcept -> bool {
   if (fd < 0) {
     return false;
@@ -218,10 +358,10 @@ inline auto io_context_impl::add_fd(int fd) noexcept -> bool {
   } catch (...) {
     return false;
   }
-  if (running_.load(std::memory_order_acquire) && !running_in_this_thread()) {
-    dispatch_reactor([fd](io_context_impl& self) noexcept { self.fd_registry_.track(fd); });
-  } else {
+  {
+    std::scoped_lock lk{registry_mtx_};
     fd_registry_.track(fd);
+    sync_registry_counts();
   }
   wakeup();
   return true;
@@ -232,7 +372,7 @@ inline void io_context_impl::remove_fd(int fd) noexcept {
     return;
   }
 
-  if (running_.load(std::memory_order_acquire) && !running_in_this_thread()) {
+  if (runners_.load(std::memory_order_acquire) > 0 && !running_in_this_thread()) {
     dispatch_reactor([fd](io_context_impl& self) noexcept { self.remove_fd_impl(fd); });
     return;
   }
@@ -245,7 +385,7 @@ inline void io_context_impl::remove_fd_sync(int fd) noexcept {
     return;
   }
 
-  if (!running_.load(std::memory_order_acquire) || running_in_this_thread()) {
+  if (runners_.load(std::memory_order_acquire) == 0 || running_in_this_thread()) {
     remove_fd_impl(fd);
     return;
   }
@@ -268,7 +408,8 @@ inline void io_context_impl::remove_fd_sync(int fd) noexcept {
 
   std::unique_lock lk{state_change_mtx_};
   state_change_cv_.wait(lk, [this, state] {
-    return state->done.load(std::memory_order_acquire) || !running_.load(std::memory_order_acquire);
+    return state->done.load(std::memory_order_acquire) ||
+           runners_.load(std::memory_order_acquire) == 0;
   });
   lk.unlock();
 
@@ -285,7 +426,12 @@ inline void io_context_impl::cancel_fd_event(int fd, detail::fd_event_kind kind,
   // Thread-safe entrypoint: always route cancellation to the reactor thread so that
   // registry mutation and abort callbacks occur in a single-threaded context.
   dispatch_reactor([fd, kind, token](io_context_impl& self) mutable noexcept {
-    auto result = self.fd_registry_.cancel(fd, kind, token);
+    fd_registry::cancel_result result{};
+    {
+      std::scoped_lock lk{self.registry_mtx_};
+      result = self.fd_registry_.cancel(fd, kind, token);
+      self.sync_registry_counts();
+    }
     if (!result.matched) {
       return;
     }
@@ -294,10 +440,93 @@ inline void io_context_impl::cancel_fd_event(int fd, detail::fd_event_kind kind,
   });
 }
 
+inline auto io_context_impl::submit_io(io_request const& req, reactor_op_ptr op)
+  -> event_handle {
+  IOCORO_ENSURE(completion_io_, "io_context_impl::submit_io(): backend has no completion I/O");
+  if (runners_.load(std::memory_order_acquire) > 0) {
+    IOCORO_ENSURE(running_in_this_thread(),
+                  "io_context_impl::submit_io(): must run on io_context thread");
+  }
+  inflight_io_.fetch_add(1, std::memory_order_acq_rel);
+  std::uint64_t id = 0;
+  try {
+    id = backend_->submit_io(req, std::move(op));
+  } catch (...) {
+    inflight_io_.fetch_sub(1, std::memory_order_acq_rel);
+    throw;
+  }
+  return event_handle::make_io(this, id);
+}
+
+inline auto io_context_impl::submit_multishot(io_request const& req,
+                                              std::shared_ptr<io_stream_sink> sink)
+  -> std::uint64_t {
+  IOCORO_ENSURE(multishot_io_, "io_context_impl::submit_multishot(): backend has no multishot I/O");
+  if (runners_.load(std::memory_order_acquire) > 0) {
+    IOCORO_ENSURE(running_in_this_thread(),
+                  "io_context_impl::submit_multishot(): must run on io_context thread");
+  }
+  return backend_->submit_multishot(req, std::move(sink));
+}
+
+inline auto io_context_impl::register_buffers(std::span<std::span<std::byte> const> buffers)
+  -> std::error_code {
+  if (!completion_io_) {
+    return std::make_error_code(std::errc::operation_not_supported);
+  }
+  std::vector<std::span<std::byte>> table(buffers.begin(), buffers.end());
+  std::scoped_lock lk{fixed_buffers_mtx_};
+  // Drop the lookup table first: no new request may name a buffer of the old set.
+  has_fixed_buffers_.store(false, std::memory_order_release);
+  fixed_buffers_.clear();
+  if (int const ret = backend_->register_buffers(buffers); ret < 0) {
+    return {-ret, std::generic_category()};
+  }
+  if (table.empty()) {
+    return {};
+  }
+  // WRITE_FIXED raises SIGPIPE like write(2) does; see `fixed_writes()`.
+  struct sigaction sa{};
+  fixed_writes_.store(::sigaction(SIGPIPE, nullptr, &sa) == 0 && sa.sa_handler == SIG_IGN,
+                      std::memory_order_relaxed);
+  fixed_buffers_ = std::move(table);
+  has_fixed_buffers_.store(true, std::memory_order_release);
+  return {};
+}
+
+inline auto io_context_impl::find_fixed_buffer(void const* data, std::size_t size) const noexcept
+  -> std::int32_t {
+  if (!has_fixed_buffers_.load(std::memory_order_acquire)) {
+    return -1;
+  }
+  auto const* p = static_cast<std::byte const*>(data);
+  std::scoped_lock lk{fixed_buffers_mtx_};
+  for (std::size_t i = 0; i < fixed_buffers_.size(); ++i) {
+    auto const& b = fixed_buffers_[i];
+    // Compare as integers: the pointers need not belong to the same object.
+    auto const lo = reinterpret_cast<std::uintptr_t>(b.data());
+    auto const at = reinterpret_cast<std::uintptr_t>(p);
+    if (at >= lo && at - lo <= b.size() && size <= b.size() - (at - lo)) {
+      return static_cast<std::int32_t>(i);
+    }
+  }
+  return -1;
+}
+
+inline void io_context_impl::cancel_io(std::uint64_t id) noexcept {
+  // The backend serializes ring access itself; the cancelled op still completes through
+  // `take_completions()` on the reactor thread.
+  backend_->cancel_io(id);
+}
+
 inline void io_context_impl::cancel_event(event_handle h) noexcept {
   if (!h) {
     return;
   }
+  if (h.type == event_handle::kind::io) {
+    cancel_io(h.io.id);
+    return;
+  }
   if (h.type == event_handle::kind::fd) {
     cancel_fd_event(h.fd.fd, h.fd.kind, h.fd.token);
     return;
@@ -318,13 +547,118 @@ inline void io_context_impl::remove_work_guard() noexcept {
   }
 }
 
-inline void io_context_impl::set_thread_id() noexcept {
-  thread_token_.store(this_thread_token(), std::memory_order_release);
+inline auto io_context_impl::current_frame() const noexcept -> run_frame* {
+  for (auto* f = this_thread_frames(); f != nullptr; f = f->prev) {
+    if (f->ctx == this) {
+      return f;
+    }
+  }
+  return nullptr;
 }
 
 inline auto io_context_impl::running_in_this_thread() const noexcept -> bool {
-  return running_.load(std::memory_order_acquire) &&
-         thread_token_.load(std::memory_order_acquire) == this_thread_token();
+  return current_frame() != nullptr;
+}
+
+inline void io_context_impl::ensure_issuer_thread() {
+  if (!single_issuer_) {
+    return;
+  }
+  // The first thread to run the loop becomes the issuer for good. Any other runner, concurrent
+  // or after `restart()`, could take the reactor role and make the backend's wait fail, which
+  // would abort every operation of the context.
+  auto expected = std::thread::id{};
+  auto const self = std::this_thread::get_id();
+  if (!issuer_.compare_exchange_strong(expected, self, std::memory_order_acq_rel)) {
+    IOCORO_ENSURE(expected == self,
+                  "io_context_impl::run*(): a single-issuer io_context must always be run by "
+                  "the same thread");
+  }
+}
+
+inline void io_context_impl::enter_run(run_frame& frame) noexcept {
+  auto& top = this_thread_frames();
+  frame.ctx = this;
+  frame.prev = top;
+  top = &frame;
+  runners_.fetch_add(1, std::memory_order_acq_rel);
+}
+
+inline void io_context_impl::leave_run(run_frame& frame) noexcept {
+  if (frame.owns_reactor) {
+    release_reactor(frame);
+  }
+  this_thread_frames() = frame.prev;
+  runners_.fetch_sub(1, std::memory_order_acq_rel);
+  // The reactor owner may have sampled "posted work pending" before this thread drained it and
+  // now block indefinitely; parked followers likewise re-check stop/out-of-work conditions.
+  wakeup_reactor_owner();
+  notify_idle(true);
+  notify_state_change();
+}
+
+inline auto io_context_impl::try_acquire_reactor(run_frame& frame) noexcept -> bool {
+  if (reactor_owned_.load(std::memory_order_relaxed) ||
+      reactor_owned_.exchange(true, std::memory_order_acq_rel)) {
+    return false;
+  }
+  frame.owns_reactor = true;
+  return true;
+}
+
+inline void io_context_impl::release_reactor(run_frame& frame) noexcept {
+  frame.owns_reactor = false;
+  reactor_owned_.store(false, std::memory_order_release);
+  notify_idle();
+}
+
+inline void io_context_impl::wait_idle(
+  std::optional<std::chrono::steady_clock::time_point> deadline) {
+  std::unique_lock lk{idle_mtx_};
+  idle_waiters_.fetch_add(1, std::memory_order_relaxed);
+  // Pairs with the fence in notify_idle(): either the notifier observes this waiter, or this
+  // waiter observes the notifier's state change in the predicate below.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  auto const ready = [this] {
+    return is_stopped() || posted_.has_pending_tasks() ||
+           !reactor_owned_.load(std::memory_order_acquire);
+  };
+  if (deadline) {
+    (void)idle_cv_.wait_until(lk, *deadline, ready);
+  } else {
+    idle_cv_.wait(lk, ready);
+  }
+  idle_waiters_.fetch_sub(1, std::memory_order_relaxed);
+}
+
+inline void io_context_impl::notify_idle(bool all) noexcept {
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (idle_waiters_.load(std::memory_order_relaxed) == 0) {
+    return;
+  }
+  {
+    // Serialize with a waiter that is between its predicate check and blocking.
+    std::scoped_lock lk{idle_mtx_};
+  }
+  if (all) {
+    idle_cv_.notify_all();
+  } else {
+    idle_cv_.notify_one();
+  }
+}
+
+inline void io_context_impl::wakeup_reactor_owner() noexcept {
+  if (!reactor_owned_.load(std::memory_order_acquire)) {
+    return;
+  }
+  if (auto* f = current_frame(); f != nullptr && f->owns_reactor) {
+    return;
+  }
+  wakeup();
+}
+
+inline auto io_context_impl::inline_completions() const noexcept -> bool {
+  return runners_.load(std::memory_order_relaxed) == 1;
 }
 
 inline auto io_context_impl::is_stopped() const noexcept -> bool {
@@ -334,26 +668,46 @@ inline auto io_context_impl::is_stopped() const noexcept -> bool {
 inline auto io_context_impl::process_timers() -> std::size_t {
   IOCORO_ENSURE(running_in_this_thread(),
                 "io_context_impl::process_timers(): must run on io_context thread");
-  return timers_.process_expired();
+  {
+    std::scoped_lock lk{registry_mtx_};
+    timers_.take_expired(expired_ops_);
+    sync_registry_counts();
+    rearmed_expiry_.store(std::chrono::steady_clock::time_point::max(),
+                          std::memory_order_relaxed);
+  }
+  inline_completion_scope inline_scope{inline_completions()};
+  return timer_registry::complete_expired(expired_ops_);
 }
 
 inline auto io_context_impl::process_posted() -> std::size_t {
   IOCORO_ENSURE(running_in_this_thread(),
                 "io_context_impl::process_posted(): must run on io_context thread");
-  return posted_.process();
+  auto const shared = runners_.load(std::memory_order_relaxed) > 1;
+  return posted_.process(shared ? shared_posted_batch : posted_queue::unbounded);
 }
 
-inline auto io_context_impl::next_wait(std::optional<std::chrono::steady_clock::time_point>
-                                         deadline) -> std::optional<std::chrono::milliseconds> {
-  auto const timer_timeout = timers_.next_timeout();
+inline auto io_context_impl::rearmed_timer_due() const noexcept -> bool {
+  auto const expiry = rearmed_expiry_.load(std::memory_order_relaxed);
+  return expiry != std::chrono::steady_clock::time_point::max() &&
+         expiry <= std::chrono::steady_clock::now();
+}
+
+inline auto io_context_impl::next_wait(
+  std::optional<std::chrono::steady_clock::time_point> deadline)
+  -> std::optional<std::chrono::steady_clock::duration> {
+  std::optional<std::chrono::steady_clock::duration> timer_timeout{};
+  {
+    std::scoped_lock lk{registry_mtx_};
+    timer_timeout = timers_.next_timeout();
+  }
   if (!deadline) {
     return timer_timeout;
   }
   auto const now = std::chrono::steady_clock::now();
   if (now >= *deadline) {
-    return std::chrono::milliseconds(0);
+    return std::chrono::steady_clock::duration::zero();
   }
-  auto const remaining = std::chrono::duration_cast<std::chrono::milliseconds>(*deadline - now);
+  auto const remaining = *deadline - now;
   if (!timer_timeout) {
     return remaining;
   }
@@ -361,8 +715,18 @@ inline auto io_context_impl::next_wait(std::optional<std::chrono::steady_clock::
 }
 
 inline auto io_context_impl::has_work() -> bool {
-  return work_guard_.has_work() || posted_.has_pending_tasks() || !timers_.empty() ||
-         !fd_registry_.empty();
+  if (work_guard_.has_work() || posted_.has_outstanding_work() ||
+      inflight_io_.load(std::memory_order_acquire) > 0) {
+    return true;
+  }
+  return active_timers_.load(std::memory_order_acquire) > 0 ||
+         active_fd_ops_.load(std::memory_order_acquire) > 0;
+}
+
+inline void io_context_impl::sync_registry_counts() noexcept {
+  tracked_fds_.store(fd_registry_.tracked_count(), std::memory_order_relaxed);
+  active_fd_ops_.store(fd_registry_.active_count(), std::memory_order_release);
+  active_timers_.store(timers_.active_count(), std::memory_order_release);
 }
 
 inline void io_context_impl::notify_state_change() noexcept {
@@ -371,14 +735,27 @@ inline void io_context_impl::notify_state_change() noexcept {
 
 inline auto io_context_impl::register_fd_impl(int fd, reactor_op_ptr op,
                                               detail::fd_event_kind kind) -> event_handle {
-  if (running_.load(std::memory_order_acquire)) {
+  if (runners_.load(std::memory_order_acquire) > 0) {
     IOCORO_ENSURE(running_in_this_thread(),
                   "io_context_impl::register_fd_*(): must run on "
                   "io_context thread");
   }
-  auto result = (kind == detail::fd_event_kind::read)
-                  ? fd_registry_.register_read(fd, std::move(op))
-                  : fd_registry_.register_write(fd, std::move(op));
+  fd_registry::register_result result{};
+  {
+    std::scoped_lock lk{registry_mtx_};
+    switch (kind) {
+      case detail::fd_event_kind::read:
+        result = fd_registry_.register_read(fd, std::move(op));
+        break;
+      case detail::fd_event_kind::write:
+        result = fd_registry_.register_write(fd, std::move(op));
+        break;
+      case detail::fd_event_kind::error:
+        result = fd_registry_.register_error(fd, std::move(op));
+        break;
+    }
+    sync_registry_counts();
+  }
   abort_op(std::move(result.replaced), error::operation_aborted);
   if (result.ready_now) {
     result.ready_now->vt->on_complete(result.ready_now->block);
@@ -386,13 +763,19 @@ inline auto io_context_impl::register_fd_impl(int fd, reactor_op_ptr op,
   if (result.token == invalid_token) {
     return event_handle::invalid_handle();
   }
-  return event_handle::make_fd(weak_from_this(), fd, kind, result.token);
+  return event_handle::make_fd(this, fd, kind, result.token);
 }
 
 inline void io_context_impl::remove_fd_impl(int fd) noexcept {
-  auto removed = fd_registry_.deregister(fd);
+  fd_registry::deregister_result removed{};
+  {
+    std::scoped_lock lk{registry_mtx_};
+    removed = fd_registry_.deregister(fd);
+    sync_registry_counts();
+  }
   abort_op(std::move(removed.read), error::operation_aborted);
   abort_op(std::move(removed.write), error::operation_aborted);
+  abort_op(std::move(removed.error), error::operation_aborted);
   backend_->remove_fd(fd);
 }
 
@@ -403,16 +786,18 @@ inline void io_context_impl::abort_op(reactor_op_ptr op, std::error_code ec) noe
   op->vt->on_abort(op->block, ec);
 }
 
-inline auto io_context_impl::process_events(std::optional<std::chrono::milliseconds> max_wait)
-  -> std::size_t {
-  IOCORO_ENSURE(running_in_this_thread(),
-                "io_context_impl::process_events(): must run on io_context thread");
+inline auto io_context_impl::process_events(
+  std::optional<std::chrono::steady_clock::duration> max_wait) -> std::size_t {
+  auto* frame = current_frame();
+  IOCORO_ENSURE(frame != nullptr && frame->owns_reactor,
+                "io_context_impl::process_events(): must hold the reactor role");
+  // Blocking callers open the wake window (`prepare_wait()`) themselves, before they sample the
+  // timers and posted work that decide `max_wait`.
   try {
-    bool const can_block = !max_wait.has_value() || *max_wait > std::chrono::milliseconds{0};
-    if (can_block) {
-      backend_->prepare_wait();
-    }
     backend_->wait(max_wait, backend_events_);
+    if (completion_io_) {
+      backend_->take_completions(completed_io_);
+    }
   } catch (...) {
     // Backend failure is treated as a fatal internal error for this io_context instance.
     // Abort all in-flight reactor operations so awaiters can observe an error rather than
@@ -421,7 +806,16 @@ inline auto io_context_impl::process_events(std::optional<std::chrono::milliseco
 
     stopped_.store(true, std::memory_order_release);
 
-    auto drained = fd_registry_.drain_all();
+    fd_registry::drain_all_result drained{};
+    std::vector<reactor_op_ptr> timer_ops{};
+    {
+      std::scoped_lock lk{registry_mtx_};
+      drained = fd_registry_.drain_all();
+      timer_ops = timers_.drain_all();
+      sync_registry_counts();
+    }
+    notify_idle(true);
+
     for (int fd : drained.fds) {
       backend_->remove_fd(fd);
     }
@@ -429,11 +823,20 @@ inline auto io_context_impl::process_events(std::optional<std::chrono::milliseco
       abort_op(std::move(op), ec);
     }
 
-    auto timer_ops = timers_.drain_all();
     for (auto& op : timer_ops) {
       abort_op(std::move(op), ec);
     }
 
+    if (completion_io_) {
+      backend_->drain_io(completed_io_);
+      auto const n = completed_io_.size();
+      for (auto& op : completed_io_) {
+        abort_op(std::move(op), ec);
+      }
+      completed_io_.clear();
+      inflight_io_.fetch_sub(n, std::memory_order_acq_rel);
+    }
+
     // Best-effort: drain posted tasks, swallowing user callback exceptions.
     while (posted_.has_pending_tasks()) {
       try {
@@ -445,26 +848,54 @@ inline auto io_context_impl::process_events(std::optional<std::chrono::milliseco
   }
   std::size_t count = 0;
 
-  auto process_one = [&](reactor_op_ptr& op, bool is_error, std::error_code ec) -> void {
-    if (!op) {
-      return;
+  // SAFETY: callbacks may re-enter the reactor (registering/cancelling ops); take ready ops
+  // under the registry lock and invoke them after releasing it.
+  {
+    std::scoped_lock lk{registry_mtx_};
+    for (auto const& ev : backend_events_) {
+      if (ev.fd < 0) {
+        continue;
+      }
+
+      auto ready = fd_registry_.take_ready(ev.fd, ev.can_read, ev.can_write, ev.is_error);
+      // On an fd with error-queue waiters, an error event is no verdict on the connection:
+      // read/write waiters retry their syscall, which reports a real error if there is one.
+      bool const abort = ev.is_error && !ready.error_queue;
+      if (ready.read) {
+        ready_ops_.push_back(ready_op{std::move(ready.read), abort, ev.error});
+      }
+      if (ready.write) {
+        ready_ops_.push_back(ready_op{std::move(ready.write), abort, ev.error});
+      }
+      if (ready.error) {
+        ready_ops_.push_back(ready_op{std::move(ready.error), false, 0});
+      }
     }
-    if (is_error) {
-      op->vt->on_abort(op->block, ec);
+    sync_registry_counts();
+  }
+
+  inline_completion_scope inline_scope{inline_completions()};
+  for (auto& r : ready_ops_) {
+    if (r.is_error) {
+      auto const ec = r.error != 0 ? std::error_code{r.error, std::generic_category()}
+                                   : std::error_code{error::connection_reset};
+      r.op->vt->on_abort(r.op->block, ec);
     } else {
-      op->vt->on_complete(op->block);
+      r.op->vt->on_complete(r.op->block);
     }
     ++count;
-  };
+  }
+  ready_ops_.clear();
 
-  for (auto const& ev : backend_events_) {
-    if (ev.fd < 0) {
-      continue;
+  // Completion-model results were stored by the backend; callbacks only resume the awaiters.
+  if (!completed_io_.empty()) {
+    auto const n = completed_io_.size();
+    for (auto& op : completed_io_) {
+      op->vt->on_complete(op->block);
     }
-
-    auto ready = fd_registry_.take_ready(ev.fd, ev.can_read, ev.can_write);
-    process_one(ready.read, ev.is_error, ev.ec);
-    process_one(ready.write, ev.is_error, ev.ec);
+    completed_io_.clear();
+    inflight_io_.fetch_sub(n, std::memory_order_acq_rel);
+    count += n;
   }
   return count;
 }
@@ -474,9 +905,9 @@ inline void io_context_impl::wakeup() {
 }
 
 inline void io_context_impl::dispatch_reactor(unique_function<void(io_context_impl&)> f) noexcept {
-  // INVARIANT: registry/backend mutations and op callbacks occur on the reactor thread.
+  // INVARIANT: op callbacks occur on event-loop threads.
   // If the loop is not running yet, we still enqueue so that the next run()/run_one()
-  // establishes the reactor thread and drains the callback there.
+  // drains the callback on an event-loop thread.
   if (running_in_this_thread()) {
     if (f) {
       f(*this);
@@ -505,11 +936,7 @@ inline void event_handle::cancel() const noexcept {
   if (!valid()) {
     return;
   }
-  auto s = impl.lock();
-  if (!s) {
-    return;
-  }
-  s->cancel_event(*this);
+  impl->cancel_event(*this);
 }
 
 }  // namespace iocoro::detail
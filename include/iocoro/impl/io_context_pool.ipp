@@ -0,0 +1,161 @@
+#include <iocoro/io_context_pool.hpp>
+
+#include <limits>
+#include <utility>
+
+#include <pthread.h>
+#include <sched.h>
+
+namespace iocoro {
+
+inline io_context_pool::io_context_pool(std::size_t n_contexts)
+    : io_context_pool(n_contexts, options{}) {}
+
+inline io_context_pool::io_context_pool(std::size_t n_contexts, options opts)
+    : policy_{opts.policy} {
+  IOCORO_ENSURE(n_contexts > 0, "io_context_pool: n_contexts must be > 0");
+
+  std::vector<int> cpus{};
+  if (opts.pin_threads) {
+    cpus = opts.cpus.empty() ? affinity_cpus() : std::move(opts.cpus);
+  }
+
+  contexts_.reserve(n_contexts);
+  for (std::size_t i = 0; i < n_contexts; ++i) {
+    auto s = std::make_unique<slot>(opts.context);
+    auto ex = s->ctx.get_executor();
+    s->impl = ex.io_context_ptr();
+    s->guard.emplace(std::move(ex));
+    if (!cpus.empty()) {
+      s->cpu = cpus[i % cpus.size()];
+    }
+    contexts_.push_back(std::move(s));
+  }
+
+  threads_.reserve(n_contexts);
+  for (auto& s : contexts_) {
+    threads_.emplace_back([this, p = s.get()] { run_slot(*p); });
+  }
+}
+
+inline io_context_pool::~io_context_pool() noexcept {
+  join();
+}
+
+inline auto io_context_pool::get_executor() noexcept -> any_io_executor {
+  return get_executor(policy_);
+}
+
+inline auto io_context_pool::get_executor(select_policy policy) noexcept -> any_io_executor {
+  auto const i =
+    (policy == select_policy::least_loaded) ? pick_least_loaded() : pick_round_robin();
+  return contexts_[i]->ctx.get_executor();
+}
+
+inline auto io_context_pool::context(std::size_t i) noexcept -> io_context& {
+  IOCORO_ENSURE(i < contexts_.size(), "io_context_pool::context: index out of range");
+  return contexts_[i]->ctx;
+}
+
+inline void io_context_pool::stop() noexcept {
+  if (stopped_.exchange(true, std::memory_order_acq_rel)) {
+    return;
+  }
+  for (auto& s : contexts_) {
+    s->guard.reset();
+    s->ctx.stop();
+  }
+}
+
+inline void io_context_pool::join() noexcept {
+  stop();
+  for (auto& t : threads_) {
+    if (t.joinable()) {
+      t.join();
+    }
+  }
+}
+
+inline void io_context_pool::set_exception_handler(exception_handler_t handler) noexcept {
+  if (handler) {
+    on_exception_.store(std::make_shared<exception_handler_t>(std::move(handler)),
+                        std::memory_order_release);
+  } else {
+    on_exception_.store(nullptr, std::memory_order_release);
+  }
+}
+
+inline void io_context_pool::run_slot(slot& s) noexcept {
+  if (s.cpu) {
+    pin_this_thread(*s.cpu);
+  }
+
+  while (!s.ctx.stopped()) {
+    try {
+      (void)s.ctx.run();
+    } catch (...) {
+      auto handler = on_exception_.load(std::memory_order_acquire);
+      if (handler) {
+        try {
+          (*handler)(std::current_exception());
+        } catch (...) {
+          // Swallow exceptions from handler to prevent thread termination
+        }
+      }
+      continue;
+    }
+    // `run()` returned normally: either stopped, or out of work after the guard was released.
+    break;
+  }
+}
+
+inline auto io_context_pool::pick_round_robin() noexcept -> std::size_t {
+  return next_.fetch_add(1, std::memory_order_relaxed) % contexts_.size();
+}
+
+inline auto io_context_pool::pick_least_loaded() noexcept -> std::size_t {
+  // Start the scan at a rotating offset so that ties spread across contexts.
+  auto const n = contexts_.size();
+  auto const start = pick_round_robin();
+  auto best = start;
+  auto best_load = std::numeric_limits<std::size_t>::max();
+  for (std::size_t k = 0; k < n; ++k) {
+    auto const i = (start + k) % n;
+    auto const load = contexts_[i]->impl->load();
+    if (load < best_load) {
+      best = i;
+      best_load = load;
+      if (load == 0) {
+        break;
+      }
+    }
+  }
+  return best;
+}
+
+inline auto io_context_pool::affinity_cpus() -> std::vector<int> {
+  std::vector<int> cpus{};
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  if (::pthread_getaffinity_np(::pthread_self(), sizeof(set), &set) != 0) {
+    return cpus;
+  }
+  for (int cpu = 0; cpu < CPU_SETSIZE; ++cpu) {
+    if (CPU_ISSET(cpu, &set)) {
+      cpus.push_back(cpu);
+    }
+  }
+  return cpus;
+}
+
+inline void io_context_pool::pin_this_thread(int cpu) noexcept {
+  if (cpu < 0 || cpu >= CPU_SETSIZE) {
+    return;
+  }
+  cpu_set_t set;
+  CPU_ZERO(&set);
+  CPU_SET(cpu, &set);
+  (void)::pthread_setaffinity_np(::pthread_self(), sizeof(set), &set);
+}
+
+}  // namespace iocoro
@@ -91,6 +91,9 @@ inline auto acceptor_impl::async_accept() -> awaitable<result<int>> {
   }
 
   auto guard = detail::make_scope_exit([this] { accept_op_.finish(); });
+  bool const use_io = base_.completion_io();
+  auto const multishot_limit = multishot_limit_.load(std::memory_order_relaxed);
+  bool use_multishot = multishot_limit != 0 && base_.multishot_io();
 
   for (;;) {
     if (!accept_op_.is_epoch_current(my_epoch) || res->closing()) {
@@ -98,17 +101,48 @@ inline auto acceptor_impl::async_accept() -> awaitable<result<int>> {
     }
 
     int fd = -1;
+    int err = 0;
     bool needs_fd_setup = true;
-#if defined(__linux__)
-    fd = ::accept4(res->native_handle(), nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
-    if (fd >= 0) {
+    if (use_multishot) {
+      auto r = co_await base_.async_multishot(
+        res, multishot_stream::kind::accept, multishot_limit,
+        io_request{.op = io_request::opcode::accept_multishot,
+                   .flags = SOCK_NONBLOCK | SOCK_CLOEXEC});
+      if (!r) {
+        co_return unexpected(r.error());
+      }
+      if (r->res == -EINVAL) {
+        // Multishot accept rejected by this kernel: one request per accept from now on.
+        use_multishot = false;
+        continue;
+      }
+      fd = r->res;
+      err = r->res < 0 ? -r->res : 0;
       needs_fd_setup = false;
-    } else if (errno == ENOSYS) {
-      fd = ::accept(res->native_handle(), nullptr, nullptr);
-    }
+    } else if (use_io) {
+      auto r = co_await base_.async_io(
+        res,
+        io_request{.op = io_request::opcode::accept, .flags = SOCK_NONBLOCK | SOCK_CLOEXEC},
+        true);
+      if (!r) {
+        co_return unexpected(r.error());
+      }
+      fd = *r;
+      err = *r < 0 ? -*r : 0;
+      needs_fd_setup = false;
+    } else {
+#if defined(__linux__)
+      fd = ::accept4(res->native_handle(), nullptr, nullptr, SOCK_NONBLOCK | SOCK_CLOEXEC);
+      if (fd >= 0) {
+        needs_fd_setup = false;
+      } else if (errno == ENOSYS) {
+        fd = ::accept(res->native_handle(), nullptr, nullptr);
+      }
 #else
-    fd = ::accept(res->native_handle(), nullptr, nullptr);
+      fd = ::accept(res->native_handle(), nullptr, nullptr);
 #endif
+      err = fd < 0 ? errno : 0;
+    }
     if (fd >= 0 && needs_fd_setup) {
       if (!set_cloexec(fd) || !set_nonblocking(fd)) {
         auto ec = map_socket_errno(errno);
@@ -125,15 +159,19 @@ inline auto acceptor_impl::async_accept() -> awaitable<result<int>> {
       co_return fd;
     }
 
-    if (errno == EINTR) {
+    if (err == EINTR) {
       continue;
     }
 
-    if (is_accept_transient_error(errno)) {
+    if (err == ECANCELED) {
+      co_return unexpected(error::operation_aborted);
+    }
+
+    if (is_accept_transient_error(err)) {
       continue;
     }
 
-    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+    if (err == EAGAIN || err == EWOULDBLOCK) {
       if (!accept_op_.is_epoch_current(my_epoch) || res->closing()) {
         co_return unexpected(error::operation_aborted);
       }
@@ -147,7 +185,7 @@ inline auto acceptor_impl::async_accept() -> awaitable<result<int>> {
       continue;
     }
 
-    co_return unexpected(map_socket_errno(errno));
+    co_return unexpected(map_socket_errno(err));
   }
 }
 
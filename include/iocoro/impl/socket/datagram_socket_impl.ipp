@@ -1,13 +1,49 @@
 #include <iocoro/detail/socket/datagram_socket_impl.hpp>
 
 #include <netinet/in.h>
+#include <netinet/udp.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <unistd.h>
+#include <algorithm>
 #include <cerrno>
 #include <cstring>
+#include <limits>
 
 namespace iocoro::detail::socket {
 
+// Whether two native addresses name the same destination (address family, address and port).
+inline auto same_destination(sockaddr const* a, socklen_t alen, sockaddr const* b,
+                             socklen_t blen) noexcept -> bool {
+  if (!a || !b || a->sa_family != b->sa_family) {
+    return false;
+  }
+  if (a->sa_family == AF_INET) {
+    if (alen < static_cast<socklen_t>(sizeof(sockaddr_in)) ||
+        blen < static_cast<socklen_t>(sizeof(sockaddr_in))) {
+      return false;
+    }
+    auto const* sa = reinterpret_cast<sockaddr_in const*>(a);
+    auto const* sb = reinterpret_cast<sockaddr_in const*>(b);
+    return sa->sin_port == sb->sin_port && sa->sin_addr.s_addr == sb->sin_addr.s_addr;
+  }
+  if (a->sa_family == AF_INET6) {
+    if (alen < static_cast<socklen_t>(sizeof(sockaddr_in6)) ||
+        blen < static_cast<socklen_t>(sizeof(sockaddr_in6))) {
+      return false;
+    }
+    auto const* sa = reinterpret_cast<sockaddr_in6 const*>(a);
+    auto const* sb = reinterpret_cast<sockaddr_in6 const*>(b);
+    return sa->sin6_port == sb->sin6_port &&
+           std::memcmp(&sa->sin6_addr, &sb->sin6_addr, sizeof(in6_addr)) == 0 &&
+           sa->sin6_scope_id == sb->sin6_scope_id;
+  }
+  if (alen != blen) {
+    return false;
+  }
+  return std::memcmp(a, b, static_cast<std::size_t>(alen)) == 0;
+}
+
 inline void datagram_socket_impl::cancel() noexcept {
   send_op_.cancel();
   receive_op_.cancel();
@@ -98,7 +134,8 @@ inline auto datagram_socket_impl::connect(sockaddr const* addr, socklen_t len) -
 }
 
 inline auto datagram_socket_impl::async_send_to(std::span<std::byte const> buffer,
-                                                sockaddr const* dest_addr, socklen_t dest_len)
+                                                sockaddr const* dest_addr, socklen_t dest_len,
+                                                std::size_t segment_size)
   -> awaitable<result<std::size_t>> {
   auto res = base_.acquire_resource();
   if (!res || res->native_handle() < 0) {
@@ -132,43 +169,15 @@ inline auto datagram_socket_impl::async_send_to(std::span<std::byte const> buffe
   if (buffer.empty()) {
     co_return 0;
   }
+  if (segment_size > (std::numeric_limits<std::uint16_t>::max)()) {
+    co_return unexpected(error::invalid_argument);
+  }
 
   if (is_connected) {
     if ((dest_addr == nullptr) != (dest_len == 0)) {
       co_return unexpected(error::invalid_argument);
     }
 
-    auto same_destination = [](sockaddr const* a, socklen_t alen, sockaddr const* b,
-                               socklen_t blen) noexcept -> bool {
-      if (!a || !b || a->sa_family != b->sa_family) {
-        return false;
-      }
-      if (a->sa_family == AF_INET) {
-        if (alen < static_cast<socklen_t>(sizeof(sockaddr_in)) ||
-            blen < static_cast<socklen_t>(sizeof(sockaddr_in))) {
-          return false;
-        }
-        auto const* sa = reinterpret_cast<sockaddr_in const*>(a);
-        auto const* sb = reinterpret_cast<sockaddr_in const*>(b);
-        return sa->sin_port == sb->sin_port && sa->sin_addr.s_addr == sb->sin_addr.s_addr;
-      }
-      if (a->sa_family == AF_INET6) {
-        if (alen < static_cast<socklen_t>(sizeof(sockaddr_in6)) ||
-            blen < static_cast<socklen_t>(sizeof(sockaddr_in6))) {
-          return false;
-        }
-        auto const* sa = reinterpret_cast<sockaddr_in6 const*>(a);
-        auto const* sb = reinterpret_cast<sockaddr_in6 const*>(b);
-        return sa->sin6_port == sb->sin6_port &&
-               std::memcmp(&sa->sin6_addr, &sb->sin6_addr, sizeof(in6_addr)) == 0 &&
-               sa->sin6_scope_id == sb->sin6_scope_id;
-      }
-      if (alen != blen) {
-        return false;
-      }
-      return std::memcmp(a, b, static_cast<std::size_t>(alen)) == 0;
-    };
-
     if (dest_addr) {
       if (!same_destination(dest_addr, dest_len, reinterpret_cast<sockaddr const*>(&connected_addr),
                             connected_addr_len)) {
@@ -177,26 +186,76 @@ inline auto datagram_socket_impl::async_send_to(std::span<std::byte const> buffe
     }
   }
 
+  // Unconnected sends in the completion model, and all segmented sends, go through sendmsg
+  // (IORING_OP_SEND has no address, and send/sendto carry no control data).
+  bool const use_msg = !is_connected || segment_size != 0;
+  bool const use_io =
+    base_.completion_io(use_msg ? io_request::opcode::sendmsg : io_request::opcode::send);
+  iovec iov{const_cast<std::byte*>(buffer.data()), buffer.size()};
+  msghdr msg{};
+  if (!is_connected) {
+    msg.msg_name = const_cast<sockaddr*>(dest_addr);
+    msg.msg_namelen = dest_len;
+  }
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+
+  alignas(cmsghdr) std::byte control[CMSG_SPACE(sizeof(std::uint16_t))]{};
+  if (segment_size != 0) {
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    auto* cm = CMSG_FIRSTHDR(&msg);
+    cm->cmsg_level = SOL_UDP;
+    cm->cmsg_type = UDP_SEGMENT;
+    cm->cmsg_len = CMSG_LEN(sizeof(std::uint16_t));
+    auto const gso_size = static_cast<std::uint16_t>(segment_size);
+    std::memcpy(CMSG_DATA(cm), &gso_size, sizeof(gso_size));
+  }
+
   for (;;) {
     if (!send_op_.is_epoch_current(my_epoch) || res->closing()) {
       co_return unexpected(error::operation_aborted);
     }
 
     ssize_t n;
-    if (is_connected) {
-      n = ::send(fd, buffer.data(), buffer.size(), detail::socket::send_no_signal_flags());
+    int err = 0;
+    if (use_io) {
+      auto req = !use_msg
+                   ? io_request{.op = io_request::opcode::send,
+                                .data = iov.iov_base,
+                                .size = iov.iov_len,
+                                .flags = detail::socket::send_no_signal_flags()}
+                   : io_request{.op = io_request::opcode::sendmsg,
+                                .flags = detail::socket::send_no_signal_flags(),
+                                .msg = &msg};
+      auto r = co_await base_.async_io(res, req, false);
+      if (!r) {
+        co_return unexpected(r.error());
+      }
+      n = *r < 0 ? -1 : *r;
+      err = *r < 0 ? -*r : 0;
     } else {
-      n = ::sendto(fd, buffer.data(), buffer.size(), detail::socket::send_no_signal_flags(),
-                   dest_addr, dest_len);
+      if (segment_size != 0) {
+        n = ::sendmsg(fd, &msg, detail::socket::send_no_signal_flags());
+      } else if (is_connected) {
+        n = ::send(fd, buffer.data(), buffer.size(), detail::socket::send_no_signal_flags());
+      } else {
+        n = ::sendto(fd, buffer.data(), buffer.size(), detail::socket::send_no_signal_flags(),
+                     dest_addr, dest_len);
+      }
+      err = n < 0 ? errno : 0;
     }
 
     if (n >= 0) {
       co_return static_cast<std::size_t>(n);
     }
-    if (errno == EINTR) {
+    if (err == EINTR) {
       continue;
     }
-    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+    if (err == ECANCELED) {
+      co_return unexpected(error::operation_aborted);
+    }
+    if (err == EAGAIN || err == EWOULDBLOCK) {
       auto r = co_await base_.wait_write_ready(res);
       if (!r) {
         co_return unexpected(r.error());
@@ -207,12 +266,13 @@ inline auto datagram_socket_impl::async_send_to(std::span<std::byte const> buffe
       continue;
     }
 
-    co_return unexpected(map_socket_errno(errno));
+    co_return unexpected(map_socket_errno(err));
   }
 }
 
 inline auto datagram_socket_impl::async_receive_from(std::span<std::byte> buffer,
-                                                     sockaddr* src_addr, socklen_t* src_len)
+                                                     sockaddr* src_addr, socklen_t* src_len,
+                                                     std::size_t* segment_size)
   -> awaitable<result<std::size_t>> {
   auto res = base_.acquire_resource();
   if (!res || res->native_handle() < 0) {
@@ -246,23 +306,216 @@ inline auto datagram_socket_impl::async_receive_from(std::span<std::byte> buffer
     co_return unexpected(error::invalid_argument);
   }
 
+  bool const use_io = base_.completion_io(io_request::opcode::recvmsg);
+  iovec iov{buffer.data(), buffer.size()};
+  msghdr msg{};
+  msg.msg_iov = &iov;
+  msg.msg_iovlen = 1;
+  alignas(cmsghdr) std::byte control[CMSG_SPACE(sizeof(int))]{};
+
   for (;;) {
     if (!receive_op_.is_epoch_current(my_epoch) || res->closing()) {
       co_return unexpected(error::operation_aborted);
     }
 
-    ssize_t n = ::recvfrom(fd, buffer.data(), buffer.size(), MSG_TRUNC, src_addr, src_len);
+    ssize_t n;
+    int err = 0;
+    if (segment_size != nullptr) {
+      msg.msg_control = control;
+      msg.msg_controllen = sizeof(control);
+    }
+    if (use_io || segment_size != nullptr) {
+      msg.msg_name = src_addr;
+      msg.msg_namelen = src_len != nullptr ? *src_len : 0;
+    }
+    if (use_io) {
+      auto r = co_await base_.async_io(
+        res, io_request{.op = io_request::opcode::recvmsg, .flags = MSG_TRUNC, .msg = &msg}, true);
+      if (!r) {
+        co_return unexpected(r.error());
+      }
+      n = *r < 0 ? -1 : *r;
+      err = *r < 0 ? -*r : 0;
+    } else if (segment_size != nullptr) {
+      n = ::recvmsg(fd, &msg, MSG_TRUNC);
+      err = n < 0 ? errno : 0;
+    } else {
+      n = ::recvfrom(fd, buffer.data(), buffer.size(), MSG_TRUNC, src_addr, src_len);
+      err = n < 0 ? errno : 0;
+    }
     if (n >= 0) {
+      if ((use_io || segment_size != nullptr) && src_len != nullptr) {
+        *src_len = msg.msg_namelen;
+      }
       if (static_cast<std::size_t>(n) > buffer.size()) {
         co_return unexpected(error::message_size);
       }
+      if (segment_size != nullptr) {
+        // Without a UDP_GRO cmsg the buffer holds a single datagram.
+        *segment_size = static_cast<std::size_t>(n);
+        for (auto* cm = CMSG_FIRSTHDR(&msg); cm != nullptr; cm = CMSG_NXTHDR(&msg, cm)) {
+          if (cm->cmsg_level == SOL_UDP && cm->cmsg_type == UDP_GRO) {
+            int gso_size = 0;
+            std::memcpy(&gso_size, CMSG_DATA(cm), sizeof(gso_size));
+            *segment_size = static_cast<std::size_t>(gso_size);
+          }
+        }
+      }
+      co_return static_cast<std::size_t>(n);
+    }
+
+    if (err == EINTR) {
+      continue;
+    }
+    if (err == ECANCELED) {
+      co_return unexpected(error::operation_aborted);
+    }
+    if (err == EAGAIN || err == EWOULDBLOCK) {
+      auto r = co_await base_.wait_read_ready(res);
+      if (!r) {
+        co_return unexpected(r.error());
+      }
+      if (!receive_op_.is_epoch_current(my_epoch) || res->closing()) {
+        co_return unexpected(error::operation_aborted);
+      }
+      continue;
+    }
+
+    co_return unexpected(map_socket_errno(err));
+  }
+}
+
+inline auto datagram_socket_impl::async_send_batch(std::span<mmsghdr> msgs)
+  -> awaitable<result<std::size_t>> {
+  auto res = base_.acquire_resource();
+  if (!res || res->native_handle() < 0) {
+    co_return unexpected(error::not_open);
+  }
+
+  auto inflight = base_.make_operation_guard(res);
+  if (!inflight) {
+    co_return unexpected(error::operation_aborted);
+  }
+  auto const fd = res->native_handle();
+
+  std::uint64_t my_epoch = 0;
+  bool is_connected = false;
+  sockaddr_storage connected_addr{};
+  socklen_t connected_addr_len = 0;
+  {
+    std::scoped_lock lk{mtx_};
+    if (!send_op_.try_start(my_epoch)) {
+      co_return unexpected(error::busy);
+    }
+    is_connected = (state_ == dgram_state::connected);
+    if (is_connected) {
+      connected_addr = connected_addr_;
+      connected_addr_len = connected_addr_len_;
+    }
+  }
+
+  auto guard = detail::make_scope_exit([this] { send_op_.finish(); });
+
+  if (msgs.empty()) {
+    co_return 0;
+  }
+
+  if (is_connected) {
+    for (auto const& m : msgs) {
+      auto const* dest = static_cast<sockaddr const*>(m.msg_hdr.msg_name);
+      if (dest != nullptr &&
+          !same_destination(dest, m.msg_hdr.msg_namelen,
+                            reinterpret_cast<sockaddr const*>(&connected_addr),
+                            connected_addr_len)) {
+        co_return unexpected(error::invalid_argument);
+      }
+    }
+  }
+
+  // One call takes at most UIO_MAXIOV messages; the caller resubmits whatever was not sent.
+  auto const vlen = static_cast<unsigned int>(std::min<std::size_t>(msgs.size(), UIO_MAXIOV));
+
+  for (;;) {
+    if (!send_op_.is_epoch_current(my_epoch) || res->closing()) {
+      co_return unexpected(error::operation_aborted);
+    }
+
+    int const n = ::sendmmsg(fd, msgs.data(), vlen, detail::socket::send_no_signal_flags());
+    if (n > 0) {
+      co_return static_cast<std::size_t>(n);
+    }
+    int const err = n < 0 ? errno : EAGAIN;
+
+    if (err == EINTR) {
+      continue;
+    }
+    if (err == EAGAIN || err == EWOULDBLOCK) {
+      auto r = co_await base_.wait_write_ready(res);
+      if (!r) {
+        co_return unexpected(r.error());
+      }
+      if (!send_op_.is_epoch_current(my_epoch) || res->closing()) {
+        co_return unexpected(error::operation_aborted);
+      }
+      continue;
+    }
+
+    co_return unexpected(map_socket_errno(err));
+  }
+}
+
+inline auto datagram_socket_impl::async_receive_batch(std::span<mmsghdr> msgs)
+  -> awaitable<result<std::size_t>> {
+  auto res = base_.acquire_resource();
+  if (!res || res->native_handle() < 0) {
+    co_return unexpected(error::not_open);
+  }
+
+  {
+    std::scoped_lock lk{mtx_};
+    if (state_ == dgram_state::idle) {
+      co_return unexpected(error::not_bound);
+    }
+  }
+
+  auto inflight = base_.make_operation_guard(res);
+  if (!inflight) {
+    co_return unexpected(error::operation_aborted);
+  }
+  auto const fd = res->native_handle();
+
+  std::uint64_t my_epoch = 0;
+  {
+    std::scoped_lock lk{mtx_};
+    if (!receive_op_.try_start(my_epoch)) {
+      co_return unexpected(error::busy);
+    }
+  }
+
+  auto guard = detail::make_scope_exit([this] { receive_op_.finish(); });
+
+  if (msgs.empty()) {
+    co_return unexpected(error::invalid_argument);
+  }
+
+  auto const vlen = static_cast<unsigned int>(std::min<std::size_t>(msgs.size(), UIO_MAXIOV));
+
+  for (;;) {
+    if (!receive_op_.is_epoch_current(my_epoch) || res->closing()) {
+      co_return unexpected(error::operation_aborted);
+    }
+
+    // Non-blocking: returns whatever is queued, up to `vlen` datagrams.
+    int const n = ::recvmmsg(fd, msgs.data(), vlen, 0, nullptr);
+    if (n > 0) {
       co_return static_cast<std::size_t>(n);
     }
+    int const err = n < 0 ? errno : EAGAIN;
 
-    if (errno == EINTR) {
+    if (err == EINTR) {
       continue;
     }
-    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+    if (err == EAGAIN || err == EWOULDBLOCK) {
       auto r = co_await base_.wait_read_ready(res);
       if (!r) {
         co_return unexpected(r.error());
@@ -273,7 +526,7 @@ inline auto datagram_socket_impl::async_receive_from(std::span<std::byte> buffer
       continue;
     }
 
-    co_return unexpected(map_socket_errno(errno));
+    co_return unexpected(map_socket_errno(err));
   }
 }
 
@@ -26,7 +26,7 @@ inline auto socket_impl_base::open(int domain, int type, int protocol) noexcept
     return fail(error::internal_error);
   }
 
-  auto res = std::make_shared<fd_resource>(ex_, fd);
+  auto res = std::make_shared<fd_resource>(ex_, fd, ctx_impl_->register_fixed_file(fd));
   res_.store(std::move(res), std::memory_order_release);
   return ok();
 }
@@ -55,7 +55,7 @@ inline auto socket_impl_base::assign(int fd) noexcept -> result<void> {
     return fail(error::internal_error);
   }
 
-  auto res = std::make_shared<fd_resource>(ex_, fd);
+  auto res = std::make_shared<fd_resource>(ex_, fd, ctx_impl_->register_fixed_file(fd));
   {
     std::scoped_lock lk{lifecycle_mtx_};
     res_.store(std::move(res), std::memory_order_release);
@@ -117,6 +117,7 @@ inline auto socket_impl_base::release() noexcept -> result<int> {
 
   old->mark_closing();
   old->cancel_all_handles();
+  old->end_read_stream();
 
   auto fd = old->release_fd();
   if (fd >= 0) {
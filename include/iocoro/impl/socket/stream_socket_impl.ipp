@@ -1,12 +1,60 @@
 #include <iocoro/detail/socket/stream_socket_impl.hpp>
 
+#include <algorithm>
 #include <cerrno>
-
+#include <cstring>
+#include <limits>
+
+#include <fcntl.h>
+#include <linux/errqueue.h>
+#include <netinet/in.h>
+#include <poll.h>
+#include <sys/sendfile.h>
 #include <sys/socket.h>
+#include <sys/uio.h>
 #include <unistd.h>
 
 namespace iocoro::detail::socket {
 
+// Largest transfer of one sendfile(2) / splice call: what Linux caps `count` at anyway, and it
+// fits the 32-bit length of an io_uring splice.
+inline constexpr std::size_t max_splice_size = 0x7ffff000;
+
+// Drain MSG_ZEROCOPY notifications from the error queue of `fd` until one covers send `id`
+// (returns true) or the queue is empty (returns false with `err` set, EAGAIN when merely empty).
+// Notifications for other ids belong to sends whose caller stopped waiting; they are dropped.
+inline auto reap_zerocopy_notifications(int fd, std::uint32_t id, int& err) noexcept -> bool {
+  for (;;) {
+    // Room for one extended error plus the offender address (IPv6 at most).
+    constexpr std::size_t control_size =
+      CMSG_SPACE(sizeof(sock_extended_err) + sizeof(sockaddr_in6));
+    alignas(cmsghdr) std::byte control[control_size];
+    msghdr msg{};
+    msg.msg_control = control;
+    msg.msg_controllen = sizeof(control);
+    if (::recvmsg(fd, &msg, MSG_ERRQUEUE) < 0) {
+      err = errno;
+      return false;
+    }
+    for (auto* cm = CMSG_FIRSTHDR(&msg); cm != nullptr; cm = CMSG_NXTHDR(&msg, cm)) {
+      bool const is_recverr = (cm->cmsg_level == SOL_IP && cm->cmsg_type == IP_RECVERR) ||
+                              (cm->cmsg_level == SOL_IPV6 && cm->cmsg_type == IPV6_RECVERR);
+      if (!is_recverr) {
+        continue;
+      }
+      sock_extended_err ee{};
+      std::memcpy(&ee, CMSG_DATA(cm), sizeof(ee));
+      if (ee.ee_origin != SO_EE_ORIGIN_ZEROCOPY || ee.ee_errno != 0) {
+        continue;
+      }
+      // Completed ids [ee_info, ee_data], inclusive; the counter wraps at 32 bits.
+      if (id - ee.ee_info <= ee.ee_data - ee.ee_info) {
+        return true;
+      }
+    }
+  }
+}
+
 inline void stream_socket_impl::cancel() noexcept {
   read_op_.cancel();
   write_op_.cancel();
@@ -100,6 +148,7 @@ inline auto stream_socket_impl::async_connect(sockaddr const* addr,
 
   auto connect_guard = detail::make_scope_exit([this] { connect_op_.finish(); });
   auto ec = std::error_code{};
+  bool const use_io = base_.completion_io();
 
   for (;;) {
     if (!connect_op_.is_epoch_current(my_epoch) || res->closing()) {
@@ -107,21 +156,42 @@ inline auto stream_socket_impl::async_connect(sockaddr const* addr,
       co_return fail(error::operation_aborted);
     }
 
-    if (::connect(fd, addr, len) == 0) {
+    int err = 0;
+    if (use_io) {
+      auto r = co_await base_.async_io(
+        res,
+        io_request{.op = io_request::opcode::connect,
+                   .addr = const_cast<sockaddr*>(addr),
+                   .connect_len = len},
+        false);
+      if (!r) {
+        state_.store(conn_state::disconnected, std::memory_order_release);
+        co_return fail(r.error());
+      }
+      err = *r < 0 ? -*r : 0;
+    } else if (::connect(fd, addr, len) != 0) {
+      err = errno;
+    }
+
+    if (err == 0 || err == EISCONN) {
+      if (!connect_op_.is_epoch_current(my_epoch) || res->closing()) {
+        state_.store(conn_state::disconnected, std::memory_order_release);
+        co_return fail(error::operation_aborted);
+      }
       state_.store(conn_state::connected, std::memory_order_release);
       co_return ok();
     }
-    if (errno == EINTR) {
+    if (err == EINTR) {
       continue;
     }
-    if (errno == EISCONN) {
-      state_.store(conn_state::connected, std::memory_order_release);
-      co_return ok();
+    if (err == ECANCELED) {
+      state_.store(conn_state::disconnected, std::memory_order_release);
+      co_return fail(error::operation_aborted);
     }
-    if (errno == EINPROGRESS || errno == EALREADY || errno == EAGAIN) {
+    if (err == EINPROGRESS || err == EALREADY || err == EAGAIN) {
       break;
     }
-    ec = map_socket_errno(errno);
+    ec = map_socket_errno(err);
     state_.store(conn_state::disconnected, std::memory_order_release);
     co_return fail(ec);
   }
@@ -190,36 +260,124 @@ inline auto stream_socket_impl::async_read_some(std::span<std::byte> buffer)
     co_return 0;
   }
 
-  for (;;) {
-    if (!read_op_.is_epoch_current(my_epoch) || res->closing()) {
+  bool const use_io = base_.completion_io();
+  auto const fixed = use_io ? base_.fixed_buffer_index(buffer, false) : -1;
+  co_return co_await transfer_some(
+    res, my_epoch, true, use_io,
+    io_request{.op = fixed < 0 ? io_request::opcode::recv : io_request::opcode::read_fixed,
+               .data = buffer.data(),
+               .size = buffer.size(),
+               .buf_index = static_cast<std::uint16_t>(fixed < 0 ? 0 : fixed)},
+    [fd, buffer] { return ::read(fd, buffer.data(), buffer.size()); });
+}
+
+inline auto stream_socket_impl::async_read_some(iovec_batch buffers)
+  -> awaitable<result<std::size_t>> {
+  auto res = base_.acquire_resource();
+  if (!res || res->native_handle() < 0) {
+    co_return unexpected(error::not_open);
+  }
+
+  auto inflight = base_.make_operation_guard(res);
+  if (!inflight) {
+    co_return unexpected(error::operation_aborted);
+  }
+  auto const fd = res->native_handle();
+
+  std::uint64_t my_epoch = 0;
+  if (state_.load(std::memory_order_acquire) != conn_state::connected) {
+    co_return unexpected(error::not_connected);
+  }
+  if (shutdown_.read.load(std::memory_order_acquire)) {
+    co_return 0;
+  }
+  if (!read_op_.try_start(my_epoch)) {
+    co_return unexpected(error::busy);
+  }
+
+  auto guard = detail::make_scope_exit([this] { read_op_.finish(); });
+
+  if (buffers.total == 0) {
+    co_return 0;
+  }
+
+  bool const use_io = base_.completion_io(io_request::opcode::recvmsg);
+  // Completion model: IORING_OP_RECV takes a single buffer, so scatter reads go through recvmsg.
+  msghdr msg{};
+  msg.msg_iov = buffers.iov.data();
+  msg.msg_iovlen = buffers.count;
+  co_return co_await transfer_some(
+    res, my_epoch, true, use_io, io_request{.op = io_request::opcode::recvmsg, .msg = &msg},
+    [fd, &buffers] { return ::readv(fd, buffers.iov.data(), static_cast<int>(buffers.count)); });
+}
+
+inline auto stream_socket_impl::async_receive_buffer() -> awaitable<result<received_buffer>> {
+  if (base_.multishot_io()) {
+    auto res = base_.acquire_resource();
+    if (!res || res->native_handle() < 0) {
+      co_return unexpected(error::not_open);
+    }
+
+    auto inflight = base_.make_operation_guard(res);
+    if (!inflight) {
       co_return unexpected(error::operation_aborted);
     }
 
-    auto n = ::read(fd, buffer.data(), buffer.size());
-    if (n > 0) {
-      co_return n;
+    std::uint64_t my_epoch = 0;
+    if (state_.load(std::memory_order_acquire) != conn_state::connected) {
+      co_return unexpected(error::not_connected);
     }
-    if (n == 0) {
-      co_return 0;
+    if (shutdown_.read.load(std::memory_order_acquire)) {
+      co_return received_buffer{};
     }
-    if (errno == EINTR) {
-      continue;
+    if (!read_op_.try_start(my_epoch)) {
+      co_return unexpected(error::busy);
     }
-    if (errno == EAGAIN || errno == EWOULDBLOCK) {
-      auto r = co_await base_.wait_read_ready(res);
+
+    auto guard = detail::make_scope_exit([this] { read_op_.finish(); });
+
+    for (;;) {
+      if (!read_op_.is_epoch_current(my_epoch) || res->closing()) {
+        co_return unexpected(error::operation_aborted);
+      }
+      auto r = co_await base_.async_multishot(
+        res, multishot_stream::kind::recv, provided_buffer_count,
+        io_request{.op = io_request::opcode::recv_multishot});
       if (!r) {
-        if (r.error() == error::eof) {
-          co_return 0;
-        }
         co_return unexpected(r.error());
       }
-      if (!read_op_.is_epoch_current(my_epoch) || res->closing()) {
+      auto const it = *r;
+      if (it.res > 0 && it.buffer != no_provided_buffer) {
+        auto ctx = base_.get_io_context_impl()->shared_from_this();
+        co_return received_buffer{std::move(ctx), it.buffer, static_cast<std::size_t>(it.res)};
+      }
+      if (it.res == 0) {
+        co_return received_buffer{};
+      }
+      int const err = -it.res;
+      if (err == EINTR || err == EAGAIN) {
+        continue;
+      }
+      if (err == ECANCELED) {
         co_return unexpected(error::operation_aborted);
       }
-      continue;
+      if (err == ENOBUFS || err == EINVAL) {
+        // Ring exhausted, or multishot receive rejected: one plain read below.
+        break;
+      }
+      co_return unexpected(map_socket_errno(err));
     }
-    co_return unexpected(map_socket_errno(errno));
   }
+
+  auto storage = std::make_unique_for_overwrite<std::byte[]>(provided_buffer_size);
+  auto n = co_await async_read_some(std::span{storage.get(), provided_buffer_size});
+  if (!n) {
+    co_return unexpected(n.error());
+  }
+  if (*n == 0) {
+    co_return received_buffer{};
+  }
+  co_return received_buffer{std::move(storage), *n};
 }
 
 inline auto stream_socket_impl::async_write_some(std::span<std::byte const> buffer)
@@ -252,20 +410,158 @@ inline auto stream_socket_impl::async_write_some(std::span<std::byte const> buff
     co_return 0;
   }
 
+  bool const use_io = base_.completion_io();
+  auto const fixed = use_io ? base_.fixed_buffer_index(buffer, true) : -1;
+  co_return co_await transfer_some(
+    res, my_epoch, false, use_io,
+    io_request{.op = fixed < 0 ? io_request::opcode::send : io_request::opcode::write_fixed,
+               .data = const_cast<std::byte*>(buffer.data()),
+               .size = buffer.size(),
+               .buf_index = static_cast<std::uint16_t>(fixed < 0 ? 0 : fixed),
+               .flags = detail::socket::send_no_signal_flags()},
+    [fd, buffer] {
+      return ::send(fd, buffer.data(), buffer.size(), detail::socket::send_no_signal_flags());
+    });
+}
+
+inline auto stream_socket_impl::async_write_some(iovec_batch buffers)
+  -> awaitable<result<std::size_t>> {
+  auto res = base_.acquire_resource();
+  if (!res || res->native_handle() < 0) {
+    co_return unexpected(error::not_open);
+  }
+
+  auto inflight = base_.make_operation_guard(res);
+  if (!inflight) {
+    co_return unexpected(error::operation_aborted);
+  }
+  auto const fd = res->native_handle();
+
+  std::uint64_t my_epoch = 0;
+  if (state_.load(std::memory_order_acquire) != conn_state::connected) {
+    co_return unexpected(error::not_connected);
+  }
+  if (shutdown_.write.load(std::memory_order_acquire)) {
+    co_return unexpected(error::broken_pipe);
+  }
+  if (!write_op_.try_start(my_epoch)) {
+    co_return unexpected(error::busy);
+  }
+
+  auto guard = detail::make_scope_exit([this] { write_op_.finish(); });
+
+  if (buffers.total == 0) {
+    co_return 0;
+  }
+
+  bool const use_io = base_.completion_io(io_request::opcode::sendmsg);
+  // sendmsg rather than writev: it takes MSG_NOSIGNAL, so a closed peer cannot raise SIGPIPE.
+  msghdr msg{};
+  msg.msg_iov = buffers.iov.data();
+  msg.msg_iovlen = buffers.count;
+  co_return co_await transfer_some(
+    res, my_epoch, false, use_io,
+    io_request{.op = io_request::opcode::sendmsg,
+               .flags = detail::socket::send_no_signal_flags(),
+               .msg = &msg},
+    [fd, &msg] { return ::sendmsg(fd, &msg, detail::socket::send_no_signal_flags()); });
+}
+
+inline auto stream_socket_impl::async_write_some_zerocopy(std::span<std::byte const> buffer)
+  -> awaitable<result<std::size_t>> {
+  auto res = base_.acquire_resource();
+  if (!res || res->native_handle() < 0) {
+    co_return unexpected(error::not_open);
+  }
+
+  auto inflight = base_.make_operation_guard(res);
+  if (!inflight) {
+    co_return unexpected(error::operation_aborted);
+  }
+  auto const fd = res->native_handle();
+
+  std::uint64_t my_epoch = 0;
+  if (state_.load(std::memory_order_acquire) != conn_state::connected) {
+    co_return unexpected(error::not_connected);
+  }
+  if (shutdown_.write.load(std::memory_order_acquire)) {
+    co_return unexpected(error::broken_pipe);
+  }
+  if (!write_op_.try_start(my_epoch)) {
+    co_return unexpected(error::busy);
+  }
+
+  auto guard = detail::make_scope_exit([this] { write_op_.finish(); });
+
+  if (buffer.empty()) {
+    co_return 0;
+  }
+
+  using zc_mode = fd_resource::zerocopy_state::mode;
+  auto& zc = res->zerocopy();
+  bool const use_io = base_.completion_io(io_request::opcode::send_zc);
+  if (zc.state == zc_mode::unknown) {
+    // SEND_ZC needs no socket option. MSG_ZEROCOPY does; without it the flag is ignored and no
+    // notification would ever come.
+    int const one = 1;
+    if (use_io) {
+      zc.state = zc_mode::enabled;
+    } else if (::setsockopt(fd, SOL_SOCKET, SO_ZEROCOPY, &one, sizeof(one)) == 0) {
+      base_.watch_error_queue(res);
+      zc.state = zc_mode::enabled;
+    } else {
+      zc.state = zc_mode::unsupported;
+    }
+  }
+
+  ssize_t n = 0;
   for (;;) {
     if (!write_op_.is_epoch_current(my_epoch) || res->closing()) {
       co_return unexpected(error::operation_aborted);
     }
 
-    // On Linux, ::write() can raise SIGPIPE for closed peers.
-    auto n = ::send(fd, buffer.data(), buffer.size(), detail::socket::send_no_signal_flags());
-    if (n >= 0) {
-      co_return n;
+    bool const zerocopy = zc.state == zc_mode::enabled;
+    int err = 0;
+    if (use_io) {
+      auto r = co_await base_.async_io(
+        res,
+        io_request{.op = zerocopy ? io_request::opcode::send_zc : io_request::opcode::send,
+                   .data = const_cast<std::byte*>(buffer.data()),
+                   .size = buffer.size(),
+                   .flags = detail::socket::send_no_signal_flags()},
+        false);
+      if (!r) {
+        co_return unexpected(r.error());
+      }
+      n = *r < 0 ? -1 : *r;
+      err = *r < 0 ? -*r : 0;
+      // Kernels or sockets without SEND_ZC: send a copy instead, from now on.
+      if (zerocopy && (err == EOPNOTSUPP || err == EINVAL)) {
+        zc.state = zc_mode::unsupported;
+        continue;
+      }
+      // The backend reports SEND_ZC only with its notification: the buffer is free again.
+      if (n >= 0) {
+        co_return n;
+      }
+    } else {
+      int const flags = detail::socket::send_no_signal_flags() | (zerocopy ? MSG_ZEROCOPY : 0);
+      n = ::send(fd, buffer.data(), buffer.size(), flags);
+      err = n < 0 ? errno : 0;
+      if (n >= 0 && !zerocopy) {
+        co_return n;
+      }
+      if (n >= 0) {
+        break;
+      }
     }
-    if (errno == EINTR) {
+    if (err == EINTR) {
       continue;
     }
-    if (errno == EAGAIN || errno == EWOULDBLOCK) {
+    if (err == ECANCELED) {
+      co_return unexpected(error::operation_aborted);
+    }
+    if (err == EAGAIN || err == EWOULDBLOCK) {
       auto r = co_await base_.wait_write_ready(res);
       if (!r) {
         co_return unexpected(r.error());
@@ -275,7 +571,294 @@ inline auto stream_socket_impl::async_write_some(std::span<std::byte const> buff
       }
       continue;
     }
-    co_return unexpected(map_socket_errno(errno));
+    co_return unexpected(map_socket_errno(err));
+  }
+
+  // The kernel still references `buffer` until the notification for this send arrives; only
+  // close() may end the wait.
+  auto const id = zc.next_id++;
+  for (;;) {
+    int err = 0;
+    if (reap_zerocopy_notifications(fd, id, err)) {
+      co_return n;
+    }
+    if (err == EINTR) {
+      continue;
+    }
+    if (err != EAGAIN && err != EWOULDBLOCK) {
+      co_return unexpected(map_socket_errno(err));
+    }
+    auto r = co_await base_.wait_error_ready(res);
+    if (res->closing()) {
+      co_return unexpected(error::operation_aborted);
+    }
+    if (!r && r.error() != error::operation_aborted) {
+      co_return unexpected(r.error());
+    }
+  }
+}
+
+inline auto stream_socket_impl::async_sendfile_some(int file_fd, std::uint64_t offset,
+                                                    std::size_t count)
+  -> awaitable<result<std::size_t>> {
+  auto res = base_.acquire_resource();
+  if (!res || res->native_handle() < 0) {
+    co_return unexpected(error::not_open);
+  }
+
+  auto inflight = base_.make_operation_guard(res);
+  if (!inflight) {
+    co_return unexpected(error::operation_aborted);
+  }
+  auto const fd = res->native_handle();
+
+  std::uint64_t my_epoch = 0;
+  if (state_.load(std::memory_order_acquire) != conn_state::connected) {
+    co_return unexpected(error::not_connected);
+  }
+  if (shutdown_.write.load(std::memory_order_acquire)) {
+    co_return unexpected(error::broken_pipe);
+  }
+  if (!write_op_.try_start(my_epoch)) {
+    co_return unexpected(error::busy);
+  }
+
+  auto guard = detail::make_scope_exit([this] { write_op_.finish(); });
+
+  if (file_fd < 0 || offset > static_cast<std::uint64_t>(std::numeric_limits<off_t>::max())) {
+    co_return unexpected(error::invalid_argument);
+  }
+  if (count == 0) {
+    co_return 0;
+  }
+  count = (std::min)(count, max_splice_size);
+
+  if (base_.completion_io(io_request::opcode::splice)) {
+    if (!sendfile_pipe_.is_open()) {
+      auto pipe = pipe_pair::open(count);
+      if (!pipe) {
+        co_return unexpected(pipe.error());
+      }
+      sendfile_pipe_ = std::move(*pipe);
+    } else {
+      sendfile_pipe_.reserve(count);
+    }
+    // The pipe is empty between calls; whatever goes wrong while it holds bytes discards it
+    // (its content is unknown after a failed or aborted splice), and the next call opens a new
+    // one. Nothing is lost: only what reached the socket is reported.
+    auto discard = detail::make_scope_exit([this] { sendfile_pipe_.reset(); });
+
+    auto filled = co_await splice_some(res, my_epoch, false, true, file_fd,
+                                       sendfile_pipe_.write_fd(),
+                                       static_cast<std::int64_t>(offset), count);
+    if (!filled || *filled == 0) {
+      co_return filled;
+    }
+    std::size_t sent = 0;
+    while (sent < *filled) {
+      auto n = co_await splice_some(res, my_epoch, false, true, sendfile_pipe_.read_fd(), -1,
+                                    -1, *filled - sent);
+      if (!n) {
+        if (sent != 0) {
+          co_return sent;
+        }
+        co_return n;
+      }
+      if (*n == 0) {
+        co_return sent;
+      }
+      sent += *n;
+    }
+    discard.release();
+    co_return sent;
+  }
+
+  co_return co_await transfer_some(res, my_epoch, false, false, io_request{},
+                                   [fd, file_fd, offset, count, block = !sigpipe_ignored()] {
+                                     auto off = static_cast<off_t>(offset);
+                                     sigpipe_block guard{block};
+                                     auto const n = ::sendfile(fd, file_fd, &off, count);
+                                     if (n < 0) {
+                                       guard.failed(errno);
+                                     }
+                                     return n;
+                                   });
+}
+
+inline auto stream_socket_impl::async_splice_read_some(int pipe_fd, std::size_t count)
+  -> awaitable<result<std::size_t>> {
+  auto res = base_.acquire_resource();
+  if (!res || res->native_handle() < 0) {
+    co_return unexpected(error::not_open);
+  }
+
+  auto inflight = base_.make_operation_guard(res);
+  if (!inflight) {
+    co_return unexpected(error::operation_aborted);
+  }
+
+  std::uint64_t my_epoch = 0;
+  if (state_.load(std::memory_order_acquire) != conn_state::connected) {
+    co_return unexpected(error::not_connected);
+  }
+  if (shutdown_.read.load(std::memory_order_acquire)) {
+    co_return 0;
+  }
+  if (!read_op_.try_start(my_epoch)) {
+    co_return unexpected(error::busy);
+  }
+
+  auto guard = detail::make_scope_exit([this] { read_op_.finish(); });
+
+  if (pipe_fd < 0) {
+    co_return unexpected(error::invalid_argument);
+  }
+  if (count == 0) {
+    co_return 0;
+  }
+  bool const use_io = base_.completion_io(io_request::opcode::splice);
+  co_return co_await splice_some(res, my_epoch, true, use_io, -1, pipe_fd, -1,
+                                 (std::min)(count, max_splice_size));
+}
+
+inline auto stream_socket_impl::async_splice_write_some(int pipe_fd, std::size_t count)
+  -> awaitable<result<std::size_t>> {
+  auto res = base_.acquire_resource();
+  if (!res || res->native_handle() < 0) {
+    co_return unexpected(error::not_open);
+  }
+
+  auto inflight = base_.make_operation_guard(res);
+  if (!inflight) {
+    co_return unexpected(error::operation_aborted);
+  }
+
+  std::uint64_t my_epoch = 0;
+  if (state_.load(std::memory_order_acquire) != conn_state::connected) {
+    co_return unexpected(error::not_connected);
+  }
+  if (shutdown_.write.load(std::memory_order_acquire)) {
+    co_return unexpected(error::broken_pipe);
+  }
+  if (!write_op_.try_start(my_epoch)) {
+    co_return unexpected(error::busy);
+  }
+
+  auto guard = detail::make_scope_exit([this] { write_op_.finish(); });
+
+  if (pipe_fd < 0) {
+    co_return unexpected(error::invalid_argument);
+  }
+  if (count == 0) {
+    co_return 0;
+  }
+  bool const use_io = base_.completion_io(io_request::opcode::splice);
+  co_return co_await splice_some(res, my_epoch, false, use_io, pipe_fd, -1, -1,
+                                 (std::min)(count, max_splice_size));
+}
+
+inline auto stream_socket_impl::sigpipe_ignored() const noexcept -> bool {
+  auto state = sigpipe_state_.load(std::memory_order_relaxed);
+  if (state == sigpipe_unknown) {
+    // Racing first calls (one per side) both look it up; they store the same answer.
+    state = socket::sigpipe_ignored() ? sigpipe_ignored_state : sigpipe_raised_state;
+    sigpipe_state_.store(state, std::memory_order_relaxed);
+  }
+  return state == sigpipe_ignored_state;
+}
+
+inline auto stream_socket_impl::splice_some(std::shared_ptr<fd_resource> const& res,
+                                            std::uint64_t epoch, bool is_read, bool use_io,
+                                            int in, int out, std::int64_t in_offset,
+                                            std::size_t count) -> awaitable<result<std::size_t>> {
+  auto const fd = res->native_handle();
+  co_return co_await transfer_some(res, epoch, is_read, use_io,
+                                   io_request{.op = io_request::opcode::splice,
+                                              .size = count,
+                                              .flags = SPLICE_F_MOVE,
+                                              .splice_in = in,
+                                              .splice_out = out,
+                                              .splice_in_offset = in_offset},
+                                   [fd, in, out, in_offset, count,
+                                    block = !use_io && !sigpipe_ignored()] {
+                                     loff_t off = in_offset;
+                                     sigpipe_block guard{block};
+                                     auto const n = ::splice(in < 0 ? fd : in,
+                                                             in_offset < 0 ? nullptr : &off,
+                                                             out < 0 ? fd : out, nullptr, count,
+                                                             SPLICE_F_MOVE | SPLICE_F_NONBLOCK);
+                                     if (n < 0) {
+                                       guard.failed(errno);
+                                     }
+                                     return n;
+                                   },
+                                   out >= 0 ? pollfd{.fd = out, .events = POLLOUT, .revents = 0}
+                                            : pollfd{.fd = in, .events = POLLIN, .revents = 0});
+}
+
+template <typename Syscall>
+inline auto stream_socket_impl::transfer_some(std::shared_ptr<fd_resource> const& res,
+                                              std::uint64_t epoch, bool is_read, bool use_io,
+                                              io_request req, Syscall syscall, pollfd pipe)
+  -> awaitable<result<std::size_t>> {
+  auto& op = is_read ? read_op_ : write_op_;
+
+  for (;;) {
+    if (!op.is_epoch_current(epoch) || res->closing()) {
+      co_return unexpected(error::operation_aborted);
+    }
+
+    ssize_t n = 0;
+    int err = 0;
+    if (use_io) {
+      auto r = co_await base_.async_io(res, req, is_read);
+      if (!r) {
+        co_return unexpected(r.error());
+      }
+      n = *r < 0 ? -1 : *r;
+      err = *r < 0 ? -*r : 0;
+      // `close()` shuts the socket down before cancelling, so a receive still in the kernel
+      // ends with end-of-stream rather than -ECANCELED.
+      if (n == 0 && is_read && (!op.is_epoch_current(epoch) || res->closing())) {
+        co_return unexpected(error::operation_aborted);
+      }
+    } else {
+      n = syscall();
+      err = n < 0 ? errno : 0;
+    }
+    if (n >= 0) {
+      co_return n;
+    }
+    if (err == EINTR) {
+      continue;
+    }
+    if (err == ECANCELED) {
+      co_return unexpected(error::operation_aborted);
+    }
+    if (err == EAGAIN || err == EWOULDBLOCK) {
+      // SPLICE_F_NONBLOCK also reports a full (or empty) pipe as EAGAIN. The socket would most
+      // likely be reported ready right away, so waiting on it would only spin.
+      if (pipe.fd >= 0 && ::poll(&pipe, 1, 0) == 0) {
+        co_return unexpected(map_socket_errno(EAGAIN));
+      }
+      result<void> r{};
+      if (is_read) {
+        r = co_await base_.wait_read_ready(res);
+      } else {
+        r = co_await base_.wait_write_ready(res);
+      }
+      if (!r) {
+        if (is_read && r.error() == error::eof) {
+          co_return 0;
+        }
+        co_return unexpected(r.error());
+      }
+      if (!op.is_epoch_current(epoch) || res->closing()) {
+        co_return unexpected(error::operation_aborted);
+      }
+      continue;
+    }
+    co_return unexpected(map_socket_errno(err));
   }
 }
 
@@ -2,7 +2,10 @@
 
 #include <iocoro/detail/executor_guard.hpp>
 
+#include <algorithm>
 #include <exception>
+#include <memory>
+#include <vector>
 
 namespace iocoro {
 
@@ -28,48 +31,261 @@ inline void thread_pool::set_exception_handler(exception_handler_t handler) noex
   }
 }
 
-inline void thread_pool::worker_loop(std::shared_ptr<shared_state> state, std::size_t /*index*/) {
+inline thread_pool::shared_state::shared_state(std::size_t n_threads) {
+  workers.reserve(n_threads);
+  for (std::size_t i = 0; i < n_threads; ++i) {
+    auto w = std::make_unique<worker>();
+    w->owner = this;
+    w->rng = static_cast<std::uint32_t>(i) * 0x9e3779b9U + 1U;
+    workers.push_back(std::move(w));
+  }
+}
+
+inline thread_pool::shared_state::~shared_state() {
+  // No worker is running any more; whatever is still queued was never started.
+  for (auto& w : workers) {
+    while (auto* t = w->local.take()) {
+      delete t;
+    }
+  }
+  for (auto* t : inject) {
+    delete t;
+  }
+}
+
+inline void thread_pool::shared_state::post(detail::unique_function<void()> f) {
+  if (state.load(std::memory_order_acquire) != state_t::running) {
+    return;
+  }
+
+  auto t = std::make_unique<task>(std::move(f));
+  auto* self = current_worker_;
+  if (self != nullptr && self->owner == this && self->local.push(t.get())) {
+    t.release();
+  } else {
+    std::scoped_lock lock{inject_mutex};
+    inject.push_back(t.get());
+    t.release();
+    inject_size.fetch_add(1, std::memory_order_release);
+  }
+  wake_one_if_idle();
+}
+
+inline void thread_pool::shared_state::post_bulk(std::span<detail::unique_function<void()>> fs) {
+  if (fs.empty() || state.load(std::memory_order_acquire) != state_t::running) {
+    return;
+  }
+
+  std::vector<std::unique_ptr<task>> tasks;
+  tasks.reserve(fs.size());
+  for (auto& f : fs) {
+    tasks.push_back(std::make_unique<task>(std::move(f)));
+  }
+
+  std::size_t i = 0;
+  auto* self = current_worker_;
+  if (self != nullptr && self->owner == this) {
+    for (; i < tasks.size() && self->local.push(tasks[i].get()); ++i) {
+      (void)tasks[i].release();
+    }
+  }
+  if (i < tasks.size()) {
+    std::scoped_lock lock{inject_mutex};
+    for (; i < tasks.size(); ++i) {
+      inject.push_back(tasks[i].get());
+      (void)tasks[i].release();
+      inject_size.fetch_add(1, std::memory_order_release);
+    }
+  }
+  wake_one_if_idle();
+}
+
+inline auto thread_pool::shared_state::next_task(worker& self) -> task* {
+  // Own work comes newest first (no CAS unless a thief contends for the last task). Every
+  // `fifo_interval`-th local task is the oldest instead, so a task that keeps re-posting itself
+  // cannot hold back the work queued before it.
+  constexpr std::uint32_t fifo_interval = 64;
+  if (++self.lifo_streak >= fifo_interval) {
+    self.lifo_streak = 0;
+    if (auto* t = self.local.take()) {
+      return t;
+    }
+  }
+  if (auto* t = self.local.pop()) {
+    return t;
+  }
+  if (auto* t = take_injected(self)) {
+    return t;
+  }
+  return steal(self);
+}
+
+inline auto thread_pool::shared_state::take_injected(worker& self) -> task* {
+  if (inject_size.load(std::memory_order_acquire) == 0) {
+    return nullptr;
+  }
+  std::scoped_lock lock{inject_mutex};
+  if (inject.empty()) {
+    return nullptr;
+  }
+  auto* first = inject.front();
+  inject.pop_front();
+
+  // Move this worker's share of the backlog into its own queue, where the others can steal it,
+  // instead of coming back to the lock for every task.
+  auto batch = (std::min)(inject.size() / workers.size(), decltype(worker::local)::capacity / 2);
+  std::size_t moved = 0;
+  while (moved < batch && self.local.push(inject.front())) {
+    inject.pop_front();
+    ++moved;
+  }
+  inject_size.fetch_sub(moved + 1, std::memory_order_release);
+  return first;
+}
+
+inline auto thread_pool::shared_state::steal(worker& self) -> task* {
+  auto const n = workers.size();
+  if (n < 2) {
+    return nullptr;
+  }
+  // xorshift32: a random starting victim spreads thieves across the pool.
+  self.rng ^= self.rng << 13;
+  self.rng ^= self.rng >> 17;
+  self.rng ^= self.rng << 5;
+  auto const start = static_cast<std::size_t>(self.rng) % n;
+  for (std::size_t i = 0; i < n; ++i) {
+    auto& victim = *workers[(start + i) % n];
+    if (&victim == &self) {
+      continue;
+    }
+    if (auto* t = victim.local.take()) {
+      return t;
+    }
+  }
+  return nullptr;
+}
+
+inline auto thread_pool::shared_state::has_work() const noexcept -> bool {
+  if (inject_size.load(std::memory_order_seq_cst) != 0) {
+    return true;
+  }
+  for (auto const& w : workers) {
+    if (!w->local.empty()) {
+      return true;
+    }
+  }
+  return false;
+}
+
+inline auto thread_pool::shared_state::should_exit() const noexcept -> bool {
+  return state.load(std::memory_order_acquire) != state_t::running && work_guard.count() == 0;
+}
+
+inline auto thread_pool::shared_state::park() -> park_result {
+  std::unique_lock lock{park_mutex};
+  // Announce the sleeper before re-checking the queues: a post either sees it (and wakes it) or
+  // happened early enough for the re-check to find the task.
+  sleeping.fetch_add(1, std::memory_order_seq_cst);
+  if (has_work()) {
+    sleeping.fetch_sub(1, std::memory_order_relaxed);
+    return park_result::retry;
+  }
+  if (should_exit()) {
+    sleeping.fetch_sub(1, std::memory_order_relaxed);
+    return park_result::exit;
+  }
+
+  park_cv.wait(lock, [&] { return wake_tokens != 0 || should_exit(); });
+  if (wake_tokens != 0) {
+    // The waker already moved this worker from `sleeping` to `searching`.
+    --wake_tokens;
+    return park_result::woken;
+  }
+  sleeping.fetch_sub(1, std::memory_order_relaxed);
+  return park_result::retry;
+}
+
+inline void thread_pool::shared_state::wake_one_if_idle() {
+  // Pairs with the announcement in `park()`. A worker that is already searching will find the
+  // task (or, if it finds another one first, pass the wakeup on), so do not wake a second one.
+  std::atomic_thread_fence(std::memory_order_seq_cst);
+  if (searching.load(std::memory_order_seq_cst) != 0 ||
+      sleeping.load(std::memory_order_seq_cst) == 0) {
+    return;
+  }
+  {
+    std::scoped_lock lock{park_mutex};
+    if (searching.load(std::memory_order_relaxed) != 0 ||
+        sleeping.load(std::memory_order_relaxed) == 0) {
+      return;
+    }
+    sleeping.fetch_sub(1, std::memory_order_relaxed);
+    searching.fetch_add(1, std::memory_order_seq_cst);
+    ++wake_tokens;
+  }
+  park_cv.notify_one();
+}
+
+inline void thread_pool::shared_state::wake_all() {
+  // Taking the lock orders the state change before any sleeper's predicate check.
+  { std::scoped_lock lock{park_mutex}; }
+  park_cv.notify_all();
+}
+
+inline void thread_pool::shared_state::run(task* t) noexcept {
+  std::unique_ptr<task> owned{t};
+  try {
+    owned->fn();
+  } catch (...) {
+    auto handler_ptr = on_task_exception.load(std::memory_order_acquire);
+    if (handler_ptr) {
+      try {
+        (*handler_ptr)(std::current_exception());
+      } catch (...) {
+        // Swallow exceptions from handler to prevent thread termination
+      }
+    }
+  }
+}
+
+inline void thread_pool::worker_loop(std::shared_ptr<shared_state> state, std::size_t index) {
   IOCORO_ENSURE(state != nullptr, "thread_pool::worker_loop: empty state");
 
+  auto& self = *state->workers[index];
+  current_worker_ = &self;
+  detail::executor_guard pool_guard{executor_type{state}};
+
+  bool searching = false;
   while (true) {
-    detail::unique_function<void()> task;
-
-    {
-      std::unique_lock lock{state->cv_mutex};
-      ++state->waiting_workers;
-      state->cv.wait(lock, [&] {
-        return !state->queue.empty() ||
-               (state->state == state_t::draining && state->work_guard.count() == 0);
-      });
-      --state->waiting_workers;
-
-      if (state->queue.empty()) {
-        IOCORO_ASSERT(state->state == state_t::draining && state->work_guard.count() == 0);
+    auto* t = state->next_task(self);
+    if (t == nullptr) {
+      if (searching) {
+        searching = false;
+        state->searching.fetch_sub(1, std::memory_order_seq_cst);
+      }
+      auto const r = state->park();
+      if (r == park_result::exit) {
         break;
       }
-
-      task = std::move(state->queue.front());
-      state->queue.pop_front();
+      searching = (r == park_result::woken);
+      continue;
     }
 
-    try {
-      detail::executor_guard pool_guard{executor_type{state}};
-      task();
-    } catch (...) {
-      auto handler_ptr = state->on_task_exception.load(std::memory_order_acquire);
-      if (handler_ptr) {
-        try {
-          (*handler_ptr)(std::current_exception());
-        } catch (...) {
-          // Swallow exceptions from handler to prevent thread termination
-        }
+    // The last searcher to find work hands the search on if more is queued.
+    if (searching) {
+      searching = false;
+      if (state->searching.fetch_sub(1, std::memory_order_seq_cst) == 1 && state->has_work()) {
+        state->wake_one_if_idle();
       }
     }
+    state->run(t);
   }
+
+  current_worker_ = nullptr;
 }
 
 inline thread_pool::thread_pool(std::size_t n_threads)
-    : state_(std::make_shared<shared_state>()), n_threads_{n_threads} {
+    : state_(std::make_shared<shared_state>(n_threads)), n_threads_{n_threads} {
   IOCORO_ENSURE(n_threads > 0, "thread_pool: n_threads must be > 0");
 
   threads_.reserve(n_threads_);
@@ -88,13 +304,9 @@ inline void thread_pool::stop() noexcept {
   if (!st) {
     return;
   }
-  {
-    std::scoped_lock lock{st->cv_mutex};
-    if (st->state == state_t::running) {
-      st->state = state_t::draining;
-    }
-  }
-  st->cv.notify_all();
+  auto expected = state_t::running;
+  (void)st->state.compare_exchange_strong(expected, state_t::draining, std::memory_order_acq_rel);
+  st->wake_all();
 }
 
 inline void thread_pool::join() noexcept {
@@ -108,10 +320,7 @@ inline void thread_pool::join() noexcept {
   if (!st) {
     return;
   }
-  {
-    std::scoped_lock lock{st->cv_mutex};
-    st->state = state_t::stopped;
-  }
+  st->state.store(state_t::stopped, std::memory_order_release);
 }
 
 }  // namespace iocoro
@@ -53,4 +53,41 @@ template <async_read_stream Stream>
   return async_read(s, buf.as_span());
 }
 
+/// Composed operation: fill every buffer of the sequence `buffers`, in order.
+///
+/// On a stream with a scatter-read primitive (`async_scatter_read_stream`) each step hands the
+/// remaining buffers to one `async_read_some` call; other streams get one buffer per step.
+/// End of stream before the sequence is full is reported as `error::eof`.
+///
+/// IMPORTANT - Buffer Lifetime: as above; this also applies to the sequence object itself.
+template <async_read_stream Stream, net::mutable_buffer_sequence Buffers>
+[[nodiscard]] auto async_read(Stream& s,
+                              Buffers const& buffers) -> awaitable<result<std::size_t>> {
+  net::detail::consuming_buffers<net::mutable_buffer, Buffers> rest{buffers};
+  std::size_t filled = 0;
+
+  while (!rest.empty()) {
+    auto const bufs = rest.prepare();
+    result<std::size_t> r{};
+    if constexpr (async_scatter_read_stream<Stream>) {
+      r = co_await s.async_read_some(bufs);
+    } else {
+      r = co_await s.async_read_some(bufs.front().as_span());
+    }
+    if (!r) {
+      co_return r;
+    }
+
+    auto const n = *r;
+    if (n == 0) {  // EOF
+      co_return unexpected(error::eof);
+    }
+
+    rest.consume(n);
+    filled += n;
+  }
+
+  co_return filled;
+}
+
 }  // namespace iocoro::io
@@ -0,0 +1,46 @@
+#pragma once
+
+#include <iocoro/awaitable.hpp>
+#include <iocoro/error.hpp>
+#include <iocoro/io/stream_concepts.hpp>
+#include <iocoro/result.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <system_error>
+
+namespace iocoro::io {
+
+/// Composed operation: send exactly `count` bytes of the file `file_fd`, starting at `offset`.
+///
+/// Notes:
+/// - This is an algorithm layered on top of the Stream's `async_sendfile_some` primitive; the
+///   bytes go from the page cache to the socket without a copy through user space.
+/// - The file position of `file_fd` is neither used nor changed, so one open file may feed
+///   several streams at once.
+/// - If the file ends before `count` bytes were sent, this returns `error::eof`.
+/// - On error the number of bytes already sent is not reported; resend the whole range (or
+///   drive `async_sendfile_some` directly) if that matters.
+template <async_sendfile_stream Stream>
+[[nodiscard]] auto async_sendfile(Stream& s, int file_fd, std::uint64_t offset,
+                                  std::size_t count) -> awaitable<result<std::size_t>> {
+  std::size_t sent = 0;
+
+  while (sent < count) {
+    auto r = co_await s.async_sendfile_some(file_fd, offset + sent, count - sent);
+    if (!r) {
+      co_return r;
+    }
+
+    auto const n = *r;
+    if (n == 0) {
+      co_return unexpected(error::eof);
+    }
+
+    sent += n;
+  }
+
+  co_return sent;
+}
+
+}  // namespace iocoro::io
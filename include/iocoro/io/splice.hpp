@@ -0,0 +1,67 @@
+#pragma once
+
+#include <iocoro/awaitable.hpp>
+#include <iocoro/error.hpp>
+#include <iocoro/io/stream_concepts.hpp>
+#include <iocoro/result.hpp>
+
+#include <iocoro/detail/socket/pipe_pair.hpp>
+
+#include <algorithm>
+#include <cstddef>
+#include <limits>
+#include <system_error>
+
+namespace iocoro::io {
+
+/// Composed operation: forward bytes from `from` to `to` until `count` bytes were moved or
+/// `from` reaches end of stream; returns the number of bytes forwarded.
+///
+/// Notes:
+/// - The bytes travel through a pipe private to this operation (splice(2)), never through
+///   user space: one pass per chunk of up to 1 MiB instead of a read and a write of a buffer.
+/// - Uses the read side of `from` and the write side of `to`. A full-duplex proxy runs two of
+///   these at once, one per direction.
+/// - End of stream on `from` is not an error; the caller decides whether to shut down `to`.
+/// - If `to` stops accepting bytes (a zero-length splice) this returns `error::broken_pipe`.
+///   Bytes already taken from `from` but not yet sent when an error occurs are lost.
+template <async_splice_stream From, async_splice_stream To>
+[[nodiscard]] auto async_splice(From& from, To& to,
+                                std::size_t count = (std::numeric_limits<std::size_t>::max)())
+  -> awaitable<result<std::size_t>> {
+  auto pipe = ::iocoro::detail::socket::pipe_pair::open(
+    (std::min)(count, ::iocoro::detail::socket::pipe_pair::max_capacity));
+  if (!pipe) {
+    co_return unexpected(pipe.error());
+  }
+
+  std::size_t moved = 0;
+  while (moved < count) {
+    auto r = co_await from.async_splice_read_some(pipe->write_fd(), count - moved);
+    if (!r) {
+      co_return unexpected(r.error());
+    }
+    if (*r == 0) {
+      break;
+    }
+
+    // Empty the pipe before the next fill: the primitives expect room to fill and bytes to
+    // drain, otherwise they would wait on a socket that is not the one holding things up.
+    auto pending = *r;
+    while (pending != 0) {
+      auto w = co_await to.async_splice_write_some(pipe->read_fd(), pending);
+      if (!w) {
+        co_return unexpected(w.error());
+      }
+      if (*w == 0) {
+        co_return unexpected(error::broken_pipe);
+      }
+      pending -= *w;
+      moved += *w;
+    }
+  }
+
+  co_return moved;
+}
+
+}  // namespace iocoro::io
@@ -2,10 +2,12 @@
 
 #include <iocoro/any_io_executor.hpp>
 #include <iocoro/awaitable.hpp>
+#include <iocoro/net/buffer.hpp>
 #include <iocoro/result.hpp>
 
 #include <concepts>
 #include <cstddef>
+#include <cstdint>
 #include <span>
 #include <system_error>
 
@@ -71,6 +73,43 @@ concept async_write_stream =
 template <class Stream>
 concept async_stream = async_read_stream<Stream> && async_write_stream<Stream>;
 
+/// A stream whose read primitive also accepts a buffer sequence (scatter read), e.g.
+/// `async_read_some(std::span<net::mutable_buffer const>)`.
+template <class Stream>
+concept async_scatter_read_stream =
+  async_read_stream<Stream> && requires(Stream& s, std::span<net::mutable_buffer const> bufs) {
+    requires std::same_as<decltype(s.async_read_some(bufs)), awaitable<result<std::size_t>>>;
+  };
+
+/// A stream whose write primitive also accepts a buffer sequence (gather write), e.g.
+/// `async_write_some(std::span<net::const_buffer const>)`.
+template <class Stream>
+concept async_gather_write_stream =
+  async_write_stream<Stream> && requires(Stream& s, std::span<net::const_buffer const> bufs) {
+    requires std::same_as<decltype(s.async_write_some(bufs)), awaitable<result<std::size_t>>>;
+  };
+
+/// A stream that can send a file range without a user-space copy, e.g.
+/// `async_sendfile_some(int file_fd, std::uint64_t offset, std::size_t count)`.
+template <class Stream>
+concept async_sendfile_stream =
+  io_executor_stream<Stream> && requires(Stream& s, int fd, std::uint64_t off, std::size_t n) {
+    requires std::same_as<decltype(s.async_sendfile_some(fd, off, n)),
+                          awaitable<result<std::size_t>>>;
+  };
+
+/// A stream that can move bytes to and from a pipe with splice(2):
+/// `async_splice_read_some(int pipe_fd, std::size_t count)` fills the pipe,
+/// `async_splice_write_some(int pipe_fd, std::size_t count)` drains it.
+template <class Stream>
+concept async_splice_stream =
+  io_executor_stream<Stream> && requires(Stream& s, int fd, std::size_t n) {
+    requires std::same_as<decltype(s.async_splice_read_some(fd, n)),
+                          awaitable<result<std::size_t>>>;
+    requires std::same_as<decltype(s.async_splice_write_some(fd, n)),
+                          awaitable<result<std::size_t>>>;
+  };
+
 template <class Socket, class Endpoint>
 concept async_connect_socket = requires(Socket& s, Endpoint const& ep) {
   { s.get_executor() } -> std::same_as<::iocoro::any_io_executor>;
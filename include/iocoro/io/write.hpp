@@ -53,4 +53,42 @@ template <async_write_stream Stream>
   return async_write(s, buf.as_span());
 }
 
+/// Composed operation: write every byte of the buffer sequence `buffers`, in order.
+///
+/// On a stream with a gather-write primitive (`async_gather_write_stream`) each step hands the
+/// remaining buffers to one `async_write_some` call, resuming mid-buffer after a partial write;
+/// other streams get one buffer per step. Errors and zero progress are reported as for the
+/// single-buffer overload.
+///
+/// IMPORTANT - Buffer Lifetime: as above; this also applies to the sequence object itself.
+template <async_write_stream Stream, net::const_buffer_sequence Buffers>
+[[nodiscard]] auto async_write(Stream& s,
+                               Buffers const& buffers) -> awaitable<result<std::size_t>> {
+  net::detail::consuming_buffers<net::const_buffer, Buffers> rest{buffers};
+  std::size_t written = 0;
+
+  while (!rest.empty()) {
+    auto const bufs = rest.prepare();
+    result<std::size_t> r{};
+    if constexpr (async_gather_write_stream<Stream>) {
+      r = co_await s.async_write_some(bufs);
+    } else {
+      r = co_await s.async_write_some(bufs.front().as_span());
+    }
+    if (!r) {
+      co_return r;
+    }
+
+    auto const n = *r;
+    if (n == 0) {
+      co_return unexpected(error::broken_pipe);
+    }
+
+    rest.consume(n);
+    written += n;
+  }
+
+  co_return written;
+}
+
 }  // namespace iocoro::io
@@ -5,13 +5,18 @@
 #include <iocoro/detail/executor_guard.hpp>
 #include <iocoro/detail/io_context_impl.hpp>
 #include <iocoro/detail/unique_function.hpp>
+#include <iocoro/result.hpp>
 
+#include <algorithm>
 #include <chrono>
+#include <cstddef>
 #include <cstdint>
 #include <functional>
 #include <memory>
+#include <span>
 #include <type_traits>
 #include <utility>
+#include <vector>
 
 namespace iocoro {
 
@@ -22,14 +27,26 @@ class work_guard;
 ///
 /// Semantics:
 /// - `run*()` drives completion of posted tasks, timers, and I/O readiness callbacks.
-/// - At most one thread may execute `run()`, `run_one()`, or `run_for()` at a time for a given
-///   `io_context` instance (single reactor thread ownership).
+/// - Any number of threads may execute `run()`, `run_one()`, or `run_for()` concurrently for the
+///   same `io_context`. One of them at a time owns the reactor (timers + backend wait); the others
+///   drain posted work and park until more arrives.
+/// - Extra runners parallelize posted work, not the reactor, so throughput does not scale linearly
+///   with their number. For I/O that should spread over cores, use one context per core
+///   (`io_context_pool`).
 /// - Backend failures are treated as fatal internal errors: pending I/O and timers are aborted
 ///   with `error::internal_error`, and the loop transitions to the stopped state.
 ///
 /// Threading:
 /// - `post()` (via the executor) and `stop()` are safe to call from any thread.
-/// - Completion callbacks run on the thread currently driving `run*()` for that `io_context`.
+/// - Completion callbacks run on one of the threads currently driving `run*()` for that
+///   `io_context`; with several runners, handlers must not assume a particular thread.
+///
+/// Resumption:
+/// - While exactly one thread is inside `run*()`, a coroutine whose I/O or timer completes is
+///   resumed inline from the event loop instead of through the posted queue.
+/// - As soon as a second thread runs the context, completions are posted again, so that any
+///   runner can pick them up instead of all of them running on the thread holding the reactor.
+///   The runner count is the only switch; there is no separate option.
 class io_context {
  public:
   /// Internal executor type bound to this io_context.
@@ -51,6 +68,39 @@ class io_context {
       });
     }
 
+    /// Post every element of `fs` (each is moved from) in order, waking the context at most once.
+    /// If the tasks cannot be enqueued, the exception propagates and `fs` is left as it was.
+    void post_bulk(std::span<detail::unique_function<void()>> fs) const {
+      auto& impl = ensure_impl();
+      if (fs.empty()) {
+        return;
+      }
+
+      // One shared batch carries the context and the callables; each queued task only refers to
+      // its slot, so the wrappers fit inline. All allocations happen before `fs` is touched.
+      auto batch = std::make_shared<bulk_batch>(impl_, fs.size());
+      std::vector<detail::unique_function<void()>> tasks;
+      tasks.reserve(fs.size());
+      for (std::size_t i = 0; i < fs.size(); ++i) {
+        tasks.emplace_back([batch, i] {
+          detail::executor_guard g{executor_type{batch->impl}};
+          auto fn = std::move(batch->fns[i]);
+          fn();
+        });
+      }
+
+      std::ranges::move(fs, batch->fns.begin());
+      try {
+        impl.post_bulk(tasks);
+      } catch (...) {
+        // The posted queue either takes every task or none; only hand back what it did not take.
+        if (tasks.front()) {
+          std::ranges::move(batch->fns, fs.begin());
+        }
+        throw;
+      }
+    }
+
     void dispatch(detail::unique_function<void()> f) const {
       ensure_impl().dispatch([ex = *this, fn = std::move(f)]() mutable {
         detail::executor_guard g{ex};
@@ -77,6 +127,15 @@ class io_context {
     friend class io_context;
     friend struct detail::executor_traits<executor_type>;
 
+    // Shared state of one `post_bulk()` call.
+    struct bulk_batch {
+      bulk_batch(std::shared_ptr<detail::io_context_impl> impl_, std::size_t n)
+          : impl(std::move(impl_)), fns(n) {}
+
+      std::shared_ptr<detail::io_context_impl> impl;
+      std::vector<detail::unique_function<void()>> fns;
+    };
+
     void add_work_guard() const noexcept {
       if (impl_ != nullptr) {
         impl_->add_work_guard();
@@ -98,7 +157,30 @@ class io_context {
     std::shared_ptr<detail::io_context_impl> impl_{};
   };
 
+  /// Timer ordering structure, see `detail::timer_queue_kind`.
+  using timer_queue_kind = detail::timer_queue_kind;
+
+  /// Backend tuning (epoll event batch size; io_uring queue depth, SQPOLL, single issuer, ...),
+  /// see `detail::backend_options`.
+  using backend_options = detail::backend_options;
+
+  struct options {
+    /// `heap` (default) keeps exact expiry ordering; `wheel` trades 1ms resolution for O(1)
+    /// arm/cancel, which pays off with many frequently re-armed timeouts.
+    timer_queue_kind timers = timer_queue_kind::heap;
+    backend_options backend{};
+    /// Busy-poll window (0: off). Before blocking, the loop keeps polling the backend and the
+    /// posted queue for up to this long, trading CPU for wake-up latency. The window adapts:
+    /// it shrinks while spins come up empty and grows back when they find work.
+    std::chrono::microseconds busy_poll{0};
+  };
+
   io_context() : impl_(std::make_shared<detail::io_context_impl>()) {}
+  explicit io_context(options const& opts)
+      : impl_(std::make_shared<detail::io_context_impl>(detail::make_backend(opts.backend),
+                                                         opts.timers)) {
+    impl_->set_busy_poll(opts.busy_poll);
+  }
   ~io_context() = default;
 
   io_context(io_context const&) = delete;
@@ -108,6 +190,9 @@ class io_context {
 
   /// Run the event loop until `stop()` is requested or there is no work.
   /// Returns the number of completed callbacks executed.
+  ///
+  /// Completions resume their coroutines inline only while this is the sole runner (see
+  /// "Resumption" above).
   auto run() -> std::size_t { return impl_->run(); }
 
   /// Run one scheduler turn and return.
@@ -120,7 +205,17 @@ class io_context {
 
   /// Run the event loop for at most `timeout`, or until stopped / out of work.
   /// Returns the number of completed callbacks executed.
-  auto run_for(std::chrono::milliseconds timeout) -> std::size_t { return impl_->run_for(timeout); }
+  ///
+  /// Any duration type is accepted (rounded up to `steady_clock` precision), so sub-millisecond
+  /// budgets are honoured.
+  auto run_for(std::chrono::milliseconds timeout) -> std::size_t {
+    return impl_->run_for(std::chrono::ceil<std::chrono::steady_clock::duration>(timeout));
+  }
+
+  template <typename Rep, typename Period>
+  auto run_for(std::chrono::duration<Rep, Period> timeout) -> std::size_t {
+    return impl_->run_for(std::chrono::ceil<std::chrono::steady_clock::duration>(timeout));
+  }
 
   /// Request the event loop to stop (idempotent).
   ///
@@ -134,6 +229,30 @@ class io_context {
   /// True if `stop()` has been requested.
   auto stopped() const noexcept -> bool { return impl_->stopped(); }
 
+  /// Register `buffers` with the kernel as fixed buffers (experimental io_uring backend),
+  /// replacing any previous set.
+  ///
+  /// Socket reads and writes whose buffer lies entirely inside a registered one are then issued
+  /// as READ_FIXED / WRITE_FIXED, so the pages are not pinned on every operation. The memory must
+  /// stay valid until `unregister_buffers()` or the context's destruction.
+  ///
+  /// WRITE_FIXED behaves like write(2), which has no MSG_NOSIGNAL: writing into a reset
+  /// connection raises SIGPIPE in the thread running the context. Writes therefore use it only
+  /// if SIGPIPE is ignored at the time of this call, and keep going out as plain sends otherwise
+  /// (reads are unaffected). The disposition is sampled here once; changing it later takes
+  /// effect at the next `register_buffers()`.
+  ///
+  /// Fails with `std::errc::operation_not_supported` on readiness backends (epoll).
+  auto register_buffers(std::span<std::span<std::byte> const> buffers) -> result<void> {
+    if (auto ec = impl_->register_buffers(buffers)) {
+      return fail(ec);
+    }
+    return ok();
+  }
+
+  /// Drop the registered buffers.
+  auto unregister_buffers() -> result<void> { return register_buffers({}); }
+
   /// Return an IO-capable executor associated with this context.
   ///
   /// Posting or dispatching through this executor schedules work onto this `io_context`.
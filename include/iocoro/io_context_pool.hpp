@@ -0,0 +1,123 @@
+#pragma once
+
+#include <iocoro/any_io_executor.hpp>
+#include <iocoro/assert.hpp>
+#include <iocoro/io_context.hpp>
+#include <iocoro/work_guard.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <exception>
+#include <functional>
+#include <memory>
+#include <optional>
+#include <thread>
+#include <vector>
+
+namespace iocoro {
+
+/// A fixed set of `io_context` instances, each driven by its own thread.
+///
+/// This is the "one reactor per core" building block: connections are sharded across contexts
+/// by handing a pool executor to each new socket (see `basic_acceptor::async_accept(ex)`), so
+/// every connection stays on a single event loop for its whole lifetime.
+///
+/// Semantics:
+/// - The constructor starts `size()` threads; thread `i` runs `context(i).run()` and keeps it
+///   alive with a work guard until `stop()`.
+/// - `get_executor()` picks a context according to the pool's `select_policy`.
+/// - `stop()` releases the work guards and stops every context; `join()` then waits for all
+///   threads. The destructor does both before any `io_context` is destroyed.
+///
+/// Threading:
+/// - `get_executor()`, `stop()` and `size()` are safe to call from any thread.
+/// - `join()` must not be called from one of the pool's threads.
+class io_context_pool {
+ public:
+  /// How `get_executor()` picks a context.
+  enum class select_policy : std::uint8_t {
+    /// Cycle through contexts in order.
+    round_robin,
+    /// Pick the context with the smallest `load` (tracked fds + queued posted tasks).
+    least_loaded,
+  };
+
+  struct options {
+    select_policy policy = select_policy::round_robin;
+
+    /// Pin thread `i` to one CPU (best-effort; failures are ignored).
+    bool pin_threads = false;
+
+    /// CPUs used when `pin_threads` is set; thread `i` uses `cpus[i % cpus.size()]`.
+    /// Empty means "the CPUs in the calling thread's affinity mask, in ascending order".
+    std::vector<int> cpus{};
+
+    /// Options applied to every context in the pool.
+    io_context::options context{};
+  };
+
+  /// Handler invoked when a completion handler throws out of `run()` on a pool thread.
+  using exception_handler_t = std::function<void(std::exception_ptr)>;
+
+  explicit io_context_pool(std::size_t n_contexts);
+  io_context_pool(std::size_t n_contexts, options opts);
+
+  io_context_pool(io_context_pool const&) = delete;
+  auto operator=(io_context_pool const&) -> io_context_pool& = delete;
+  io_context_pool(io_context_pool&&) = delete;
+  auto operator=(io_context_pool&&) -> io_context_pool& = delete;
+
+  ~io_context_pool() noexcept;
+
+  /// Return an executor for the context chosen by the pool's default policy.
+  auto get_executor() noexcept -> any_io_executor;
+
+  /// Return an executor for the context chosen by `policy`.
+  auto get_executor(select_policy policy) noexcept -> any_io_executor;
+
+  /// Access context `i` (0 <= i < size()).
+  auto context(std::size_t i) noexcept -> io_context&;
+
+  auto size() const noexcept -> std::size_t { return contexts_.size(); }
+
+  /// Release the work guards and stop every context (idempotent).
+  void stop() noexcept;
+
+  /// Stop and join all pool threads (idempotent).
+  void join() noexcept;
+
+  /// Set the handler for exceptions escaping `run()` (called on the pool thread).
+  ///
+  /// If unset, such exceptions are swallowed. In both cases the context keeps running unless
+  /// it has been stopped.
+  void set_exception_handler(exception_handler_t handler) noexcept;
+
+ private:
+  struct slot {
+    explicit slot(io_context::options opts) : ctx(opts) {}
+
+    io_context ctx;
+    detail::io_context_impl* impl = nullptr;
+    std::optional<work_guard<any_io_executor>> guard{};
+    std::optional<int> cpu{};
+  };
+
+  static auto affinity_cpus() -> std::vector<int>;
+  static void pin_this_thread(int cpu) noexcept;
+  void run_slot(slot& s) noexcept;
+
+  auto pick_round_robin() noexcept -> std::size_t;
+  auto pick_least_loaded() noexcept -> std::size_t;
+
+  select_policy policy_ = select_policy::round_robin;
+  std::vector<std::unique_ptr<slot>> contexts_{};
+  std::vector<std::thread> threads_{};
+  std::atomic<std::size_t> next_{0};
+  std::atomic<bool> stopped_{false};
+  std::atomic<std::shared_ptr<exception_handler_t>> on_exception_{};
+};
+
+}  // namespace iocoro
+
+#include <iocoro/impl/io_context_pool.ipp>
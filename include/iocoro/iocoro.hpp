@@ -19,6 +19,7 @@
 
 // Execution & lifetime
 #include <iocoro/io_context.hpp>
+#include <iocoro/io_context_pool.hpp>
 #include <iocoro/strand.hpp>
 #include <iocoro/thread_pool.hpp>
 #include <iocoro/work_guard.hpp>
@@ -37,6 +38,7 @@
 #include <iocoro/net/basic_stream_socket.hpp>
 #include <iocoro/net/buffer.hpp>
 #include <iocoro/net/protocol.hpp>
+#include <iocoro/received_buffer.hpp>
 #include <iocoro/shutdown.hpp>
 #include <iocoro/socket_option.hpp>
 
@@ -53,5 +55,7 @@
 // Async I/O algorithms
 #include <iocoro/io/read.hpp>
 #include <iocoro/io/read_until.hpp>
+#include <iocoro/io/sendfile.hpp>
+#include <iocoro/io/splice.hpp>
 #include <iocoro/io/stream_concepts.hpp>
 #include <iocoro/io/write.hpp>
@@ -12,6 +12,7 @@
 #include <iocoro/net/basic_stream_socket.hpp>
 
 #include <concepts>
+#include <cstddef>
 #include <functional>
 #include <system_error>
 #include <type_traits>
@@ -90,17 +91,37 @@ class basic_acceptor {
     return ::iocoro::detail::socket::get_local_endpoint<endpoint>(handle_.native_handle());
   }
 
+  /// Accept through one long-lived multishot request (io_uring); 0 turns it off.
+  ///
+  /// Accepted connections queue up to `queue_limit` deep between `async_accept()` calls; at the
+  /// limit the request is cancelled and re-armed once the queue drains, leaving the rest in the
+  /// listen backlog. A no-op on other backends. Set it before the first accept.
+  void set_multishot_accept(std::size_t queue_limit) noexcept {
+    handle_.impl().set_multishot_accept(queue_limit);
+  }
+
   /// Accept and return a connected `socket`.
   ///
   /// Notes:
   /// - The returned socket is bound to the same io_context as this acceptor.
   /// - The accepted native fd is adopted atomically; no fd leaks occur on failure.
   auto async_accept() -> awaitable<result<socket>> {
+    return async_accept(handle_.get_executor());
+  }
+
+  /// Accept and return a connected `socket` bound to `ex`.
+  ///
+  /// Notes:
+  /// - The accepted fd is registered directly with `ex`'s io_context (typically another context
+  ///   of an `io_context_pool`); it is never registered with the acceptor's context, so no
+  ///   remove/re-add migration is needed.
+  /// - The accepted native fd is adopted atomically; no fd leaks occur on failure.
+  auto async_accept(any_io_executor ex) -> awaitable<result<socket>> {
     auto r = co_await async_accept_fd();
     if (!r) {
       co_return unexpected(r.error());
     }
-    socket s{handle_.get_executor()};
+    socket s{std::move(ex)};
     auto ar = s.assign(*r);
     if (!ar) {
       co_return unexpected(ar.error());
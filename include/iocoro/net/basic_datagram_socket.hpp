@@ -11,12 +11,36 @@
 #include <iocoro/detail/socket/datagram_socket_impl.hpp>
 #include <iocoro/detail/socket_utils.hpp>
 
+#include <algorithm>
+#include <array>
 #include <cstddef>
 #include <span>
 #include <system_error>
 
+#include <sys/socket.h>
+#include <sys/uio.h>
+
 namespace iocoro::net {
 
+/// A datagram for `basic_datagram_socket::async_send_batch()`.
+template <class Endpoint>
+struct outgoing_datagram {
+  const_buffer data{};
+  Endpoint destination{};
+};
+
+/// A receive slot for `basic_datagram_socket::async_receive_batch()`.
+///
+/// `buffer` is supplied by the caller; the other members are filled in for each datagram
+/// received: the number of bytes stored, whether the datagram was cut to fit, and its sender.
+template <class Endpoint>
+struct incoming_datagram {
+  mutable_buffer buffer{};
+  std::size_t size = 0;
+  bool truncated = false;
+  Endpoint source{};
+};
+
 /// Protocol-typed datagram socket facade (network semantic layer).
 ///
 /// Layering / responsibilities:
@@ -43,6 +67,11 @@ class basic_datagram_socket {
   using endpoint_type = typename Protocol::endpoint;
   using impl_type = ::iocoro::detail::socket::datagram_socket_impl;
   using handle_type = ::iocoro::detail::socket_handle_base<impl_type>;
+  using outgoing_datagram_type = outgoing_datagram<endpoint_type>;
+  using incoming_datagram_type = incoming_datagram<endpoint_type>;
+
+  /// Most datagrams one `async_send_batch()` / `async_receive_batch()` call handles.
+  static constexpr std::size_t max_batch = 32;
 
   basic_datagram_socket() = delete;
 
@@ -111,6 +140,20 @@ class basic_datagram_socket {
     co_return co_await async_send_to(buffer.as_span(), destination);
   }
 
+  /// Send `buffer` as consecutive datagrams of `segment_size` bytes each, the last one possibly
+  /// shorter, handing the whole buffer to the kernel at once (UDP generic segmentation offload).
+  ///
+  /// `segment_size` must be in [1, 65535]; the kernel further caps the number of segments per
+  /// call (64) and the buffer size (about 64 KiB). Returns the number of bytes sent.
+  auto async_send_to(const_buffer buffer, endpoint_type const& destination,
+                     std::size_t segment_size) -> awaitable<result<std::size_t>> {
+    if (segment_size == 0) {
+      co_return unexpected(error::invalid_argument);
+    }
+    co_return co_await handle_.impl().async_send_to(buffer.as_span(), destination.data(),
+                                                    destination.size(), segment_size);
+  }
+
   /// Receive a datagram and retrieve the source endpoint.
   ///
   /// Important: The socket must be bound before calling this.
@@ -142,6 +185,110 @@ class basic_datagram_socket {
     co_return co_await async_receive_from(buffer.as_span(), source);
   }
 
+  /// Receive into `buffer`, which may hold several datagrams coalesced by the kernel once the
+  /// `socket_option::udp::gro` option is enabled; `segment_size` is set to their size (the last
+  /// one may be shorter). Without coalescing it equals the returned size.
+  ///
+  /// A coalesced batch can be up to 64 KiB; a smaller buffer fails with `message_size` and the
+  /// batch is dropped, as for a single datagram.
+  auto async_receive_from(mutable_buffer buffer, endpoint_type& source,
+                          std::size_t& segment_size) -> awaitable<result<std::size_t>> {
+    sockaddr_storage ss{};
+    socklen_t len = sizeof(ss);
+    std::size_t seg = 0;
+
+    auto result = co_await handle_.impl().async_receive_from(
+      buffer.as_span(), reinterpret_cast<sockaddr*>(&ss), &len, &seg);
+    if (!result) {
+      co_return unexpected(result.error());
+    }
+
+    auto ep_result = endpoint_type::from_native(reinterpret_cast<sockaddr*>(&ss), len);
+    if (!ep_result) {
+      co_return unexpected(ep_result.error());
+    }
+
+    source = *ep_result;
+    segment_size = seg;
+    co_return *result;
+  }
+
+  /// Send up to `max_batch` datagrams with one system call (`sendmmsg`) per readiness.
+  ///
+  /// Returns how many datagrams from the front of `datagrams` were sent: at least one unless
+  /// `datagrams` is empty, but possibly fewer than requested (the socket's send buffer filled
+  /// up), in which case the caller resubmits the rest. Destinations follow `async_send_to()`.
+  auto async_send_batch(std::span<outgoing_datagram_type const> datagrams)
+    -> awaitable<result<std::size_t>> {
+    auto const n = (std::min)(datagrams.size(), max_batch);
+    std::array<::mmsghdr, max_batch> msgs{};
+    std::array<::iovec, max_batch> iov{};
+    for (std::size_t i = 0; i < n; ++i) {
+      auto const& d = datagrams[i];
+      iov[i] = ::iovec{const_cast<void*>(d.data.data()), d.data.size()};
+      msgs[i].msg_hdr.msg_iov = &iov[i];
+      msgs[i].msg_hdr.msg_iovlen = 1;
+      msgs[i].msg_hdr.msg_name = const_cast<sockaddr*>(d.destination.data());
+      msgs[i].msg_hdr.msg_namelen = d.destination.size();
+    }
+    co_return co_await handle_.impl().async_send_batch(std::span{msgs.data(), n});
+  }
+
+  /// Send up to `max_batch` datagrams, one per buffer, to the connected peer.
+  auto async_send_batch(std::span<const_buffer const> datagrams)
+    -> awaitable<result<std::size_t>> {
+    auto const n = (std::min)(datagrams.size(), max_batch);
+    std::array<::mmsghdr, max_batch> msgs{};
+    std::array<::iovec, max_batch> iov{};
+    for (std::size_t i = 0; i < n; ++i) {
+      iov[i] = ::iovec{const_cast<void*>(datagrams[i].data()), datagrams[i].size()};
+      msgs[i].msg_hdr.msg_iov = &iov[i];
+      msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+    co_return co_await handle_.impl().async_send_batch(std::span{msgs.data(), n});
+  }
+
+  /// Receive up to `max_batch` datagrams with one system call (`recvmmsg`) per readiness.
+  ///
+  /// Waits for at least one datagram, then takes whatever else is already queued. Returns how
+  /// many entries from the front of `datagrams` were filled in. Unlike `async_receive_from()`, a
+  /// datagram larger than its buffer is not an error: it is cut and marked `truncated`.
+  ///
+  /// Important: The socket must be bound before calling this.
+  auto async_receive_batch(std::span<incoming_datagram_type> datagrams)
+    -> awaitable<result<std::size_t>> {
+    auto const n = (std::min)(datagrams.size(), max_batch);
+    std::array<::mmsghdr, max_batch> msgs{};
+    std::array<::iovec, max_batch> iov{};
+    std::array<sockaddr_storage, max_batch> sources;
+    for (std::size_t i = 0; i < n; ++i) {
+      iov[i] = ::iovec{datagrams[i].buffer.data(), datagrams[i].buffer.size()};
+      msgs[i].msg_hdr.msg_iov = &iov[i];
+      msgs[i].msg_hdr.msg_iovlen = 1;
+      msgs[i].msg_hdr.msg_name = &sources[i];
+      msgs[i].msg_hdr.msg_namelen = sizeof(sockaddr_storage);
+    }
+
+    auto r = co_await handle_.impl().async_receive_batch(std::span{msgs.data(), n});
+    if (!r) {
+      co_return unexpected(r.error());
+    }
+
+    for (std::size_t i = 0; i < *r; ++i) {
+      auto& d = datagrams[i];
+      auto const& hdr = msgs[i].msg_hdr;
+      auto ep = endpoint_type::from_native(reinterpret_cast<sockaddr const*>(&sources[i]),
+                                           hdr.msg_namelen);
+      if (!ep) {
+        co_return unexpected(ep.error());
+      }
+      d.size = msgs[i].msg_len;
+      d.truncated = (hdr.msg_flags & MSG_TRUNC) != 0;
+      d.source = *ep;
+    }
+    co_return *r;
+  }
+
   /// Query the local endpoint for an open socket.
   auto local_endpoint() const -> result<endpoint_type> {
     return ::iocoro::detail::socket::get_local_endpoint<endpoint_type>(handle_.native_handle());
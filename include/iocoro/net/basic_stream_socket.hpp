@@ -6,13 +6,16 @@
 #include <iocoro/error.hpp>
 #include <iocoro/io_context.hpp>
 #include <iocoro/net/buffer.hpp>
+#include <iocoro/received_buffer.hpp>
 #include <iocoro/result.hpp>
 #include <iocoro/shutdown.hpp>
 
+#include <iocoro/detail/socket/iovec_batch.hpp>
 #include <iocoro/detail/socket/stream_socket_impl.hpp>
 #include <iocoro/detail/socket_utils.hpp>
 
 #include <cstddef>
+#include <cstdint>
 #include <span>
 #include <system_error>
 
@@ -82,6 +85,25 @@ class basic_stream_socket {
     return async_read_some(buffer.as_span());
   }
 
+  /// Scatter read into the buffers of `buffers`, in order, with one system call.
+  ///
+  /// Like the single-buffer form, this completes after any amount of data; at most the first
+  /// 64 non-empty buffers are filled. The buffers (not the sequence object) must stay valid until
+  /// the operation completes.
+  template <mutable_buffer_sequence Buffers>
+  auto async_read_some(Buffers const& buffers) -> awaitable<result<std::size_t>> {
+    return handle_.impl().async_read_some(
+      ::iocoro::detail::socket::iovec_batch::gather(buffers));
+  }
+
+  /// Receive the next chunk of bytes into a library-chosen buffer; empty at end of stream.
+  ///
+  /// On io_uring this drives one multishot receive over the io_context's provided-buffer ring,
+  /// so a busy connection costs no submission per read. Do not mix with `async_read_some()`.
+  auto async_receive_buffer() -> awaitable<result<received_buffer>> {
+    return handle_.impl().async_receive_buffer();
+  }
+
   auto async_write_some(std::span<std::byte const> buffer) -> awaitable<result<std::size_t>> {
     return handle_.impl().async_write_some(buffer);
   }
@@ -90,6 +112,58 @@ class basic_stream_socket {
     return async_write_some(buffer.as_span());
   }
 
+  /// Write without copying `buffer` into the socket (MSG_ZEROCOPY, or SEND_ZC on io_uring).
+  ///
+  /// Worth it for large payloads only: the kernel pins the pages instead of copying, but has to
+  /// report back when it is done with them, and completion waits for that report. `buffer` must
+  /// stay unchanged until then. Falls back to a copying send where zero-copy is unsupported.
+  auto async_write_some_zerocopy(const_buffer buffer) -> awaitable<result<std::size_t>> {
+    return handle_.impl().async_write_some_zerocopy(buffer.as_span());
+  }
+
+  /// Gather write from the buffers of `buffers`, in order, with one system call.
+  ///
+  /// Sends e.g. a header, a body and a trailer without copying them together first. Like the
+  /// single-buffer form this may write only part of the data; see `io::async_write()` for the
+  /// composed operation. At most the first 64 non-empty buffers are taken.
+  template <const_buffer_sequence Buffers>
+  auto async_write_some(Buffers const& buffers) -> awaitable<result<std::size_t>> {
+    return handle_.impl().async_write_some(
+      ::iocoro::detail::socket::iovec_batch::gather(buffers));
+  }
+
+  /// Send up to `count` bytes of the open file `file_fd`, starting at `offset`, straight from
+  /// the page cache (sendfile(2); a splice through a pipe on io_uring).
+  ///
+  /// The file position of `file_fd` is neither used nor changed. May send less than `count`;
+  /// returns 0 once `offset` is at or past the end of the file. See `io::async_sendfile()` for
+  /// the composed operation. Uses the write side, like `async_write_some()`.
+  ///
+  /// Like send(), this and the splice operations below never raise SIGPIPE: a reset
+  /// connection fails the call (`error::broken_pipe` or `error::connection_reset`).
+  auto async_sendfile_some(int file_fd, std::uint64_t offset,
+                           std::size_t count) -> awaitable<result<std::size_t>> {
+    return handle_.impl().async_sendfile_some(file_fd, offset, count);
+  }
+
+  /// Move up to `count` received bytes into a pipe (`pipe_fd` is its write end) with splice(2).
+  ///
+  /// A building block of `io::async_splice()`; returns 0 at end of stream. The pipe must have
+  /// room for at least one byte, otherwise this fails with
+  /// `std::errc::resource_unavailable_try_again`. Uses the read side, like `async_read_some()`.
+  auto async_splice_read_some(int pipe_fd, std::size_t count) -> awaitable<result<std::size_t>> {
+    return handle_.impl().async_splice_read_some(pipe_fd, count);
+  }
+
+  /// Send up to `count` bytes out of a pipe (`pipe_fd` is its read end) with splice(2).
+  ///
+  /// A building block of `io::async_splice()`. The pipe must hold at least one byte, otherwise
+  /// this fails with `std::errc::resource_unavailable_try_again`. Uses the write side, like
+  /// `async_write_some()`.
+  auto async_splice_write_some(int pipe_fd, std::size_t count) -> awaitable<result<std::size_t>> {
+    return handle_.impl().async_splice_write_some(pipe_fd, count);
+  }
+
   auto local_endpoint() const -> result<endpoint> {
     return ::iocoro::detail::socket::get_local_endpoint<endpoint>(handle_.native_handle());
   }
@@ -1,7 +1,10 @@
 #pragma once
 
 #include <array>
+#include <concepts>
 #include <cstddef>
+#include <iterator>
+#include <ranges>
 #include <span>
 #include <string>
 #include <string_view>
@@ -112,6 +115,19 @@ inline constexpr auto operator+(mutable_buffer b, std::size_t n) noexcept -> mut
   return b;
 }
 
+/// A range of buffers that are read from (Boost.Asio's ConstBufferSequence), e.g.
+/// `std::array<const_buffer, 3>` for a header, a body and a trailer.
+template <class T>
+concept const_buffer_sequence =
+  std::ranges::forward_range<T const> &&
+  std::convertible_to<std::ranges::range_reference_t<T const>, const_buffer>;
+
+/// A range of buffers that are written to (Boost.Asio's MutableBufferSequence).
+template <class T>
+concept mutable_buffer_sequence =
+  std::ranges::forward_range<T const> &&
+  std::convertible_to<std::ranges::range_reference_t<T const>, mutable_buffer>;
+
 // Convenience helpers (Boost.Asio-style).
 inline constexpr auto buffer_size(const_buffer b) noexcept -> std::size_t {
   return b.size();
@@ -120,6 +136,16 @@ inline constexpr auto buffer_size(mutable_buffer b) noexcept -> std::size_t {
   return b.size();
 }
 
+/// Total size in bytes of a buffer sequence.
+template <const_buffer_sequence Buffers>
+inline constexpr auto buffer_size(Buffers const& buffers) noexcept -> std::size_t {
+  std::size_t total = 0;
+  for (const_buffer const b : buffers) {
+    total += b.size();
+  }
+  return total;
+}
+
 template <class T>
   requires std::is_pointer_v<T>
 inline auto buffer_cast(const_buffer b) noexcept -> T {
@@ -338,4 +364,70 @@ inline auto buffer(std::basic_string_view<CharT, Traits> s) noexcept -> const_bu
   return const_buffer{b};
 }
 
+namespace detail {
+
+/// The not yet transferred part of a buffer sequence, for composed operations that go through
+/// it over several partial transfers.
+///
+/// `prepare()` exposes at most `max_buffers` buffers at a time, with the first one advanced past
+/// the bytes already consumed. The sequence itself is not copied and must outlive this object.
+template <class Buffer, class Buffers>
+class consuming_buffers {
+ public:
+  static constexpr std::size_t max_buffers = 64;
+
+  explicit consuming_buffers(Buffers const& buffers)
+      : next_(std::ranges::begin(buffers)), end_(std::ranges::end(buffers)) {
+    skip_empty();
+  }
+
+  auto empty() const noexcept -> bool { return next_ == end_; }
+
+  /// The next buffers to transfer; empty only once the whole sequence is consumed.
+  auto prepare() -> std::span<Buffer const> {
+    std::size_t n = 0;
+    for (auto it = next_; it != end_ && n < max_buffers; ++it) {
+      Buffer b = *it;
+      if (n == 0) {
+        b += offset_;
+      }
+      if (!b.empty()) {
+        window_[n++] = b;
+      }
+    }
+    return {window_.data(), n};
+  }
+
+  /// Mark `n` more bytes as transferred (clamped to what remains).
+  void consume(std::size_t n) {
+    while (n != 0 && next_ != end_) {
+      Buffer const b = *next_;
+      auto const left = b.size() - offset_;
+      if (n < left) {
+        offset_ += n;
+        return;
+      }
+      n -= left;
+      ++next_;
+      offset_ = 0;
+      skip_empty();
+    }
+  }
+
+ private:
+  void skip_empty() {
+    while (next_ != end_ && Buffer{*next_}.size() == offset_) {
+      ++next_;
+      offset_ = 0;
+    }
+  }
+
+  std::ranges::iterator_t<Buffers const> next_;
+  std::ranges::sentinel_t<Buffers const> end_;
+  std::size_t offset_ = 0;
+  std::array<Buffer, max_buffers> window_{};
+};
+
+}  // namespace detail
+
 }  // namespace iocoro::net
@@ -0,0 +1,85 @@
+#pragma once
+
+#include <iocoro/detail/io_context_impl.hpp>
+#include <iocoro/detail/reactor_backend.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <span>
+#include <utility>
+
+namespace iocoro {
+
+namespace detail::socket {
+class stream_socket_impl;
+}  // namespace detail::socket
+
+/// Bytes delivered by `async_receive_buffer()`; empty at end of stream.
+///
+/// With multishot receive (io_uring) the bytes live in a buffer of the io_context's
+/// provided-buffer ring, which goes back to the kernel when this object is destroyed or
+/// `reset()`. Holding many of them starves the ring, so consume and release promptly. Other
+/// backends hand out an owned buffer instead.
+class received_buffer {
+ public:
+  received_buffer() noexcept = default;
+
+  received_buffer(received_buffer const&) = delete;
+  auto operator=(received_buffer const&) -> received_buffer& = delete;
+
+  received_buffer(received_buffer&& other) noexcept
+      : data_(std::exchange(other.data_, {})),
+        ctx_(std::move(other.ctx_)),
+        buffer_id_(std::exchange(other.buffer_id_, detail::no_provided_buffer)),
+        owned_(std::move(other.owned_)) {}
+
+  auto operator=(received_buffer&& other) noexcept -> received_buffer& {
+    if (this != &other) {
+      reset();
+      data_ = std::exchange(other.data_, {});
+      ctx_ = std::move(other.ctx_);
+      buffer_id_ = std::exchange(other.buffer_id_, detail::no_provided_buffer);
+      owned_ = std::move(other.owned_);
+    }
+    return *this;
+  }
+
+  ~received_buffer() { reset(); }
+
+  auto data() const noexcept -> std::span<std::byte const> { return data_; }
+  auto size() const noexcept -> std::size_t { return data_.size(); }
+  auto empty() const noexcept -> bool { return data_.empty(); }
+
+  /// Release the underlying buffer early.
+  void reset() noexcept {
+    if (ctx_ && buffer_id_ != detail::no_provided_buffer) {
+      ctx_->recycle_buffer(buffer_id_);
+    }
+    data_ = {};
+    ctx_.reset();
+    buffer_id_ = detail::no_provided_buffer;
+    owned_.reset();
+  }
+
+ private:
+  friend class detail::socket::stream_socket_impl;
+
+  // Provided-buffer view: `ctx` keeps the ring's memory alive.
+  received_buffer(std::shared_ptr<detail::io_context_impl> ctx, std::uint32_t id,
+                  std::size_t n) noexcept
+      : ctx_(std::move(ctx)), buffer_id_(id) {
+    data_ = ctx_->provided_buffer(id).first(n);
+  }
+
+  // Owned storage (readiness backends, or when the ring is exhausted).
+  received_buffer(std::unique_ptr<std::byte[]> owned, std::size_t n) noexcept
+      : data_(owned.get(), n), owned_(std::move(owned)) {}
+
+  std::span<std::byte const> data_{};
+  std::shared_ptr<detail::io_context_impl> ctx_{};
+  std::uint32_t buffer_id_ = detail::no_provided_buffer;
+  std::unique_ptr<std::byte[]> owned_{};
+};
+
+}  // namespace iocoro
@@ -7,6 +7,7 @@
 // Native socket option constants/types.
 #include <netinet/in.h>
 #include <netinet/tcp.h>
+#include <netinet/udp.h>
 #include <sys/socket.h>
 
 namespace iocoro::socket_option {
@@ -74,4 +75,13 @@ namespace tcp {
 using no_delay = boolean_option<IPPROTO_TCP, TCP_NODELAY>;
 }  // namespace tcp
 
+namespace udp {
+// UDP specific (Linux segmentation offload).
+/// Default GSO segment size for every send on the socket (0 disables).
+using segment_size = option<SOL_UDP, UDP_SEGMENT, int>;
+/// Let the kernel coalesce received datagrams (GRO); see the `segment_size` out-parameter of
+/// `basic_datagram_socket::async_receive_from()`.
+using gro = boolean_option<SOL_UDP, UDP_GRO>;
+}  // namespace udp
+
 }  // namespace iocoro::socket_option
@@ -5,9 +5,14 @@
 #include <iocoro/detail/executor_cast.hpp>
 #include <iocoro/detail/executor_guard.hpp>
 #include <iocoro/detail/unique_function.hpp>
+#include <iocoro/io_context.hpp>
 
+#include <algorithm>
+#include <cstddef>
+#include <deque>
+#include <memory>
 #include <mutex>
-#include <queue>
+#include <span>
 #include <type_traits>
 #include <utility>
 
@@ -21,10 +26,19 @@ namespace iocoro {
 ///
 /// Semantics:
 /// - post(fn): enqueue fn and ensure a drain is scheduled onto the underlying executor.
-/// - dispatch(fn): if already executing on this strand, may run fn inline; otherwise behaves
-///   like post(fn).
+/// - dispatch(fn): if already executing on this strand, may run fn inline. If the underlying
+///   executor is an `io_context` executor, the calling thread is running that context and the
+///   strand is idle, fn also runs inline. Otherwise behaves like post(fn).
+/// - A drain runs at most `max_drain_per_tick` tasks before rescheduling itself, so a busy
+///   strand does not starve other work on the underlying executor.
+///
+/// Scheduling a drain always costs one trip through the base executor's queue; tasks posted while
+/// a drain is pending or running ride along with it. Over an `io_context` executor the drain is
+/// posted to the context's posted queue directly, skipping only the executor's own wrapping.
 class strand_executor {
  public:
+  static constexpr std::size_t max_drain_per_tick = 256;
+
   strand_executor() = delete;
 
   explicit strand_executor(any_executor base) : state_(std::make_shared<state>(std::move(base))) {}
@@ -36,12 +50,22 @@ class strand_executor {
     IOCORO_ENSURE(state_, "strand_executor::post: empty state");
     IOCORO_ENSURE(state_->base, "strand_executor::post: empty base executor");
 
-    bool const should_schedule = state_->enqueue(std::move(f));
+    if (state_->enqueue(std::move(f))) {
+      schedule_drain(state_);
+    }
+  }
+
+  /// Enqueue every element of `fs` (each is moved from) at once; at most one drain is
+  /// scheduled on the base executor.
+  void post_bulk(std::span<detail::unique_function<void()>> fs) const {
+    IOCORO_ENSURE(state_, "strand_executor::post_bulk: empty state");
+    IOCORO_ENSURE(state_->base, "strand_executor::post_bulk: empty base executor");
+    if (fs.empty()) {
+      return;
+    }
 
-    if (should_schedule) {
-      // Schedule a drain on the underlying executor.
-      auto st = state_;
-      state_->base.post([st]() { strand_executor::drain(std::move(st)); });
+    if (state_->enqueue_bulk(fs)) {
+      schedule_drain(state_);
     }
   }
 
@@ -57,10 +81,12 @@ class strand_executor {
       return;
     }
 
-    bool const should_schedule = state_->enqueue(std::move(f));
-    if (should_schedule) {
-      auto st = state_;
-      state_->base.post([st]() { strand_executor::drain(std::move(st)); });
+    if (try_run_inline(f)) {
+      return;
+    }
+
+    if (state_->enqueue(std::move(f))) {
+      schedule_drain(state_);
     }
   }
 
@@ -82,35 +108,66 @@ class strand_executor {
   explicit strand_executor(std::shared_ptr<state> st) noexcept : state_(std::move(st)) {}
 
   struct state {
-    explicit state(any_executor base_) : base(std::move(base_)) {}
+    explicit state(any_executor base_) : base(std::move(base_)) {
+      if (detail::any_executor_access::target<io_context::executor_type>(base) != nullptr) {
+        ctx = detail::any_executor_access::io_context(base);
+      }
+    }
+
+    state(state const&) = delete;
+    auto operator=(state const&) -> state& = delete;
 
     any_executor base{};
+    // The context behind `base` if it is an `io_context` executor (kept alive by `base`).
+    detail::io_context_impl* ctx = nullptr;
+
     std::mutex m{};
-    std::queue<detail::unique_function<void()>> tasks{};
-    bool active{false};  // true if a drain is scheduled or currently running
+    std::deque<detail::unique_function<void()>> tasks{};
+    // True while a drain is scheduled or running, or a task runs inline. Whoever sets it owns the
+    // strand until `release()` finds the queue empty.
+    bool active = false;
 
+    // Returns true if the caller must schedule a drain.
     auto enqueue(detail::unique_function<void()> fn) -> bool {
       std::scoped_lock lk{m};
-      tasks.emplace(std::move(fn));
-      if (active) {
+      tasks.push_back(std::move(fn));
+      return !std::exchange(active, true);
+    }
+
+    auto enqueue_bulk(std::span<detail::unique_function<void()>> fs) -> bool {
+      std::scoped_lock lk{m};
+      // Grow first so that a failed allocation leaves `fs` untouched.
+      auto const old_size = tasks.size();
+      tasks.resize(old_size + fs.size());
+      std::ranges::move(fs, tasks.begin() + static_cast<std::ptrdiff_t>(old_size));
+      return !std::exchange(active, true);
+    }
+
+    // Take ownership of an idle strand with nothing queued.
+    auto try_acquire() -> bool {
+      std::scoped_lock lk{m};
+      if (active || !tasks.empty()) {
         return false;
       }
       active = true;
       return true;
     }
 
-    auto pop_one() -> detail::unique_function<void()> {
+    // Owner only: move the next task into `out`, or give up ownership if none is queued.
+    auto pop(detail::unique_function<void()>& out) -> bool {
       std::scoped_lock lk{m};
       if (tasks.empty()) {
         active = false;
-        return {};
+        return false;
       }
-      auto out = std::move(tasks.front());
-      tasks.pop();
-      return out;
+      out = std::move(tasks.front());
+      tasks.pop_front();
+      return true;
     }
 
-    auto should_schedule_drain() noexcept -> bool {
+    // Owner only: give up ownership unless tasks are queued. Returns true if the caller must
+    // schedule a drain for them.
+    auto release() -> bool {
       std::scoped_lock lk{m};
       if (tasks.empty()) {
         active = false;
@@ -120,6 +177,44 @@ class strand_executor {
     }
   };
 
+  static void schedule_drain(std::shared_ptr<state> st) {
+    if (auto* ctx = st->ctx) {
+      ctx->post([st = std::move(st)]() mutable { strand_executor::drain(std::move(st)); });
+      return;
+    }
+    auto const& base = st->base;
+    base.post([st = std::move(st)]() mutable { strand_executor::drain(std::move(st)); });
+  }
+
+  // Run `f` right away if the strand is idle and this thread runs its io_context.
+  auto try_run_inline(detail::unique_function<void()>& f) const -> bool {
+    auto* ctx = state_->ctx;
+    if (ctx == nullptr || !ctx->running_in_this_thread() || ctx->stopped()) {
+      return false;
+    }
+    if (!state_->try_acquire()) {
+      return false;
+    }
+
+    // SAFETY: `f` may destroy `*this` (e.g. a resumed coroutine finishing and releasing its
+    // executor); only `ex` is used after the call.
+    strand_executor ex{state_};
+    detail::executor_guard g{ex};
+    try {
+      f();
+    } catch (...) {
+      if (ex.state_->release()) {
+        schedule_drain(ex.state_);
+      }
+      throw;
+    }
+    // Tasks posted meanwhile (by `f` or other threads) go through a regular drain.
+    if (ex.state_->release()) {
+      schedule_drain(ex.state_);
+    }
+    return true;
+  }
+
   static void drain(std::shared_ptr<state> st) {
     IOCORO_ENSURE(st, "strand_executor::drain: empty state");
     IOCORO_ENSURE(st->base, "strand_executor::drain: empty base executor");
@@ -128,32 +223,27 @@ class strand_executor {
     strand_executor ex{st};
     detail::executor_guard g{ex};
 
-    constexpr std::size_t max_drain_per_tick = 256;
-
     detail::unique_function<void()> fn{};
-    std::size_t n = 0;
-    try {
-      while (n < max_drain_per_tick) {
-        fn = st->pop_one();
-        if (!fn) {
-          break;
+    for (std::size_t n = 0; n < max_drain_per_tick; ++n) {
+      if (!st->pop(fn)) {
+        return;
+      }
+      try {
+        if (fn) {
+          fn();
         }
-        fn();
         fn = {};
-        ++n;
-      }
-    } catch (...) {
-      if (st->should_schedule_drain()) {
-        auto again = st;
-        st->base.post([again]() { strand_executor::drain(std::move(again)); });
+      } catch (...) {
+        if (st->release()) {
+          schedule_drain(st);
+        }
+        throw;
       }
-      throw;
     }
 
     // Fairness: if more tasks remain, reschedule another drain onto the base executor.
-    if (st->should_schedule_drain()) {
-      auto again = st;
-      st->base.post([again]() { strand_executor::drain(std::move(again)); });
+    if (st->release()) {
+      schedule_drain(std::move(st));
     }
   }
 
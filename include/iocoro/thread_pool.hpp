@@ -5,6 +5,7 @@
 #include <iocoro/detail/executor_cast.hpp>
 #include <iocoro/detail/unique_function.hpp>
 #include <iocoro/detail/work_guard_counter.hpp>
+#include <iocoro/detail/work_stealing_deque.hpp>
 #include <iocoro/work_guard.hpp>
 
 #include <atomic>
@@ -16,6 +17,7 @@
 #include <functional>
 #include <memory>
 #include <mutex>
+#include <span>
 #include <thread>
 #include <type_traits>
 #include <utility>
@@ -23,12 +25,16 @@
 
 namespace iocoro {
 
-/// Minimal thread pool with a shared FIFO task queue.
+/// Work-stealing thread pool.
 ///
 /// Semantics:
-/// - `post()` schedules work onto one of the worker threads.
+/// - `post()` schedules work onto one of the worker threads. Called from a worker of the pool,
+///   the task goes to that worker's own queue; other threads post to a shared injection queue.
+///   Idle workers steal from busy ones. Each queue is FIFO; there is no ordering across queues.
 /// - `dispatch()` runs inline only when already executing on the same pool executor;
 ///   otherwise it falls back to `post()`.
+/// - Idle workers park. A post wakes one only when none is already looking for work, and a
+///   woken worker that finds some wakes the next one if more is queued.
 ///
 /// This is intentionally small and acts as a building block for higher-level executors.
 class thread_pool {
@@ -74,16 +80,65 @@ class thread_pool {
  private:
   enum class state_t : std::uint8_t { running, draining, stopped };
 
+  struct task {
+    detail::unique_function<void()> fn;
+  };
+
+  struct shared_state;
+
+  struct worker {
+    // Tasks beyond the capacity spill to the injection queue.
+    detail::work_stealing_deque<task, 256> local{};
+    shared_state* owner = nullptr;
+    std::uint32_t rng = 0;
+    // Local pops since the last FIFO take, see `next_task()`.
+    std::uint32_t lifo_streak = 0;
+  };
+
+  enum class park_result : std::uint8_t { woken, retry, exit };
+
   struct shared_state {
-    mutable std::mutex cv_mutex{};
-    std::condition_variable cv{};
-    std::deque<detail::unique_function<void()>> queue{};
-    std::size_t waiting_workers{0};
-    state_t state{state_t::running};
+    explicit shared_state(std::size_t n_threads);
+    ~shared_state();
+
+    shared_state(shared_state const&) = delete;
+    auto operator=(shared_state const&) -> shared_state& = delete;
+
+    void post(detail::unique_function<void()> f);
+    void post_bulk(std::span<detail::unique_function<void()>> fs);
+
+    auto next_task(worker& self) -> task*;
+    auto take_injected(worker& self) -> task*;
+    auto steal(worker& self) -> task*;
+    auto has_work() const noexcept -> bool;
+    auto should_exit() const noexcept -> bool;
+    auto park() -> park_result;
+    void wake_one_if_idle();
+    void wake_all();
+    void run(task* t) noexcept;
+
+    std::vector<std::unique_ptr<worker>> workers{};
+
+    // External posts, and overflow of full worker queues.
+    std::mutex inject_mutex{};
+    std::deque<task*> inject{};
+    std::atomic<std::size_t> inject_size{0};
+
+    // Parking. A waker moves one worker from `sleeping` to `searching` and hands it a token.
+    std::mutex park_mutex{};
+    std::condition_variable park_cv{};
+    std::size_t wake_tokens{0};
+    std::atomic<std::size_t> sleeping{0};
+    std::atomic<std::size_t> searching{0};
+
+    std::atomic<state_t> state{state_t::running};
     detail::work_guard_counter work_guard{};
     std::atomic<std::shared_ptr<exception_handler_t>> on_task_exception{};
   };
 
+  // The worker the calling thread runs, if it is a pool worker.
+  static inline thread_local worker* current_worker_ = nullptr;
+
   std::shared_ptr<shared_state> state_{};
   std::size_t n_threads_{0};
   std::vector<std::thread> threads_;
@@ -109,19 +164,17 @@ class thread_pool::executor_type {
     if (!st) {
       return;
     }
+    st->post(std::move(f));
+  }
 
-    bool should_notify = false;
-    {
-      std::scoped_lock lock{st->cv_mutex};
-      if (st->state != state_t::running) {
-        return;
-      }
-      st->queue.emplace_back(std::move(f));
-      should_notify = (st->waiting_workers > 0);
-    }
-    if (should_notify) {
-      st->cv.notify_one();
+  /// Post every element of `fs` (each is moved from), taking the injection lock and waking a
+  /// worker at most once. Idle workers that find part of the batch wake the next one.
+  void post_bulk(std::span<detail::unique_function<void()>> fs) const {
+    auto st = state_;
+    if (!st) {
+      return;
     }
+    st->post_bulk(fs);
   }
 
   void dispatch(detail::unique_function<void()> f) const {
@@ -148,8 +201,7 @@ class thread_pool::executor_type {
     if (!st) {
       return true;
     }
-    std::scoped_lock lock{st->cv_mutex};
-    return st->state != state_t::running;
+    return st->state.load(std::memory_order_acquire) != state_t::running;
   }
 
   explicit operator bool() const noexcept { return state_ != nullptr; }
@@ -176,7 +228,7 @@ class thread_pool::executor_type {
     if (st) {
       auto const old = st->work_guard.remove();
       if (old == 1) {
-        st->cv.notify_all();
+        st->wake_all();
       }
     }
   }
@@ -177,16 +177,19 @@ auto when_any(std::vector<awaitable<T>> tasks)
 
   auto st = std::make_shared<detail::when_any_container_state<T>>();
 
+  std::vector<detail::prepared_spawn> spawns{};
+  spawns.reserve(tasks.size());
   for (std::size_t i = 0; i < tasks.size(); ++i) {
     auto task_executor = tasks[i].get_executor();
     auto exec = task_executor ? task_executor : fallback_ex;
-    detail::spawn_task<void>(
+    spawns.push_back(detail::prepare_spawn_task<void>(
       detail::spawn_context{exec, parent_stop},
       [st, i, task = std::move(tasks[i])]() mutable -> awaitable<void> {
         return detail::when_any_container_run_one<T>(st, i, std::move(task));
       },
-      detail::detached_completion<void>{});
+      detail::detached_completion<void>{}));
   }
+  detail::start_spawned(spawns);
 
   co_await detail::await_when(st);
 
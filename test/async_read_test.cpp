@@ -130,3 +130,23 @@ TEST(async_read_test, error_after_partial_progress_is_propagated) {
   EXPECT_EQ(r->error(), std::make_error_code(std::errc::io_error));
   EXPECT_EQ(s.pos, 2U);
 }
+
+TEST(async_read_test, buffer_sequence_is_filled_in_order) {
+  iocoro::io_context ctx;
+  mock_read_stream s{.data = "headerbody", .pos = 0, .max_chunk = 4, .ex = ctx.get_executor()};
+
+  std::array<char, 6> head{};
+  std::array<char, 4> body{};
+  std::array<iocoro::net::mutable_buffer, 2> seq{iocoro::net::buffer(head),
+                                                 iocoro::net::buffer(body)};
+
+  auto r = iocoro::test::sync_wait(ctx, [&]() -> iocoro::awaitable<iocoro::result<std::size_t>> {
+    co_return co_await iocoro::io::async_read(s, seq);
+  }());
+
+  ASSERT_TRUE(r);
+  ASSERT_TRUE(*r);
+  EXPECT_EQ(**r, 10U);
+  EXPECT_EQ(std::string(head.data(), head.size()), "header");
+  EXPECT_EQ(std::string(body.data(), body.size()), "body");
+}
@@ -0,0 +1,214 @@
+#include <gtest/gtest.h>
+
+#include <iocoro/error.hpp>
+#include <iocoro/io/sendfile.hpp>
+#include <iocoro/io_context.hpp>
+#include <iocoro/ip/tcp.hpp>
+
+#include "test_util.hpp"
+
+#include <array>
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
+#include <future>
+#include <string>
+#include <system_error>
+#include <thread>
+
+#include <stdlib.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace {
+
+auto make_temp_file(std::string const& content) -> iocoro::test::unique_fd {
+  std::string path = "/tmp/iocoro_sendfile_XXXXXX";
+  iocoro::test::unique_fd fd{::mkstemp(path.data())};
+  if (fd.get() < 0) {
+    return fd;
+  }
+  ::unlink(path.c_str());
+  std::size_t done = 0;
+  while (done < content.size()) {
+    auto const n = ::write(fd.get(), content.data() + done, content.size() - done);
+    if (n <= 0) {
+      return iocoro::test::unique_fd{};
+    }
+    done += static_cast<std::size_t>(n);
+  }
+  return fd;
+}
+
+auto make_pattern(std::size_t size) -> std::string {
+  std::string s(size, '\0');
+  for (std::size_t i = 0; i < size; ++i) {
+    s[i] = static_cast<char>('a' + (i * 7) % 26);
+  }
+  return s;
+}
+
+// Accept one connection and collect everything it sends until EOF.
+auto collect_one_connection(int listen_fd, std::string& out) -> std::thread {
+  return std::thread([listen_fd, &out] {
+    int client = ::accept(listen_fd, nullptr, nullptr);
+    if (client < 0) {
+      return;
+    }
+    std::array<char, 64 * 1024> buf{};
+    for (;;) {
+      auto n = ::recv(client, buf.data(), buf.size(), 0);
+      if (n <= 0) {
+        break;
+      }
+      out.append(buf.data(), static_cast<std::size_t>(n));
+    }
+    (void)::close(client);
+  });
+}
+
+}  // namespace
+
+TEST(async_sendfile_test, sends_the_requested_range_and_leaves_the_file_position_alone) {
+  auto const content = make_pattern(3 * 1024 * 1024 + 17);
+  auto file = make_temp_file(content);
+  ASSERT_GE(file.get(), 0);
+  ASSERT_EQ(::lseek(file.get(), 0, SEEK_SET), 0);
+
+  auto [listen_fd, port] = iocoro::test::make_listen_socket_ipv4();
+  ASSERT_GE(listen_fd.get(), 0);
+  std::string received;
+  auto server = collect_one_connection(listen_fd.get(), received);
+
+  iocoro::io_context ctx;
+  iocoro::ip::tcp::socket sock{ctx};
+  std::size_t const offset = 1000;
+  std::size_t const count = content.size() - 2000;
+
+  auto r = iocoro::test::sync_wait(ctx, [&]() -> iocoro::awaitable<iocoro::result<std::size_t>> {
+    auto cr = co_await sock.async_connect(
+      iocoro::ip::tcp::endpoint{iocoro::ip::address_v4::loopback(), port});
+    if (!cr) {
+      co_return iocoro::unexpected(cr.error());
+    }
+    co_return co_await iocoro::io::async_sendfile(sock, file.get(), offset, count);
+  }());
+  (void)sock.close();
+  server.join();
+
+  ASSERT_TRUE(r);
+  ASSERT_TRUE(*r) << r->error().message();
+  EXPECT_EQ(**r, count);
+  EXPECT_TRUE(received == content.substr(offset, count));
+  EXPECT_EQ(::lseek(file.get(), 0, SEEK_CUR), 0);
+}
+
+TEST(async_sendfile_test, returns_eof_when_the_file_ends_before_count) {
+  auto const content = make_pattern(100);
+  auto file = make_temp_file(content);
+  ASSERT_GE(file.get(), 0);
+
+  auto [listen_fd, port] = iocoro::test::make_listen_socket_ipv4();
+  ASSERT_GE(listen_fd.get(), 0);
+  std::string received;
+  auto server = collect_one_connection(listen_fd.get(), received);
+
+  iocoro::io_context ctx;
+  iocoro::ip::tcp::socket sock{ctx};
+  iocoro::result<std::size_t> at_end{};
+
+  auto r = iocoro::test::sync_wait(ctx, [&]() -> iocoro::awaitable<iocoro::result<std::size_t>> {
+    auto cr = co_await sock.async_connect(
+      iocoro::ip::tcp::endpoint{iocoro::ip::address_v4::loopback(), port});
+    if (!cr) {
+      co_return iocoro::unexpected(cr.error());
+    }
+    at_end = co_await sock.async_sendfile_some(file.get(), content.size(), 10);
+    co_return co_await iocoro::io::async_sendfile(sock, file.get(), 50, 100);
+  }());
+  (void)sock.close();
+  server.join();
+
+  ASSERT_TRUE(r);
+  ASSERT_FALSE(*r);
+  EXPECT_EQ(r->error(), iocoro::error::eof);
+  ASSERT_TRUE(at_end);
+  EXPECT_EQ(*at_end, 0U);
+  EXPECT_EQ(received, content.substr(50));
+}
+
+TEST(async_sendfile_test, rejects_an_invalid_file_descriptor) {
+  auto [listen_fd, port] = iocoro::test::make_listen_socket_ipv4();
+  ASSERT_GE(listen_fd.get(), 0);
+  std::string received;
+  auto server = collect_one_connection(listen_fd.get(), received);
+
+  iocoro::io_context ctx;
+  iocoro::ip::tcp::socket sock{ctx};
+
+  auto r = iocoro::test::sync_wait(ctx, [&]() -> iocoro::awaitable<iocoro::result<std::size_t>> {
+    auto cr = co_await sock.async_connect(
+      iocoro::ip::tcp::endpoint{iocoro::ip::address_v4::loopback(), port});
+    if (!cr) {
+      co_return iocoro::unexpected(cr.error());
+    }
+    co_return co_await iocoro::io::async_sendfile(sock, -1, 0, 10);
+  }());
+  (void)sock.close();
+  server.join();
+
+  ASSERT_TRUE(r);
+  ASSERT_FALSE(*r);
+  EXPECT_EQ(r->error(), iocoro::error::invalid_argument);
+  EXPECT_TRUE(received.empty());
+}
+
+TEST(async_sendfile_test, reset_connection_fails_without_raising_sigpipe) {
+  auto [listen_fd, port] = iocoro::test::make_listen_socket_ipv4();
+  ASSERT_GE(listen_fd.get(), 0);
+  auto file = make_temp_file(make_pattern(64 * 1024));
+  ASSERT_GE(file.get(), 0);
+
+  // The peer aborts the connection (RST) once the client has seen it established.
+  std::promise<void> connected;
+  std::thread server([fd = listen_fd.get(), established = connected.get_future()] {
+    int client = ::accept(fd, nullptr, nullptr);
+    if (client < 0) {
+      return;
+    }
+    established.wait();
+    ::linger const abort_on_close{1, 0};
+    (void)::setsockopt(client, SOL_SOCKET, SO_LINGER, &abort_on_close, sizeof(abort_on_close));
+    (void)::close(client);
+  });
+
+  // With the default disposition a stray SIGPIPE would end the test process.
+  auto const old_sigpipe = std::signal(SIGPIPE, SIG_DFL);
+  iocoro::io_context ctx;
+  iocoro::ip::tcp::socket sock{ctx};
+
+  auto r = iocoro::test::sync_wait(ctx, [&]() -> iocoro::awaitable<iocoro::result<std::size_t>> {
+    auto cr = co_await sock.async_connect(
+      iocoro::ip::tcp::endpoint{iocoro::ip::address_v4::loopback(), port});
+    connected.set_value();
+    server.join();
+    if (!cr) {
+      co_return iocoro::unexpected(cr.error());
+    }
+    // The first failure may report the reset itself; the sends after it fail with EPIPE, the
+    // error that comes with SIGPIPE.
+    iocoro::result<std::size_t> n{};
+    for (int i = 0; i < 100; ++i) {
+      n = co_await sock.async_sendfile_some(file.get(), 0, 64 * 1024);
+      if (!n && n.error() == iocoro::error::broken_pipe) {
+        break;
+      }
+    }
+    co_return n;
+  }());
+  std::signal(SIGPIPE, old_sigpipe);
+
+  ASSERT_TRUE(r);
+  ASSERT_FALSE(*r);
+  EXPECT_EQ(r->error(), iocoro::error::broken_pipe) << r->error().message();
+}
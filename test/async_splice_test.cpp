@@ -0,0 +1,209 @@
+#include <gtest/gtest.h>
+
+#include <iocoro/error.hpp>
+#include <iocoro/io/splice.hpp>
+#include <iocoro/io_context.hpp>
+#include <iocoro/ip/tcp.hpp>
+#include <iocoro/shutdown.hpp>
+
+#include "test_util.hpp"
+
+#include <array>
+#include <csignal>
+#include <cstddef>
+#include <future>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <utility>
+
+#include <fcntl.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+namespace {
+
+auto make_pattern(std::size_t size) -> std::string {
+  std::string s(size, '\0');
+  for (std::size_t i = 0; i < size; ++i) {
+    s[i] = static_cast<char>('a' + (i * 11) % 26);
+  }
+  return s;
+}
+
+auto send_all(int fd, std::string const& data) -> bool {
+  std::size_t done = 0;
+  while (done < data.size()) {
+    auto const n = ::send(fd, data.data() + done, data.size() - done, MSG_NOSIGNAL);
+    if (n <= 0) {
+      return false;
+    }
+    done += static_cast<std::size_t>(n);
+  }
+  return true;
+}
+
+}  // namespace
+
+TEST(async_splice_test, forwards_a_bounded_prefix_then_the_rest_until_end_of_stream) {
+  auto const content = make_pattern(2 * 1024 * 1024 + 5);
+  auto [listen_fd, port] = iocoro::test::make_listen_socket_ipv4();
+  ASSERT_GE(listen_fd.get(), 0);
+
+  // First connection: the source, which sends `content` and closes. Second: the sink.
+  std::string received;
+  std::thread peers([fd = listen_fd.get(), &content, &received] {
+    iocoro::test::unique_fd source{::accept(fd, nullptr, nullptr)};
+    iocoro::test::unique_fd sink{::accept(fd, nullptr, nullptr)};
+    if (source.get() < 0 || sink.get() < 0) {
+      return;
+    }
+    std::thread writer([&] {
+      (void)send_all(source.get(), content);
+      ::shutdown(source.get(), SHUT_WR);
+    });
+    std::array<char, 64 * 1024> buf{};
+    for (;;) {
+      auto n = ::recv(sink.get(), buf.data(), buf.size(), 0);
+      if (n <= 0) {
+        break;
+      }
+      received.append(buf.data(), static_cast<std::size_t>(n));
+    }
+    writer.join();
+  });
+
+  iocoro::io_context ctx;
+  iocoro::ip::tcp::socket in{ctx};
+  iocoro::ip::tcp::socket out{ctx};
+  iocoro::ip::tcp::endpoint const ep{iocoro::ip::address_v4::loopback(), port};
+
+  iocoro::result<std::size_t> prefix{};
+  auto r = iocoro::test::sync_wait(ctx, [&]() -> iocoro::awaitable<iocoro::result<std::size_t>> {
+    if (auto cr = co_await in.async_connect(ep); !cr) {
+      co_return iocoro::unexpected(cr.error());
+    }
+    if (auto cr = co_await out.async_connect(ep); !cr) {
+      co_return iocoro::unexpected(cr.error());
+    }
+    prefix = co_await iocoro::io::async_splice(in, out, 1000);
+    auto rest = co_await iocoro::io::async_splice(in, out);
+    (void)out.shutdown(iocoro::shutdown_type::send);
+    co_return rest;
+  }());
+  peers.join();
+
+  ASSERT_TRUE(r);
+  ASSERT_TRUE(*r) << r->error().message();
+  ASSERT_TRUE(prefix) << prefix.error().message();
+  EXPECT_EQ(*prefix, 1000U);
+  EXPECT_EQ(**r, content.size() - 1000);
+  EXPECT_TRUE(received == content);
+}
+
+TEST(async_splice_test, primitives_require_a_connected_socket) {
+  iocoro::io_context ctx;
+  iocoro::ip::tcp::socket sock{ctx};
+  int pipe_fds[2]{-1, -1};
+  ASSERT_EQ(::pipe(pipe_fds), 0);
+
+  auto r = iocoro::test::sync_wait(ctx, [&]() -> iocoro::awaitable<iocoro::result<std::size_t>> {
+    co_return co_await sock.async_splice_read_some(pipe_fds[1], 16);
+  }());
+
+  ASSERT_TRUE(r);
+  ASSERT_FALSE(*r);
+  EXPECT_EQ(r->error(), iocoro::error::not_open);
+  ::close(pipe_fds[0]);
+  ::close(pipe_fds[1]);
+}
+
+TEST(async_splice_test, pipe_side_that_would_block_fails_instead_of_waiting) {
+  auto [listen_fd, port] = iocoro::test::make_listen_socket_ipv4();
+  ASSERT_GE(listen_fd.get(), 0);
+  std::thread peer([fd = listen_fd.get()] {
+    iocoro::test::unique_fd conn{::accept(fd, nullptr, nullptr)};
+    std::array<char, 16> buf{};
+    // Hold the connection until the client closes it.
+    while (conn.get() >= 0 && ::recv(conn.get(), buf.data(), buf.size(), 0) > 0) {
+    }
+  });
+
+  int pipe_fds[2]{-1, -1};
+  ASSERT_EQ(::pipe2(pipe_fds, O_NONBLOCK), 0);
+  iocoro::test::unique_fd const pipe_read{pipe_fds[0]};
+  iocoro::test::unique_fd const pipe_write{pipe_fds[1]};
+
+  iocoro::io_context ctx;
+  iocoro::ip::tcp::socket sock{ctx};
+  iocoro::ip::tcp::endpoint const ep{iocoro::ip::address_v4::loopback(), port};
+
+  auto r = iocoro::test::sync_wait(ctx, [&]() -> iocoro::awaitable<iocoro::result<std::size_t>> {
+    if (auto cr = co_await sock.async_connect(ep); !cr) {
+      co_return iocoro::unexpected(cr.error());
+    }
+    // The pipe is empty: there is nothing to send, however writable the socket is.
+    auto w = co_await sock.async_splice_write_some(pipe_read.get(), 16);
+    (void)sock.close();
+    co_return w;
+  }());
+  peer.join();
+
+  ASSERT_TRUE(r);
+  ASSERT_FALSE(*r);
+  EXPECT_EQ(r->error(), std::errc::resource_unavailable_try_again);
+}
+
+TEST(async_splice_test, reset_connection_fails_without_raising_sigpipe) {
+  auto [listen_fd, port] = iocoro::test::make_listen_socket_ipv4();
+  ASSERT_GE(listen_fd.get(), 0);
+  int pipe_fds[2]{-1, -1};
+  ASSERT_EQ(::pipe2(pipe_fds, O_NONBLOCK), 0);
+  iocoro::test::unique_fd const pipe_read{pipe_fds[0]};
+  iocoro::test::unique_fd const pipe_write{pipe_fds[1]};
+  std::string const chunk = make_pattern(4096);
+
+  // The peer aborts the connection (RST) once the client has seen it established.
+  std::promise<void> connected;
+  std::thread peer([fd = listen_fd.get(), established = connected.get_future()] {
+    int conn = ::accept(fd, nullptr, nullptr);
+    if (conn < 0) {
+      return;
+    }
+    established.wait();
+    ::linger const abort_on_close{1, 0};
+    (void)::setsockopt(conn, SOL_SOCKET, SO_LINGER, &abort_on_close, sizeof(abort_on_close));
+    (void)::close(conn);
+  });
+
+  // With the default disposition a stray SIGPIPE would end the test process.
+  auto const old_sigpipe = std::signal(SIGPIPE, SIG_DFL);
+  iocoro::io_context ctx;
+  iocoro::ip::tcp::socket sock{ctx};
+  iocoro::ip::tcp::endpoint const ep{iocoro::ip::address_v4::loopback(), port};
+
+  auto r = iocoro::test::sync_wait(ctx, [&]() -> iocoro::awaitable<iocoro::result<std::size_t>> {
+    auto cr = co_await sock.async_connect(ep);
+    connected.set_value();
+    peer.join();
+    if (!cr) {
+      co_return iocoro::unexpected(cr.error());
+    }
+    // The first failure may report the reset itself; the writes after it fail with EPIPE, the
+    // error that comes with SIGPIPE.
+    iocoro::result<std::size_t> n{};
+    for (int i = 0; i < 100; ++i) {
+      (void)::write(pipe_write.get(), chunk.data(), chunk.size());
+      n = co_await sock.async_splice_write_some(pipe_read.get(), chunk.size());
+      if (!n && n.error() == iocoro::error::broken_pipe) {
+        break;
+      }
+    }
+    co_return n;
+  }());
+  std::signal(SIGPIPE, old_sigpipe);
+
+  ASSERT_TRUE(r);
+  ASSERT_FALSE(*r);
+  EXPECT_EQ(r->error(), iocoro::error::broken_pipe) << r->error().message();
+}
@@ -49,6 +49,31 @@ struct mock_write_stream {
   }
 };
 
+// Records each gather write; accepts at most `max_chunk` bytes per call.
+struct mock_gather_write_stream : mock_write_stream {
+  std::size_t gather_calls{0};
+
+  using mock_write_stream::async_write_some;
+
+  auto async_write_some(std::span<iocoro::net::const_buffer const> bufs)
+    -> iocoro::awaitable<iocoro::result<std::size_t>> {
+    ++gather_calls;
+    std::size_t n = 0;
+    for (auto const& b : bufs) {
+      auto const take = std::min(b.size(), max_chunk - n);
+      data.append(static_cast<char const*>(b.data()), take);
+      n += take;
+      if (n == max_chunk) {
+        break;
+      }
+    }
+    co_return iocoro::result<std::size_t>(n);
+  }
+};
+
+static_assert(iocoro::io::async_gather_write_stream<mock_gather_write_stream>);
+static_assert(!iocoro::io::async_gather_write_stream<mock_write_stream>);
+
 }  // namespace
 
 TEST(async_write_test, writes_entire_buffer) {
@@ -134,3 +159,45 @@ TEST(async_write_test, error_after_partial_progress_is_propagated) {
   EXPECT_EQ(r->error(), std::make_error_code(std::errc::io_error));
   EXPECT_EQ(s.data.size(), 2U);
 }
+
+TEST(async_write_test, buffer_sequence_is_gathered_across_partial_writes) {
+  iocoro::io_context ctx;
+  mock_gather_write_stream s{};
+  s.max_chunk = 4;
+  s.ex = ctx.get_executor();
+
+  std::string const header = "HTTP ";
+  std::string const body = "body";
+  std::string const trailer = "!\n";
+  std::array<iocoro::net::const_buffer, 4> seq{
+    iocoro::net::buffer(header), iocoro::net::const_buffer{}, iocoro::net::buffer(body),
+    iocoro::net::buffer(trailer)};
+
+  auto r = iocoro::test::sync_wait(ctx, [&]() -> iocoro::awaitable<iocoro::result<std::size_t>> {
+    co_return co_await iocoro::io::async_write(s, seq);
+  }());
+
+  ASSERT_TRUE(r);
+  ASSERT_TRUE(*r);
+  EXPECT_EQ(**r, 11U);
+  EXPECT_EQ(s.data, "HTTP body!\n");
+  EXPECT_EQ(s.gather_calls, 3U);
+}
+
+TEST(async_write_test, buffer_sequence_falls_back_to_one_buffer_per_write) {
+  iocoro::io_context ctx;
+  mock_write_stream s{.data = {}, .max_chunk = 3, .ex = ctx.get_executor()};
+
+  std::string const a = "abcd";
+  std::string const b = "ef";
+  std::array<iocoro::net::const_buffer, 2> seq{iocoro::net::buffer(a), iocoro::net::buffer(b)};
+
+  auto r = iocoro::test::sync_wait(ctx, [&]() -> iocoro::awaitable<iocoro::result<std::size_t>> {
+    co_return co_await iocoro::io::async_write(s, seq);
+  }());
+
+  ASSERT_TRUE(r);
+  ASSERT_TRUE(*r);
+  EXPECT_EQ(**r, 6U);
+  EXPECT_EQ(s.data, "abcdef");
+}
@@ -0,0 +1,82 @@
+#include <gtest/gtest.h>
+
+#include <iocoro/detail/block_cache.hpp>
+#include <iocoro/detail/reactor_types.hpp>
+
+#include <cstddef>
+#include <system_error>
+#include <thread>
+
+namespace {
+
+using iocoro::detail::block_cache;
+
+struct noop_state {
+  int* completed = nullptr;
+
+  void on_complete() noexcept { ++*completed; }
+  void on_abort(std::error_code) noexcept {}
+};
+
+}  // namespace
+
+TEST(block_cache_test, freed_block_is_reused_for_same_size_class) {
+  if (!block_cache::caching_enabled) {
+    GTEST_SKIP() << "block caching is disabled under AddressSanitizer";
+  }
+  void* a = block_cache::allocate(40);
+  block_cache::deallocate(a, 40);
+  // 40 and 64 bytes share the first size class.
+  void* b = block_cache::allocate(64);
+  EXPECT_EQ(a, b);
+  block_cache::deallocate(b, 64);
+}
+
+TEST(block_cache_test, large_blocks_bypass_the_cache) {
+  auto const before = block_cache::cached_count();
+  void* p = block_cache::allocate(block_cache::max_cached_size + 1);
+  ASSERT_NE(p, nullptr);
+  block_cache::deallocate(p, block_cache::max_cached_size + 1);
+  EXPECT_EQ(block_cache::cached_count(), before);
+}
+
+TEST(block_cache_test, per_class_cache_is_bounded) {
+  if (!block_cache::caching_enabled) {
+    GTEST_SKIP() << "block caching is disabled under AddressSanitizer";
+  }
+  constexpr std::size_t n = block_cache::max_blocks_per_class + 16;
+  void* blocks[n]{};
+  for (auto& b : blocks) {
+    b = block_cache::allocate(block_cache::max_cached_size);
+  }
+  auto const before = block_cache::cached_count();
+  for (auto* b : blocks) {
+    block_cache::deallocate(b, block_cache::max_cached_size);
+  }
+  EXPECT_LE(block_cache::cached_count() - before, block_cache::max_blocks_per_class);
+}
+
+TEST(block_cache_test, reactor_op_is_a_single_recycled_allocation) {
+  if (!block_cache::caching_enabled) {
+    GTEST_SKIP() << "block caching is disabled under AddressSanitizer";
+  }
+  int completed = 0;
+  void* first = nullptr;
+  {
+    auto op = iocoro::detail::make_reactor_op<noop_state>(noop_state{&completed});
+    first = op.get();
+    EXPECT_EQ(op->block, static_cast<void*>(op.get()));
+    op->vt->on_complete(op->block);
+  }
+  auto op = iocoro::detail::make_reactor_op<noop_state>(noop_state{&completed});
+  EXPECT_EQ(static_cast<void*>(op.get()), first);
+  op->vt->on_complete(op->block);
+  EXPECT_EQ(completed, 2);
+}
+
+TEST(block_cache_test, block_freed_on_another_thread_is_released_safely) {
+  void* p = block_cache::allocate(32);
+  std::thread t{[p] { block_cache::deallocate(p, 32); }};
+  t.join();
+  SUCCEED();
+}
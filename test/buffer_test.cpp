@@ -29,3 +29,35 @@ TEST(buffer_test, buffer_cast_returns_underlying_pointer) {
   auto const* const_ptr = iocoro::net::buffer_cast<std::byte const*>(const_buf);
   EXPECT_EQ(const_ptr, storage.data());
 }
+
+static_assert(iocoro::net::const_buffer_sequence<std::array<iocoro::net::const_buffer, 2>>);
+static_assert(iocoro::net::const_buffer_sequence<std::array<iocoro::net::mutable_buffer, 2>>);
+static_assert(iocoro::net::mutable_buffer_sequence<std::array<iocoro::net::mutable_buffer, 2>>);
+static_assert(!iocoro::net::mutable_buffer_sequence<std::array<iocoro::net::const_buffer, 2>>);
+static_assert(!iocoro::net::const_buffer_sequence<std::array<std::byte, 2>>);
+
+TEST(buffer_test, consuming_buffers_resumes_mid_buffer_and_skips_empty_ones) {
+  std::array<char, 8> storage{};
+  std::array<iocoro::net::const_buffer, 4> seq{
+    iocoro::net::const_buffer{storage.data(), 3},
+    iocoro::net::const_buffer{},
+    iocoro::net::const_buffer{storage.data() + 3, 4},
+    iocoro::net::const_buffer{storage.data() + 7, 1},
+  };
+  EXPECT_EQ(iocoro::net::buffer_size(seq), 8U);
+
+  iocoro::net::detail::consuming_buffers<iocoro::net::const_buffer, decltype(seq)> rest{seq};
+  ASSERT_FALSE(rest.empty());
+  EXPECT_EQ(rest.prepare().size(), 3U);
+
+  rest.consume(5);
+  auto const bufs = rest.prepare();
+  ASSERT_EQ(bufs.size(), 2U);
+  EXPECT_EQ(bufs[0].data(), storage.data() + 5);
+  EXPECT_EQ(bufs[0].size(), 2U);
+  EXPECT_EQ(bufs[1].data(), storage.data() + 7);
+
+  rest.consume(3);
+  EXPECT_TRUE(rest.empty());
+  EXPECT_TRUE(rest.prepare().empty());
+}
@@ -0,0 +1,1043 @@
+#include <gtest/gtest.h>
+
+#include <iocoro/co_spawn.hpp>
+#include <iocoro/detail/io_context_impl.hpp>
+#include <iocoro/detail/reactor_backend.hpp>
+#include <iocoro/detail/socket/acceptor_impl.hpp>
+#include <iocoro/detail/socket/datagram_socket_impl.hpp>
+#include <iocoro/detail/socket/stream_socket_impl.hpp>
+#include <iocoro/io/sendfile.hpp>
+#include <iocoro/io_context.hpp>
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstring>
+#include <deque>
+#include <functional>
+#include <memory>
+#include <mutex>
+#include <optional>
+#include <set>
+#include <span>
+#include <string>
+#include <system_error>
+#include <thread>
+#include <vector>
+
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <sys/stat.h>
+#include <unistd.h>
+
+using namespace std::chrono_literals;
+
+namespace {
+
+using iocoro::detail::io_request;
+
+// Completion backend emulated in user space on top of the default (readiness) backend.
+//
+// Submitted operations run as non-blocking syscalls at the end of every wait and stay queued
+// while they would block, much like io_uring arms an internal poll. This exercises the socket
+// layer's completion path without requiring io_uring in the test environment.
+class emulated_completion_backend final : public iocoro::detail::backend_interface {
+ public:
+  struct counters {
+    std::atomic<int> submitted{0};
+    std::atomic<int> cancelled{0};
+    std::atomic<int> recycled{0};
+    std::atomic<int> registered_files{0};
+    std::atomic<int> fixed_file_ops{0};
+    std::array<std::atomic<int>, 12> by_opcode{};
+    // Pipes (by inode) that splice requests filled from a file.
+    std::mutex pipes_mtx{};
+    std::set<ino_t> file_to_pipe{};
+  };
+
+  // `single_issuer`: like IORING_SETUP_SINGLE_ISSUER, `wait()` from any thread but the first
+  // one to wait fails with EEXIST.
+  explicit emulated_completion_backend(counters* c, bool single_issuer = false)
+      : inner_(iocoro::detail::make_backend()),
+        counters_(c),
+        single_issuer_(single_issuer),
+        buffers_(std::size_t{iocoro::detail::provided_buffer_count} *
+                 iocoro::detail::provided_buffer_size) {
+    for (std::uint32_t id = 0; id < iocoro::detail::provided_buffer_count; ++id) {
+      free_buffers_.push_back(id);
+    }
+  }
+
+  void add_fd(int fd) override { inner_->add_fd(fd); }
+  void remove_fd(int fd) noexcept override { inner_->remove_fd(fd); }
+
+  auto wait(std::optional<std::chrono::steady_clock::duration> timeout,
+            std::vector<iocoro::detail::backend_event>& out) -> void override {
+    if (single_issuer_) {
+      auto const self = std::this_thread::get_id();
+      if (issuer_ == std::thread::id{}) {
+        issuer_ = self;
+      } else if (issuer_ != self) {
+        throw std::system_error(EEXIST, std::generic_category(), "wait from a second thread");
+      }
+    }
+    {
+      std::scoped_lock lk{mtx_};
+      if (!pending_.empty() || !done_.empty() || !streams_.empty()) {
+        // Re-try blocked operations frequently instead of tracking their readiness.
+        auto const cap = done_.empty() ? std::chrono::steady_clock::duration{1ms}
+                                       : std::chrono::steady_clock::duration::zero();
+        timeout = timeout ? std::min(*timeout, cap) : cap;
+      }
+    }
+    inner_->wait(timeout, out);
+
+    std::unique_lock lk{mtx_};
+    for (auto it = pending_.begin(); it != pending_.end();) {
+      auto const res = execute(it->req, registered_buffers_);
+      if (res == -EAGAIN || res == -EWOULDBLOCK) {
+        ++it;
+        continue;
+      }
+      *it->req.result = res;
+      done_.push_back(std::move(it->op));
+      it = pending_.erase(it);
+    }
+    run_streams(lk);
+  }
+
+  void prepare_wait() noexcept override { inner_->prepare_wait(); }
+  void wakeup() noexcept override { inner_->wakeup(); }
+
+  auto supports_io() const noexcept -> bool override { return true; }
+  auto supports_io_op(io_request::opcode op) const noexcept -> bool override {
+    return ((refused_ops_ >> static_cast<unsigned>(op)) & 1U) == 0;
+  }
+  // Report `op` as unsupported; call before the io_context is built on this backend.
+  void refuse(io_request::opcode op) noexcept { refused_ops_ |= 1U << static_cast<unsigned>(op); }
+  auto single_issuer() const noexcept -> bool override { return single_issuer_; }
+  auto supports_multishot() const noexcept -> bool override { return true; }
+
+  auto submit_io(io_request const& req, iocoro::detail::reactor_op_ptr op)
+    -> std::uint64_t override {
+    std::uint64_t id = 0;
+    {
+      std::scoped_lock lk{mtx_};
+      if (req.fixed_file >= 0) {
+        // The slot must still map to the request's socket.
+        EXPECT_EQ(files_.at(static_cast<std::size_t>(req.fixed_file)), req.fd);
+        counters_->fixed_file_ops.fetch_add(1, std::memory_order_relaxed);
+      }
+      id = next_id_++;
+      pending_.push_back(entry{id, req, std::move(op)});
+    }
+    if (req.op == io_request::opcode::splice && req.splice_in_offset >= 0) {
+      struct stat st{};
+      if (::fstat(req.splice_out, &st) == 0) {
+        std::scoped_lock lk{counters_->pipes_mtx};
+        counters_->file_to_pipe.insert(st.st_ino);
+      }
+    }
+    counters_->submitted.fetch_add(1, std::memory_order_relaxed);
+    counters_->by_opcode[static_cast<std::size_t>(req.op)].fetch_add(1,
+                                                                     std::memory_order_relaxed);
+    inner_->wakeup();
+    return id;
+  }
+
+  auto submit_multishot(io_request const& req,
+                        std::shared_ptr<iocoro::detail::io_stream_sink> sink)
+    -> std::uint64_t override {
+    std::uint64_t id = 0;
+    {
+      std::scoped_lock lk{mtx_};
+      id = next_id_++;
+      streams_.push_back(stream{id, req, std::move(sink)});
+    }
+    counters_->submitted.fetch_add(1, std::memory_order_relaxed);
+    counters_->by_opcode[static_cast<std::size_t>(req.op)].fetch_add(1,
+                                                                     std::memory_order_relaxed);
+    inner_->wakeup();
+    return id;
+  }
+
+  auto provided_buffer(std::uint32_t id) noexcept -> std::span<std::byte> override {
+    return std::span{buffers_}.subspan(std::size_t{id} * iocoro::detail::provided_buffer_size,
+                                       iocoro::detail::provided_buffer_size);
+  }
+
+  void recycle_buffer(std::uint32_t id) noexcept override {
+    std::scoped_lock lk{mtx_};
+    free_buffers_.push_back(id);
+    counters_->recycled.fetch_add(1, std::memory_order_relaxed);
+  }
+
+  auto register_file(int fd) noexcept -> std::int32_t override {
+    std::scoped_lock lk{mtx_};
+    auto it = std::find(files_.begin(), files_.end(), -1);
+    if (it == files_.end()) {
+      return -1;
+    }
+    *it = fd;
+    counters_->registered_files.fetch_add(1, std::memory_order_relaxed);
+    return static_cast<std::int32_t>(it - files_.begin());
+  }
+
+  void unregister_file(std::int32_t slot) noexcept override {
+    std::scoped_lock lk{mtx_};
+    files_[static_cast<std::size_t>(slot)] = -1;
+    counters_->registered_files.fetch_sub(1, std::memory_order_relaxed);
+  }
+
+  auto register_buffers(std::span<std::span<std::byte> const> buffers) -> int override {
+    std::scoped_lock lk{mtx_};
+    registered_buffers_.assign(buffers.begin(), buffers.end());
+    return 0;
+  }
+
+  void cancel_io(std::uint64_t id) noexcept override {
+    std::shared_ptr<iocoro::detail::io_stream_sink> sink{};
+    {
+      std::scoped_lock lk{mtx_};
+      if (auto st = std::find_if(streams_.begin(), streams_.end(),
+                                 [id](stream const& e) { return e.id == id; });
+          st != streams_.end()) {
+        sink = std::move(st->sink);
+        streams_.erase(st);
+      } else {
+        auto it = std::find_if(pending_.begin(), pending_.end(),
+                               [id](entry const& e) { return e.id == id; });
+        if (it == pending_.end()) {
+          return;
+        }
+        *it->req.result = -ECANCELED;
+        done_.push_back(std::move(it->op));
+        pending_.erase(it);
+      }
+    }
+    counters_->cancelled.fetch_add(1, std::memory_order_relaxed);
+    if (sink) {
+      sink->on_result(-ECANCELED, iocoro::detail::no_provided_buffer, false);
+    }
+    inner_->wakeup();
+  }
+
+  void take_completions(std::vector<iocoro::detail::reactor_op_ptr>& out) override {
+    std::scoped_lock lk{mtx_};
+    for (auto& op : done_) {
+      out.push_back(std::move(op));
+    }
+    done_.clear();
+  }
+
+  void drain_io(std::vector<iocoro::detail::reactor_op_ptr>& out) noexcept override {
+    std::deque<stream> streams{};
+    {
+      std::scoped_lock lk{mtx_};
+      for (auto& op : done_) {
+        out.push_back(std::move(op));
+      }
+      done_.clear();
+      for (auto& e : pending_) {
+        out.push_back(std::move(e.op));
+      }
+      pending_.clear();
+      streams.swap(streams_);
+    }
+    for (auto& st : streams) {
+      st.sink->on_result(-ECANCELED, iocoro::detail::no_provided_buffer, false);
+    }
+  }
+
+ private:
+  struct entry {
+    std::uint64_t id = 0;
+    io_request req{};
+    iocoro::detail::reactor_op_ptr op{};
+  };
+  struct stream {
+    std::uint64_t id = 0;
+    io_request req{};
+    std::shared_ptr<iocoro::detail::io_stream_sink> sink{};
+  };
+
+  // One result at a time per stream, delivered unlocked: a sink may cancel its own stream.
+  void run_streams(std::unique_lock<std::mutex>& lk) {
+    std::vector<std::uint64_t> ids{};
+    for (auto const& st : streams_) {
+      ids.push_back(st.id);
+    }
+    for (auto const id : ids) {
+      for (;;) {
+        auto st = std::find_if(streams_.begin(), streams_.end(),
+                               [id](stream const& e) { return e.id == id; });
+        if (st == streams_.end()) {
+          break;
+        }
+        std::int32_t res = 0;
+        std::uint32_t buffer = iocoro::detail::no_provided_buffer;
+        if (st->req.op == io_request::opcode::accept_multishot) {
+          res = ::accept4(st->req.fd, nullptr, nullptr, st->req.flags);
+        } else if (free_buffers_.empty()) {
+          res = -ENOBUFS;
+          errno = ENOBUFS;
+        } else {
+          buffer = free_buffers_.front();
+          auto const b = provided_buffer(buffer);
+          res = static_cast<std::int32_t>(::recv(st->req.fd, b.data(), b.size(), MSG_DONTWAIT));
+          if (res > 0) {
+            free_buffers_.pop_front();
+          } else {
+            buffer = iocoro::detail::no_provided_buffer;
+          }
+        }
+        if (res < 0) {
+          res = -errno;
+        }
+        if (res == -EAGAIN || res == -EWOULDBLOCK) {
+          break;
+        }
+        // Accepts go on after errors; receives end with EOF or any error.
+        bool const more =
+          st->req.op == io_request::opcode::accept_multishot || res > 0;
+        auto sink = st->sink;
+        if (!more) {
+          streams_.erase(st);
+        }
+        lk.unlock();
+        sink->on_result(res, buffer, more);
+        lk.lock();
+        if (!more) {
+          break;
+        }
+      }
+    }
+  }
+
+  static auto execute(io_request const& r, std::vector<std::span<std::byte>> const& fixed) -> int {
+    if (r.op == io_request::opcode::read_fixed || r.op == io_request::opcode::write_fixed) {
+      // The bytes must lie inside the registered buffer the request names.
+      auto const* p = static_cast<std::byte const*>(r.data);
+      if (r.buf_index >= fixed.size() || p < fixed[r.buf_index].data() ||
+          p + r.size > fixed[r.buf_index].data() + fixed[r.buf_index].size()) {
+        return -EFAULT;
+      }
+    }
+    long n = -1;
+    switch (r.op) {
+      case io_request::opcode::recv:
+        n = ::recv(r.fd, r.data, r.size, r.flags | MSG_DONTWAIT);
+        break;
+      case io_request::opcode::send:
+      case io_request::opcode::send_zc:
+        n = ::send(r.fd, r.data, r.size, r.flags | MSG_DONTWAIT);
+        break;
+      case io_request::opcode::accept:
+        n = ::accept4(r.fd, r.addr, r.addr_len, r.flags);
+        break;
+      case io_request::opcode::connect:
+        n = ::connect(r.fd, r.addr, r.connect_len);
+        break;
+      case io_request::opcode::recvmsg:
+        n = ::recvmsg(r.fd, r.msg, r.flags | MSG_DONTWAIT);
+        break;
+      case io_request::opcode::sendmsg:
+        n = ::sendmsg(r.fd, r.msg, r.flags | MSG_DONTWAIT);
+        break;
+      case io_request::opcode::read_fixed:
+        n = ::recv(r.fd, r.data, r.size, MSG_DONTWAIT);
+        break;
+      case io_request::opcode::write_fixed:
+        n = ::send(r.fd, r.data, r.size, MSG_DONTWAIT | MSG_NOSIGNAL);
+        break;
+      case io_request::opcode::splice: {
+        loff_t off = r.splice_in_offset;
+        n = ::splice(r.splice_in < 0 ? r.fd : r.splice_in, r.splice_in_offset < 0 ? nullptr : &off,
+                     r.splice_out < 0 ? r.fd : r.splice_out, nullptr, r.size,
+                     static_cast<unsigned>(r.flags) | SPLICE_F_NONBLOCK);
+        break;
+      }
+      case io_request::opcode::accept_multishot:
+      case io_request::opcode::recv_multishot:
+        // Armed through submit_multishot() and run by run_streams().
+        errno = EINVAL;
+        break;
+    }
+    return n < 0 ? -errno : static_cast<int>(n);
+  }
+
+  std::unique_ptr<iocoro::detail::backend_interface> inner_;
+  counters* counters_;
+  bool single_issuer_ = false;
+  std::uint32_t refused_ops_ = 0;
+  std::thread::id issuer_{};
+  std::mutex mtx_{};
+  std::deque<entry> pending_{};
+  std::vector<iocoro::detail::reactor_op_ptr> done_{};
+  std::deque<stream> streams_{};
+  std::vector<std::byte> buffers_;
+  std::deque<std::uint32_t> free_buffers_{};
+  std::array<int, 8> files_{-1, -1, -1, -1, -1, -1, -1, -1};
+  std::vector<std::span<std::byte>> registered_buffers_{};
+  std::uint64_t next_id_ = 1;
+};
+
+auto opcode_count(emulated_completion_backend::counters const& c, io_request::opcode op) -> int {
+  return c.by_opcode[static_cast<std::size_t>(op)].load(std::memory_order_relaxed);
+}
+
+struct completion_context {
+  emulated_completion_backend::counters counters{};
+  std::shared_ptr<iocoro::detail::io_context_impl> impl =
+    std::make_shared<iocoro::detail::io_context_impl>(
+      std::make_unique<emulated_completion_backend>(&counters));
+  iocoro::io_context::executor_type ex{impl};
+};
+
+auto loopback_v4(std::uint16_t port) -> sockaddr_in {
+  sockaddr_in addr{};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  addr.sin_port = htons(port);
+  return addr;
+}
+
+auto local_port(int fd) -> std::uint16_t {
+  sockaddr_in addr{};
+  socklen_t len = sizeof(addr);
+  if (::getsockname(fd, reinterpret_cast<sockaddr*>(&addr), &len) != 0) {
+    return 0;
+  }
+  return ntohs(addr.sin_port);
+}
+
+}  // namespace
+
+TEST(completion_io_test, stream_read_and_write_complete_through_the_backend) {
+  completion_context c;
+  ASSERT_TRUE(c.impl->supports_completion_io());
+
+  int fds[2]{-1, -1};
+  ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+  iocoro::detail::socket::stream_socket_impl sock{c.ex};
+  ASSERT_TRUE(sock.assign(fds[0]));
+
+  std::optional<iocoro::result<std::size_t>> wrote;
+  std::optional<iocoro::result<std::size_t>> read;
+  std::array<std::byte, 8> rbuf{};
+
+  iocoro::co_spawn(
+    c.ex,
+    [&]() -> iocoro::awaitable<void> {
+      auto const msg = std::as_bytes(std::span{"ping", 4});
+      wrote = co_await sock.async_write_some(msg);
+      // Nothing to read yet: the receive stays in flight until the peer answers.
+      c.ex.post([&] {
+        char tmp[4]{};
+        EXPECT_EQ(::read(fds[1], tmp, sizeof(tmp)), 4);
+        EXPECT_EQ(std::memcmp(tmp, "ping", 4), 0);
+        EXPECT_EQ(::write(fds[1], "pong", 4), 4);
+      });
+      read = co_await sock.async_read_some(std::span{rbuf});
+    },
+    iocoro::detached);
+  c.impl->run();
+
+  ASSERT_TRUE(wrote && *wrote);
+  EXPECT_EQ(**wrote, 4U);
+  ASSERT_TRUE(read && *read);
+  ASSERT_EQ(**read, 4U);
+  EXPECT_EQ(std::memcmp(rbuf.data(), "pong", 4), 0);
+  EXPECT_GE(opcode_count(c.counters, io_request::opcode::send), 1);
+  EXPECT_GE(opcode_count(c.counters, io_request::opcode::recv), 1);
+
+  ::close(fds[1]);
+}
+
+TEST(completion_io_test, accept_and_connect_complete_through_the_backend) {
+  completion_context c;
+
+  iocoro::detail::socket::acceptor_impl acceptor{c.ex};
+  ASSERT_TRUE(acceptor.open(AF_INET, SOCK_STREAM, 0));
+  auto bind_addr = loopback_v4(0);
+  ASSERT_TRUE(acceptor.bind(reinterpret_cast<sockaddr const*>(&bind_addr), sizeof(bind_addr)));
+  ASSERT_TRUE(acceptor.listen(16));
+  auto const port = local_port(acceptor.native_handle());
+  ASSERT_NE(port, 0);
+
+  iocoro::detail::socket::stream_socket_impl client{c.ex};
+  ASSERT_TRUE(client.open(AF_INET, SOCK_STREAM, 0));
+
+  std::optional<iocoro::result<int>> accepted;
+  std::optional<iocoro::result<void>> connected;
+
+  iocoro::co_spawn(
+    c.ex, [&]() -> iocoro::awaitable<void> { accepted = co_await acceptor.async_accept(); },
+    iocoro::detached);
+  iocoro::co_spawn(
+    c.ex,
+    [&]() -> iocoro::awaitable<void> {
+      auto const addr = loopback_v4(port);
+      connected =
+        co_await client.async_connect(reinterpret_cast<sockaddr const*>(&addr), sizeof(addr));
+    },
+    iocoro::detached);
+  c.impl->run();
+
+  ASSERT_TRUE(accepted && *accepted) << (accepted && !*accepted ? accepted->error().message()
+                                                                : "no result");
+  EXPECT_GE(**accepted, 0);
+  ASSERT_TRUE(connected && *connected)
+    << (connected && !*connected ? connected->error().message() : "no result");
+  EXPECT_TRUE(client.is_connected());
+  EXPECT_GE(opcode_count(c.counters, io_request::opcode::accept), 1);
+  EXPECT_GE(opcode_count(c.counters, io_request::opcode::connect), 1);
+
+  ::close(**accepted);
+}
+
+TEST(completion_io_test, datagram_send_to_and_receive_from_use_message_ops) {
+  completion_context c;
+
+  iocoro::detail::socket::datagram_socket_impl rx{c.ex};
+  iocoro::detail::socket::datagram_socket_impl tx{c.ex};
+  ASSERT_TRUE(rx.open(AF_INET, SOCK_DGRAM, 0));
+  ASSERT_TRUE(tx.open(AF_INET, SOCK_DGRAM, 0));
+  auto any = loopback_v4(0);
+  ASSERT_TRUE(rx.bind(reinterpret_cast<sockaddr const*>(&any), sizeof(any)));
+  ASSERT_TRUE(tx.bind(reinterpret_cast<sockaddr const*>(&any), sizeof(any)));
+  auto const rx_port = local_port(rx.native_handle());
+  auto const tx_port = local_port(tx.native_handle());
+
+  std::optional<iocoro::result<std::size_t>> sent;
+  std::optional<iocoro::result<std::size_t>> received;
+  std::array<std::byte, 16> rbuf{};
+  sockaddr_in from{};
+  socklen_t from_len = sizeof(from);
+
+  iocoro::co_spawn(
+    c.ex,
+    [&]() -> iocoro::awaitable<void> {
+      received =
+        co_await rx.async_receive_from(std::span{rbuf}, reinterpret_cast<sockaddr*>(&from),
+                                       &from_len);
+    },
+    iocoro::detached);
+  iocoro::co_spawn(
+    c.ex,
+    [&]() -> iocoro::awaitable<void> {
+      auto const dest = loopback_v4(rx_port);
+      sent = co_await tx.async_send_to(std::as_bytes(std::span{"hello", 5}),
+                                       reinterpret_cast<sockaddr const*>(&dest), sizeof(dest));
+    },
+    iocoro::detached);
+  c.impl->run();
+
+  ASSERT_TRUE(sent && *sent);
+  EXPECT_EQ(**sent, 5U);
+  ASSERT_TRUE(received && *received);
+  ASSERT_EQ(**received, 5U);
+  EXPECT_EQ(std::memcmp(rbuf.data(), "hello", 5), 0);
+  EXPECT_EQ(from_len, static_cast<socklen_t>(sizeof(sockaddr_in)));
+  EXPECT_EQ(ntohs(from.sin_port), tx_port);
+  EXPECT_GE(opcode_count(c.counters, io_request::opcode::sendmsg), 1);
+  EXPECT_GE(opcode_count(c.counters, io_request::opcode::recvmsg), 1);
+}
+
+TEST(completion_io_test, opcodes_the_backend_refuses_take_the_readiness_path) {
+  emulated_completion_backend::counters counters{};
+  auto backend = std::make_unique<emulated_completion_backend>(&counters);
+  backend->refuse(io_request::opcode::send_zc);
+  auto impl = std::make_shared<iocoro::detail::io_context_impl>(std::move(backend));
+  iocoro::io_context::executor_type ex{impl};
+  ASSERT_TRUE(impl->supports_completion_io());
+  EXPECT_TRUE(impl->supports_completion_io(io_request::opcode::send));
+  EXPECT_FALSE(impl->supports_completion_io(io_request::opcode::send_zc));
+
+  int fds[2]{-1, -1};
+  ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+  iocoro::detail::socket::stream_socket_impl sock{ex};
+  ASSERT_TRUE(sock.assign(fds[0]));
+
+  std::optional<iocoro::result<std::size_t>> wrote;
+  iocoro::co_spawn(
+    ex,
+    [&]() -> iocoro::awaitable<void> {
+      wrote = co_await sock.async_write_some_zerocopy(std::as_bytes(std::span{"ping", 4}));
+    },
+    iocoro::detached);
+  impl->run();
+
+  ASSERT_TRUE(wrote && *wrote);
+  EXPECT_EQ(**wrote, 4U);
+  char tmp[4]{};
+  EXPECT_EQ(::read(fds[1], tmp, sizeof(tmp)), 4);
+  EXPECT_EQ(std::memcmp(tmp, "ping", 4), 0);
+  // Neither SEND_ZC nor its copying fallback went through the backend.
+  EXPECT_EQ(counters.submitted.load(), 0);
+
+  ::close(fds[1]);
+}
+
+TEST(completion_io_test, refused_splice_and_message_ops_take_the_readiness_path) {
+  emulated_completion_backend::counters counters{};
+  auto backend = std::make_unique<emulated_completion_backend>(&counters);
+  backend->refuse(io_request::opcode::splice);
+  backend->refuse(io_request::opcode::sendmsg);
+  backend->refuse(io_request::opcode::recvmsg);
+  auto impl = std::make_shared<iocoro::detail::io_context_impl>(std::move(backend));
+  iocoro::io_context::executor_type ex{impl};
+
+  char file_path[] = "/tmp/iocoro_completion_refused_XXXXXX";
+  int const file = ::mkstemp(file_path);
+  ASSERT_GE(file, 0);
+  ::unlink(file_path);
+  ASSERT_EQ(::write(file, "0123456789", 10), 10);
+
+  int fds[2]{-1, -1};
+  ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+  iocoro::detail::socket::stream_socket_impl sock{ex};
+  ASSERT_TRUE(sock.assign(fds[0]));
+
+  iocoro::detail::socket::datagram_socket_impl rx{ex};
+  iocoro::detail::socket::datagram_socket_impl tx{ex};
+  ASSERT_TRUE(rx.open(AF_INET, SOCK_DGRAM, 0));
+  ASSERT_TRUE(tx.open(AF_INET, SOCK_DGRAM, 0));
+  auto any = loopback_v4(0);
+  ASSERT_TRUE(rx.bind(reinterpret_cast<sockaddr const*>(&any), sizeof(any)));
+  auto const rx_port = local_port(rx.native_handle());
+
+  std::optional<iocoro::result<std::size_t>> sent_file;
+  std::optional<iocoro::result<std::size_t>> sent;
+  std::optional<iocoro::result<std::size_t>> received;
+  std::array<std::byte, 16> rbuf{};
+  sockaddr_in from{};
+  socklen_t from_len = sizeof(from);
+
+  iocoro::co_spawn(
+    ex,
+    [&]() -> iocoro::awaitable<void> { sent_file = co_await sock.async_sendfile_some(file, 2, 5); },
+    iocoro::detached);
+  iocoro::co_spawn(
+    ex,
+    [&]() -> iocoro::awaitable<void> {
+      received =
+        co_await rx.async_receive_from(std::span{rbuf}, reinterpret_cast<sockaddr*>(&from),
+                                       &from_len);
+    },
+    iocoro::detached);
+  iocoro::co_spawn(
+    ex,
+    [&]() -> iocoro::awaitable<void> {
+      auto const dest = loopback_v4(rx_port);
+      sent = co_await tx.async_send_to(std::as_bytes(std::span{"hello", 5}),
+                                       reinterpret_cast<sockaddr const*>(&dest), sizeof(dest));
+    },
+    iocoro::detached);
+  impl->run();
+
+  ASSERT_TRUE(sent_file && *sent_file);
+  EXPECT_EQ(**sent_file, 5U);
+  char peer[5]{};
+  EXPECT_EQ(::read(fds[1], peer, sizeof(peer)), 5);
+  EXPECT_EQ(std::memcmp(peer, "23456", 5), 0);
+  ASSERT_TRUE(sent && *sent);
+  EXPECT_EQ(**sent, 5U);
+  ASSERT_TRUE(received && *received);
+  ASSERT_EQ(**received, 5U);
+  EXPECT_EQ(std::memcmp(rbuf.data(), "hello", 5), 0);
+  EXPECT_EQ(from_len, static_cast<socklen_t>(sizeof(sockaddr_in)));
+  EXPECT_EQ(counters.submitted.load(), 0);
+
+  ::close(fds[1]);
+  ::close(file);
+}
+
+TEST(completion_io_test, cancel_read_aborts_in_flight_receive) {
+  completion_context c;
+
+  int fds[2]{-1, -1};
+  ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+  iocoro::detail::socket::stream_socket_impl sock{c.ex};
+  ASSERT_TRUE(sock.assign(fds[0]));
+
+  std::optional<iocoro::result<std::size_t>> read;
+  std::array<std::byte, 8> rbuf{};
+
+  iocoro::co_spawn(
+    c.ex,
+    [&]() -> iocoro::awaitable<void> { read = co_await sock.async_read_some(std::span{rbuf}); },
+    iocoro::detached);
+  // Cancel once the receive has been submitted.
+  std::function<void()> cancel_when_submitted = [&] {
+    if (c.counters.submitted.load(std::memory_order_relaxed) == 0) {
+      c.ex.post(cancel_when_submitted);
+      return;
+    }
+    sock.cancel_read();
+  };
+  c.ex.post(cancel_when_submitted);
+  c.impl->run();
+
+  ASSERT_TRUE(read);
+  ASSERT_FALSE(*read);
+  EXPECT_EQ(read->error(), iocoro::error::operation_aborted);
+  EXPECT_EQ(c.counters.cancelled.load(), 1);
+
+  ::close(fds[1]);
+}
+
+TEST(completion_io_test, multishot_accept_queues_connections_and_rearms_after_backpressure) {
+  completion_context c;
+  ASSERT_TRUE(c.impl->supports_multishot());
+
+  iocoro::detail::socket::acceptor_impl acceptor{c.ex};
+  ASSERT_TRUE(acceptor.open(AF_INET, SOCK_STREAM, 0));
+  auto bind_addr = loopback_v4(0);
+  ASSERT_TRUE(acceptor.bind(reinterpret_cast<sockaddr const*>(&bind_addr), sizeof(bind_addr)));
+  ASSERT_TRUE(acceptor.listen(16));
+  acceptor.set_multishot_accept(2);
+  auto const port = local_port(acceptor.native_handle());
+  ASSERT_NE(port, 0);
+
+  // Three connections wait in the backlog; the queue holds two, so the stream disarms once and
+  // is re-armed for the third.
+  std::array<int, 3> clients{-1, -1, -1};
+  for (auto& fd : clients) {
+    fd = ::socket(AF_INET, SOCK_STREAM, 0);
+    ASSERT_GE(fd, 0);
+    auto const addr = loopback_v4(port);
+    ASSERT_EQ(::connect(fd, reinterpret_cast<sockaddr const*>(&addr), sizeof(addr)), 0);
+  }
+
+  std::vector<iocoro::result<int>> accepted;
+  iocoro::co_spawn(
+    c.ex,
+    [&]() -> iocoro::awaitable<void> {
+      for (std::size_t i = 0; i < clients.size(); ++i) {
+        accepted.push_back(co_await acceptor.async_accept());
+      }
+    },
+    iocoro::detached);
+  c.impl->run();
+
+  ASSERT_EQ(accepted.size(), clients.size());
+  for (auto const& r : accepted) {
+    ASSERT_TRUE(r) << r.error().message();
+    EXPECT_GE(*r, 0);
+    ::close(*r);
+  }
+  EXPECT_EQ(opcode_count(c.counters, io_request::opcode::accept_multishot), 2);
+  EXPECT_EQ(opcode_count(c.counters, io_request::opcode::accept), 0);
+
+  for (auto const fd : clients) {
+    ::close(fd);
+  }
+}
+
+TEST(completion_io_test, multishot_receive_delivers_provided_buffers_until_eof) {
+  completion_context c;
+
+  int fds[2]{-1, -1};
+  ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+  iocoro::detail::socket::stream_socket_impl sock{c.ex};
+  ASSERT_TRUE(sock.assign(fds[0]));
+  ASSERT_EQ(::write(fds[1], "abc", 3), 3);
+
+  std::vector<std::string> chunks;
+  std::optional<std::error_code> failure;
+  iocoro::co_spawn(
+    c.ex,
+    [&]() -> iocoro::awaitable<void> {
+      for (int i = 0;; ++i) {
+        auto b = co_await sock.async_receive_buffer();
+        if (!b) {
+          failure = b.error();
+          co_return;
+        }
+        if (b->empty()) {
+          co_return;
+        }
+        auto const bytes = b->data();
+        chunks.emplace_back(reinterpret_cast<char const*>(bytes.data()), bytes.size());
+        // Feed the next chunk while the receive stays armed; then hang up.
+        if (i == 0) {
+          EXPECT_EQ(::write(fds[1], "defg", 4), 4);
+        } else {
+          ::close(fds[1]);
+        }
+      }
+    },
+    iocoro::detached);
+  c.impl->run();
+
+  EXPECT_FALSE(failure) << failure->message();
+  ASSERT_EQ(chunks.size(), 2U);
+  EXPECT_EQ(chunks[0], "abc");
+  EXPECT_EQ(chunks[1], "defg");
+  EXPECT_EQ(opcode_count(c.counters, io_request::opcode::recv_multishot), 1);
+  EXPECT_EQ(opcode_count(c.counters, io_request::opcode::recv), 0);
+  EXPECT_EQ(c.counters.recycled.load(), 2);
+}
+
+TEST(completion_io_test, cancel_read_aborts_parked_multishot_receive) {
+  completion_context c;
+
+  int fds[2]{-1, -1};
+  ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+  iocoro::detail::socket::stream_socket_impl sock{c.ex};
+  ASSERT_TRUE(sock.assign(fds[0]));
+
+  std::optional<iocoro::result<iocoro::received_buffer>> got;
+  iocoro::co_spawn(
+    c.ex, [&]() -> iocoro::awaitable<void> { got = co_await sock.async_receive_buffer(); },
+    iocoro::detached);
+  std::function<void()> cancel_when_submitted = [&] {
+    if (c.counters.submitted.load(std::memory_order_relaxed) == 0) {
+      c.ex.post(cancel_when_submitted);
+      return;
+    }
+    sock.cancel_read();
+  };
+  c.ex.post(cancel_when_submitted);
+  c.impl->run();
+
+  ASSERT_TRUE(got);
+  ASSERT_FALSE(*got);
+  EXPECT_EQ(got->error(), iocoro::error::operation_aborted);
+  EXPECT_EQ(c.counters.cancelled.load(), 1);
+
+  ::close(fds[1]);
+}
+
+TEST(completion_io_test, sockets_use_registered_file_slots_until_closed) {
+  completion_context c;
+
+  int fds[2]{-1, -1};
+  ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+  auto sock = std::make_unique<iocoro::detail::socket::stream_socket_impl>(c.ex);
+  ASSERT_TRUE(sock->assign(fds[0]));
+  EXPECT_EQ(c.counters.registered_files.load(), 1);
+
+  std::optional<iocoro::result<std::size_t>> wrote;
+  iocoro::co_spawn(
+    c.ex,
+    [&]() -> iocoro::awaitable<void> {
+      wrote = co_await sock->async_write_some(std::as_bytes(std::span{"ping", 4}));
+    },
+    iocoro::detached);
+  c.impl->run();
+
+  ASSERT_TRUE(wrote && *wrote);
+  EXPECT_EQ(c.counters.fixed_file_ops.load(), 1);
+
+  ASSERT_TRUE(sock->close());
+  sock.reset();
+  EXPECT_EQ(c.counters.registered_files.load(), 0);
+
+  ::close(fds[1]);
+}
+
+TEST(completion_io_test, transfers_inside_registered_buffers_use_fixed_opcodes) {
+  completion_context c;
+
+  // write_fixed is only used while SIGPIPE is ignored.
+  auto const old_sigpipe = std::signal(SIGPIPE, SIG_IGN);
+  alignas(64) std::array<std::byte, 64> pool{};
+  std::array<std::span<std::byte>, 1> const table{std::span{pool}};
+  ASSERT_FALSE(c.impl->register_buffers(table));
+
+  int fds[2]{-1, -1};
+  ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+  iocoro::detail::socket::stream_socket_impl sock{c.ex};
+  ASSERT_TRUE(sock.assign(fds[0]));
+
+  std::optional<iocoro::result<std::size_t>> wrote;
+  std::optional<iocoro::result<std::size_t>> read_fixed;
+  std::optional<iocoro::result<std::size_t>> read_plain;
+  std::array<std::byte, 4> outside{};
+
+  iocoro::co_spawn(
+    c.ex,
+    [&]() -> iocoro::awaitable<void> {
+      std::memcpy(pool.data(), "abcd", 4);
+      wrote = co_await sock.async_write_some(std::span{pool}.first(4));
+      EXPECT_EQ(::write(fds[1], "efghijkl", 8), 8);
+      read_fixed = co_await sock.async_read_some(std::span{pool}.subspan(8, 4));
+      read_plain = co_await sock.async_read_some(std::span{outside});
+    },
+    iocoro::detached);
+  c.impl->run();
+  std::signal(SIGPIPE, old_sigpipe);
+
+  ASSERT_TRUE(wrote && *wrote);
+  EXPECT_EQ(**wrote, 4U);
+  char peer[4]{};
+  EXPECT_EQ(::read(fds[1], peer, sizeof(peer)), 4);
+  EXPECT_EQ(std::memcmp(peer, "abcd", 4), 0);
+
+  ASSERT_TRUE(read_fixed && *read_fixed);
+  ASSERT_EQ(**read_fixed, 4U);
+  EXPECT_EQ(std::memcmp(pool.data() + 8, "efgh", 4), 0);
+  ASSERT_TRUE(read_plain && *read_plain);
+  ASSERT_EQ(**read_plain, 4U);
+  EXPECT_EQ(std::memcmp(outside.data(), "ijkl", 4), 0);
+
+  EXPECT_EQ(opcode_count(c.counters, io_request::opcode::write_fixed), 1);
+  EXPECT_EQ(opcode_count(c.counters, io_request::opcode::read_fixed), 1);
+  EXPECT_EQ(opcode_count(c.counters, io_request::opcode::recv), 1);
+  EXPECT_EQ(opcode_count(c.counters, io_request::opcode::send), 0);
+
+  ::close(fds[1]);
+}
+
+TEST(completion_io_test, sendfile_and_splice_go_through_splice_requests) {
+  completion_context c;
+
+  char file_path[] = "/tmp/iocoro_completion_sendfile_XXXXXX";
+  int const file = ::mkstemp(file_path);
+  ASSERT_GE(file, 0);
+  ::unlink(file_path);
+  ASSERT_EQ(::write(file, "0123456789", 10), 10);
+
+  int fds[2]{-1, -1};
+  ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+  iocoro::detail::socket::stream_socket_impl sock{c.ex};
+  ASSERT_TRUE(sock.assign(fds[0]));
+
+  int pipe_fds[2]{-1, -1};
+  ASSERT_EQ(::pipe2(pipe_fds, O_NONBLOCK | O_CLOEXEC), 0);
+
+  std::optional<iocoro::result<std::size_t>> sent;
+  std::optional<iocoro::result<std::size_t>> spliced_in;
+  std::optional<iocoro::result<std::size_t>> spliced_out;
+
+  iocoro::co_spawn(
+    c.ex,
+    [&]() -> iocoro::awaitable<void> {
+      sent = co_await sock.async_sendfile_some(file, 2, 5);
+      EXPECT_EQ(::write(fds[1], "xyz", 3), 3);
+      spliced_in = co_await sock.async_splice_read_some(pipe_fds[1], 16);
+      spliced_out = co_await sock.async_splice_write_some(pipe_fds[0], 16);
+    },
+    iocoro::detached);
+  c.impl->run();
+
+  ASSERT_TRUE(sent && *sent);
+  EXPECT_EQ(**sent, 5U);
+  ASSERT_TRUE(spliced_in && *spliced_in);
+  EXPECT_EQ(**spliced_in, 3U);
+  ASSERT_TRUE(spliced_out && *spliced_out);
+  EXPECT_EQ(**spliced_out, 3U);
+
+  char peer[8]{};
+  EXPECT_EQ(::read(fds[1], peer, sizeof(peer)), 8);
+  EXPECT_EQ(std::memcmp(peer, "23456xyz", 8), 0);
+  // File -> pipe -> socket for the sendfile, then one splice per direction.
+  EXPECT_EQ(opcode_count(c.counters, io_request::opcode::splice), 4);
+  EXPECT_EQ(opcode_count(c.counters, io_request::opcode::send), 0);
+
+  ::close(pipe_fds[0]);
+  ::close(pipe_fds[1]);
+  ::close(fds[1]);
+  ::close(file);
+}
+
+TEST(completion_io_test, sendfile_larger_than_a_pipe_reuses_one_pipe_across_chunks) {
+  completion_context c;
+
+  // Several times the largest pipe `async_sendfile_some()` asks for: one call per chunk.
+  std::string content(std::size_t{3} * 1024 * 1024 + 4097, '\0');
+  for (std::size_t i = 0; i < content.size(); ++i) {
+    content[i] = static_cast<char>('a' + (i * 7) % 26);
+  }
+  char file_path[] = "/tmp/iocoro_completion_sendfile_XXXXXX";
+  int const file = ::mkstemp(file_path);
+  ASSERT_GE(file, 0);
+  ::unlink(file_path);
+  ASSERT_EQ(::write(file, content.data(), content.size()),
+            static_cast<ssize_t>(content.size()));
+
+  int fds[2]{-1, -1};
+  ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM, 0, fds), 0);
+  iocoro::detail::socket::stream_socket_impl sock{c.ex};
+  ASSERT_TRUE(sock.assign(fds[0]));
+
+  std::string received;
+  std::thread reader{[&] {
+    std::array<char, 64 * 1024> buf{};
+    for (;;) {
+      auto const n = ::read(fds[1], buf.data(), buf.size());
+      if (n <= 0) {
+        break;
+      }
+      received.append(buf.data(), static_cast<std::size_t>(n));
+    }
+  }};
+
+  std::optional<iocoro::result<std::size_t>> sent;
+  iocoro::co_spawn(
+    c.ex,
+    [&]() -> iocoro::awaitable<void> {
+      sent = co_await iocoro::io::async_sendfile(sock, file, 0, content.size());
+      (void)sock.shutdown(iocoro::shutdown_type::send);
+    },
+    iocoro::detached);
+  c.impl->run();
+  reader.join();
+
+  ASSERT_TRUE(sent && *sent) << (sent && !*sent ? sent->error().message() : "no result");
+  EXPECT_EQ(**sent, content.size());
+  EXPECT_TRUE(received == content);
+  // At least one file -> pipe splice per chunk, all into the same pipe.
+  EXPECT_GE(opcode_count(c.counters, io_request::opcode::splice), 6);
+  EXPECT_EQ(c.counters.file_to_pipe.size(), 1U);
+
+  ::close(fds[1]);
+  ::close(file);
+}
+
+TEST(completion_io_test, single_issuer_context_refuses_a_runner_on_another_thread) {
+  ::testing::GTEST_FLAG(death_test_style) = "threadsafe";
+  emulated_completion_backend::counters counters{};
+  auto impl = std::make_shared<iocoro::detail::io_context_impl>(
+    std::make_unique<emulated_completion_backend>(&counters, true));
+  iocoro::io_context::executor_type ex{impl};
+
+  int runs = 0;
+  ex.post([&runs] { ++runs; });
+  EXPECT_EQ(impl->run_for(10ms), 1U);
+
+  // The issuer may run it again, also after a restart.
+  impl->stop();
+  impl->restart();
+  ex.post([&runs] { ++runs; });
+  EXPECT_EQ(impl->run_for(10ms), 1U);
+  EXPECT_EQ(runs, 2);
+
+  // Another thread must be refused before it can reach the backend's wait (which would fail
+  // and abort every operation of the context), whether or not the issuer is running.
+  EXPECT_DEATH(
+    {
+      std::thread other{[&] { (void)impl->run_for(10ms); }};
+      other.join();
+    },
+    "same thread");
+}
+
+TEST(completion_io_test, register_buffers_is_unsupported_on_readiness_backends) {
+  if (iocoro::detail::make_backend()->supports_io()) {
+    GTEST_SKIP() << "the default backend runs completion I/O";
+  }
+  iocoro::io_context ctx;
+  std::array<std::byte, 16> pool{};
+  std::array<std::span<std::byte>, 1> const table{std::span{pool}};
+
+  auto r = ctx.register_buffers(table);
+  ASSERT_FALSE(r);
+  EXPECT_EQ(r.error(), std::errc::operation_not_supported);
+}
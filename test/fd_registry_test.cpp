@@ -126,3 +126,43 @@ TEST(fd_registry_test, stale_readiness_is_ignored_for_untracked_fd_after_deregis
   ASSERT_NE(r.token, iocoro::detail::invalid_token);
   EXPECT_FALSE(static_cast<bool>(r.ready_now));
 }
+
+TEST(fd_registry_test, error_events_complete_error_waiters_and_flag_error_queue_fds) {
+  iocoro::detail::fd_registry reg;
+  constexpr int fd = 9;
+  std::atomic<int> complete{0};
+  std::atomic<int> abort{0};
+
+  // Without an error-queue user, an error event carries no flag (waiters get aborted).
+  reg.track(fd);
+  EXPECT_FALSE(reg.take_ready(fd, /*can_read=*/true, /*can_write=*/true, /*has_error=*/true)
+                 .error_queue);
+
+  // The error latched above completes the next error waiter right away.
+  auto latched = reg.register_error(
+    fd, iocoro::detail::make_reactor_op<count_state>(count_state{&complete, &abort}));
+  ASSERT_TRUE(static_cast<bool>(latched.ready_now));
+  complete_and_destroy(std::move(latched.ready_now));
+
+  auto r = reg.register_error(
+    fd, iocoro::detail::make_reactor_op<count_state>(count_state{&complete, &abort}));
+  ASSERT_NE(r.token, iocoro::detail::invalid_token);
+  EXPECT_FALSE(reg.empty());
+
+  auto plain = reg.take_ready(fd, /*can_read=*/true, /*can_write=*/false);
+  EXPECT_FALSE(static_cast<bool>(plain.error));
+
+  auto ready = reg.take_ready(fd, /*can_read=*/false, /*can_write=*/false, /*has_error=*/true);
+  ASSERT_TRUE(static_cast<bool>(ready.error));
+  EXPECT_TRUE(ready.error_queue);
+  complete_and_destroy(std::move(ready.error));
+  EXPECT_EQ(complete.load(std::memory_order_relaxed), 2);
+  EXPECT_TRUE(reg.empty());
+
+  // Deregistration forgets the flag; watch_error_queue() sets it up front.
+  (void)reg.deregister(fd);
+  reg.track(fd);
+  EXPECT_FALSE(reg.take_ready(fd, false, false, true).error_queue);
+  reg.watch_error_queue(fd);
+  EXPECT_TRUE(reg.take_ready(fd, false, false, true).error_queue);
+}
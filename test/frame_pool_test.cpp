@@ -0,0 +1,61 @@
+// Exercises the opt-in coroutine frame pool; the switch must be visible before any iocoro header.
+#ifndef IOCORO_RECYCLE_FRAMES
+#define IOCORO_RECYCLE_FRAMES
+#endif
+
+#include <gtest/gtest.h>
+
+#include <iocoro/awaitable.hpp>
+#include <iocoro/io_context.hpp>
+
+#include "test_util.hpp"
+
+namespace {
+
+auto leaf(int v) -> iocoro::awaitable<int> {
+  co_return v + 1;
+}
+
+auto chain(int n) -> iocoro::awaitable<int> {
+  int sum = 0;
+  for (int i = 0; i < n; ++i) {
+    sum += co_await leaf(i);
+  }
+  co_return sum;
+}
+
+}  // namespace
+
+TEST(frame_pool_test, nested_awaitables_reuse_pooled_frames) {
+  if (!iocoro::detail::frame_cache::caching_enabled) {
+    GTEST_SKIP() << "frame pooling is disabled under AddressSanitizer";
+  }
+  iocoro::io_context ctx;
+  iocoro::reset_this_thread_frame_pool_stats();
+
+  constexpr int n = 1000;
+  auto r = iocoro::test::sync_wait(ctx, chain(n));
+  ASSERT_TRUE(r);
+  EXPECT_EQ(*r, n * (n + 1) / 2);
+
+  auto const st = iocoro::this_thread_frame_pool_stats();
+  // One frame per `leaf()` call plus the outer chain (and co_spawn's wrapper).
+  EXPECT_GE(st.allocations, static_cast<std::uint64_t>(n));
+  EXPECT_EQ(st.oversized, 0U);
+  // After the first `leaf()` frame is returned, every later one is a cache hit.
+  EXPECT_GE(st.hits, static_cast<std::uint64_t>(n - 1));
+  EXPECT_GT(st.hit_rate(), 0.9);
+}
+
+TEST(frame_pool_test, reset_clears_counters) {
+  iocoro::io_context ctx;
+  auto r = iocoro::test::sync_wait(ctx, chain(4));
+  ASSERT_TRUE(r);
+  EXPECT_GT(iocoro::this_thread_frame_pool_stats().allocations, 0U);
+
+  iocoro::reset_this_thread_frame_pool_stats();
+  auto const st = iocoro::this_thread_frame_pool_stats();
+  EXPECT_EQ(st.allocations, 0U);
+  EXPECT_EQ(st.hits, 0U);
+  EXPECT_EQ(st.hit_rate(), 0.0);
+}
@@ -136,7 +136,7 @@ class backend_throw final : public iocoro::detail::backend_interface {
     }
   }
 
-  auto wait(std::optional<std::chrono::milliseconds> /*timeout*/,
+  auto wait(std::optional<std::chrono::steady_clock::duration> /*timeout*/,
             std::vector<iocoro::detail::backend_event>& /*out*/) -> void override {
     throw std::runtime_error{"backend failure"};
   }
@@ -156,7 +156,7 @@ class backend_scripted final : public iocoro::detail::backend_interface {
   void add_fd(int /*fd*/) override {}
   void remove_fd(int /*fd*/) noexcept override {}
 
-  auto wait(std::optional<std::chrono::milliseconds> /*timeout*/,
+  auto wait(std::optional<std::chrono::steady_clock::duration> /*timeout*/,
             std::vector<iocoro::detail::backend_event>& out) -> void override {
     out = events_;
     events_.clear();
@@ -168,6 +168,25 @@ class backend_scripted final : public iocoro::detail::backend_interface {
   std::vector<iocoro::detail::backend_event> events_{};
 };
 
+class backend_counting_waits final : public iocoro::detail::backend_interface {
+ public:
+  explicit backend_counting_waits(std::atomic<int>* waits_) noexcept : waits(waits_) {}
+
+  void add_fd(int /*fd*/) override {}
+  void remove_fd(int /*fd*/) noexcept override {}
+
+  auto wait(std::optional<std::chrono::steady_clock::duration> /*timeout*/,
+            std::vector<iocoro::detail::backend_event>& out) -> void override {
+    out.clear();
+    waits->fetch_add(1, std::memory_order_relaxed);
+  }
+
+  void wakeup() noexcept override {}
+
+ private:
+  std::atomic<int>* waits;
+};
+
 class backend_blocking_remove final : public iocoro::detail::backend_interface {
  public:
   std::atomic<int>* remove_calls{};
@@ -198,7 +217,7 @@ class backend_blocking_remove final : public iocoro::detail::backend_interface {
     cv_.wait(lk, [this] { return allow_remove_.load(std::memory_order_acquire); });
   }
 
-  auto wait(std::optional<std::chrono::milliseconds> /*timeout*/,
+  auto wait(std::optional<std::chrono::steady_clock::duration> /*timeout*/,
             std::vector<iocoro::detail::backend_event>& out) -> void override {
     out.clear();
     std::unique_lock lk{mtx_};
@@ -283,6 +302,60 @@ TEST(io_context_impl_test, schedule_timer_executes_callback) {
   EXPECT_FALSE(aborted.load());
 }
 
+TEST(io_context_impl_test, timer_rearmed_as_due_by_its_callback_does_not_poll_the_backend) {
+  std::atomic<int> waits{0};
+  auto ctx = std::make_shared<iocoro::detail::io_context_impl>(
+    std::make_unique<backend_counting_waits>(&waits));
+
+  struct rearm_state {
+    iocoro::detail::io_context_impl* ctx;
+    int* remaining;
+
+    void on_complete() noexcept {
+      if (--*remaining > 0) {
+        (void)ctx->add_timer(std::chrono::steady_clock::now(),
+                             iocoro::detail::make_reactor_op<rearm_state>(ctx, remaining));
+      }
+    }
+    void on_abort(std::error_code) noexcept {}
+  };
+
+  int remaining = 100;
+  (void)ctx->add_timer(std::chrono::steady_clock::now(),
+                       iocoro::detail::make_reactor_op<rearm_state>(ctx.get(), &remaining));
+  ctx->run();
+
+  EXPECT_EQ(remaining, 0);
+  // Like a posted resumption, an already expired timer ends the turn before the backend wait.
+  EXPECT_EQ(waits.load(), 0);
+}
+
+TEST(io_context_impl_test, wheel_timer_queue_fires_and_cancels_timers) {
+  auto ctx =
+    std::make_shared<iocoro::detail::io_context_impl>(iocoro::detail::timer_queue_kind::wheel);
+
+  struct timer_state {
+    std::atomic<int>* fired;
+    std::atomic<int>* aborted;
+
+    void on_complete() noexcept { fired->fetch_add(1); }
+    void on_abort(std::error_code) noexcept { aborted->fetch_add(1); }
+  };
+
+  std::atomic<int> fired{0};
+  std::atomic<int> aborted{0};
+  (void)ctx->add_timer(5ms, iocoro::detail::make_reactor_op<timer_state>(&fired, &aborted));
+  auto h = ctx->add_timer(1h, iocoro::detail::make_reactor_op<timer_state>(&fired, &aborted));
+  h.cancel();
+
+  auto const start = std::chrono::steady_clock::now();
+  // The cancelled timer is unlinked right away, so run() returns once the 5ms timer fired.
+  ctx->run();
+  EXPECT_EQ(fired.load(), 1);
+  EXPECT_EQ(aborted.load(), 1);
+  EXPECT_GE(std::chrono::steady_clock::now() - start, 5ms);
+}
+
 TEST(io_context_impl_test, dispatch_runs_inline_on_context_thread) {
   auto ctx = std::make_shared<iocoro::detail::io_context_impl>();
 
@@ -412,7 +485,7 @@ TEST(io_context_impl_test, backend_error_event_is_routed_to_matching_fd_ops) {
   ev.can_read = true;
   ev.can_write = false;
   ev.is_error = true;
-  ev.ec = injected_ec;
+  ev.error = EIO;
   evs.push_back(ev);
 
   auto backend = std::make_unique<backend_scripted>(std::move(evs));
@@ -659,3 +732,39 @@ TEST(io_context_impl_test, backend_fatal_cleanup_swallows_throwing_posted_callba
   (void)::close(fds[0]);
   (void)::close(fds[1]);
 }
+
+TEST(io_context_impl_test, multiple_runners_share_timer_registrations_and_exit_when_out_of_work) {
+  auto impl = std::make_shared<iocoro::detail::io_context_impl>();
+
+  struct count_state {
+    std::atomic<int>* completed{};
+    std::atomic<int>* aborted{};
+
+    void on_complete() noexcept { completed->fetch_add(1, std::memory_order_relaxed); }
+    void on_abort(std::error_code) noexcept { aborted->fetch_add(1, std::memory_order_relaxed); }
+  };
+
+  constexpr int timer_count = 256;
+  std::atomic<int> completed{0};
+  std::atomic<int> aborted{0};
+
+  // Register from posted tasks so that registrations come from whichever runner picks them up,
+  // not only from the thread currently holding the reactor role.
+  for (int i = 0; i < timer_count; ++i) {
+    impl->post([&, i] {
+      auto op = iocoro::detail::make_reactor_op<count_state>(count_state{&completed, &aborted});
+      (void)impl->add_timer(std::chrono::milliseconds{i % 7}, std::move(op));
+    });
+  }
+
+  std::vector<std::thread> runners;
+  for (int i = 0; i < 4; ++i) {
+    runners.emplace_back([&] { (void)impl->run(); });
+  }
+  for (auto& t : runners) {
+    t.join();
+  }
+
+  EXPECT_EQ(completed.load(), timer_count);
+  EXPECT_EQ(aborted.load(), 0);
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <iocoro/io_context_pool.hpp>
+
+#include "test_util.hpp"
+
+#include <atomic>
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+#include <set>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#include <unistd.h>
+
+TEST(io_context_pool_test, size_returns_context_count) {
+  iocoro::io_context_pool pool{3};
+  EXPECT_EQ(pool.size(), 3U);
+}
+
+TEST(io_context_pool_test, round_robin_cycles_through_contexts) {
+  iocoro::io_context_pool pool{3};
+
+  std::vector<iocoro::any_io_executor> picked;
+  for (int i = 0; i < 6; ++i) {
+    picked.push_back(pool.get_executor());
+  }
+  EXPECT_NE(picked[0], picked[1]);
+  EXPECT_NE(picked[1], picked[2]);
+  EXPECT_NE(picked[0], picked[2]);
+  EXPECT_EQ(picked[0], picked[3]);
+  EXPECT_EQ(picked[1], picked[4]);
+  EXPECT_EQ(picked[2], picked[5]);
+}
+
+TEST(io_context_pool_test, each_context_runs_on_its_own_thread) {
+  iocoro::io_context_pool pool{2};
+
+  std::mutex m;
+  std::condition_variable cv;
+  std::set<std::thread::id> ids;
+  int done = 0;
+  constexpr int total = 64;
+
+  for (int i = 0; i < total; ++i) {
+    auto ex = pool.get_executor();
+    ex.post([&, ex] {
+      EXPECT_TRUE(ex.io_context_ptr()->running_in_this_thread());
+      std::scoped_lock lk{m};
+      ids.insert(std::this_thread::get_id());
+      ++done;
+      cv.notify_all();
+    });
+  }
+
+  std::unique_lock lk{m};
+  ASSERT_TRUE(cv.wait_for(lk, std::chrono::seconds{5}, [&] { return done == total; }));
+  EXPECT_EQ(ids.size(), 2U);
+  EXPECT_EQ(ids.count(std::this_thread::get_id()), 0U);
+}
+
+TEST(io_context_pool_test, least_loaded_avoids_context_with_registered_fds) {
+  iocoro::io_context_pool pool{2, {.policy = iocoro::io_context_pool::select_policy::least_loaded}};
+
+  int fds[2]{-1, -1};
+  ASSERT_EQ(::pipe(fds), 0);
+  iocoro::test::unique_fd r{fds[0]};
+  iocoro::test::unique_fd w{fds[1]};
+
+  auto* busy = pool.context(0).get_executor().io_context_ptr();
+  ASSERT_TRUE(busy->add_fd(r.get()));
+  ASSERT_TRUE(busy->add_fd(w.get()));
+
+  auto idle = pool.context(1).get_executor();
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_EQ(pool.get_executor(), idle);
+  }
+
+  busy->remove_fd_sync(r.get());
+  busy->remove_fd_sync(w.get());
+}
+
+TEST(io_context_pool_test, exception_handler_is_called_and_context_keeps_running) {
+  iocoro::io_context_pool pool{1};
+
+  std::mutex m;
+  std::condition_variable cv;
+  std::atomic<int> exceptions{0};
+  std::atomic<bool> ran_after{false};
+
+  pool.set_exception_handler([&](std::exception_ptr ep) {
+    if (ep) {
+      exceptions.fetch_add(1);
+    }
+    std::scoped_lock lk{m};
+    cv.notify_all();
+  });
+
+  auto ex = pool.get_executor();
+  ex.post([] { throw std::runtime_error{"boom"}; });
+  ex.post([&] {
+    ran_after.store(true);
+    std::scoped_lock lk{m};
+    cv.notify_all();
+  });
+
+  std::unique_lock lk{m};
+  ASSERT_TRUE(cv.wait_for(lk, std::chrono::seconds{5},
+                          [&] { return exceptions.load() == 1 && ran_after.load(); }));
+}
+
+TEST(io_context_pool_test, join_stops_all_contexts) {
+  iocoro::io_context_pool pool{3};
+  pool.join();
+  for (std::size_t i = 0; i < pool.size(); ++i) {
+    EXPECT_TRUE(pool.context(i).stopped());
+  }
+  pool.join();
+}
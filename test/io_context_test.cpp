@@ -123,6 +123,17 @@ TEST(io_context_test, run_for_processes_posted_work) {
   EXPECT_EQ(count.load(), 1);
 }
 
+TEST(io_context_test, run_for_keeps_the_milliseconds_overload) {
+  iocoro::io_context ctx;
+  auto ex = ctx.get_executor();
+
+  // Code written against the milliseconds signature can still name it.
+  auto (iocoro::io_context::*run_for_ms)(std::chrono::milliseconds) -> std::size_t =
+    &iocoro::io_context::run_for;
+  ex.post([] {});
+  EXPECT_EQ((ctx.*run_for_ms)(std::chrono::milliseconds{1}), 1U);
+}
+
 TEST(io_context_test, stop_preserves_posted_until_restart) {
   iocoro::io_context ctx;
   auto ex = ctx.get_executor();
@@ -315,3 +326,152 @@ TEST(io_context_test, dispatch_after_run_exit_is_not_inline_until_next_run) {
   EXPECT_EQ(order[0], 1);
   EXPECT_EQ(order[1], 2);
 }
+
+TEST(io_context_test, backend_options_construct_a_runnable_context) {
+  iocoro::io_context::options opts{};
+  opts.backend.queue_depth = 32;
+  opts.backend.single_issuer = true;
+  iocoro::io_context ctx{opts};
+
+  int count = 0;
+  ctx.get_executor().post([&] { ++count; });
+  ctx.run();
+  ctx.restart();
+  ctx.get_executor().post([&] { ++count; });
+  ctx.run();
+  EXPECT_EQ(count, 2);
+}
+
+TEST(io_context_test, busy_poll_picks_up_foreign_posts_and_honors_run_for_deadline) {
+  iocoro::io_context::options opts{};
+  opts.busy_poll = 200us;
+  iocoro::io_context ctx{opts};
+  auto ex = ctx.get_executor();
+  auto guard = iocoro::make_work_guard(ctx);
+
+  std::atomic<int> count{0};
+  std::thread producer([&] {
+    for (int i = 0; i < 100; ++i) {
+      ex.post([&] { count.fetch_add(1, std::memory_order_relaxed); });
+      std::this_thread::sleep_for(50us);
+    }
+    ex.post([&] { guard.reset(); });
+  });
+  ctx.run();
+  producer.join();
+  EXPECT_EQ(count.load(), 100);
+
+  // With nothing to find, spinning must still stop at the run_for() deadline.
+  ctx.restart();
+  auto idle_guard = iocoro::make_work_guard(ctx);
+  auto const start = std::chrono::steady_clock::now();
+  ctx.run_for(20ms);
+  auto const elapsed = std::chrono::steady_clock::now() - start;
+  EXPECT_GE(elapsed, 20ms);
+  EXPECT_LT(elapsed, 1s);
+}
+
+TEST(io_context_test, multiple_threads_can_run_the_same_context) {
+  iocoro::io_context ctx;
+  auto ex = ctx.get_executor();
+
+  constexpr int task_count = 2000;
+  std::atomic<int> executed{0};
+  for (int i = 0; i < task_count; ++i) {
+    ex.post([&] { executed.fetch_add(1, std::memory_order_relaxed); });
+  }
+
+  std::atomic<std::size_t> total{0};
+  std::vector<std::thread> runners;
+  for (int i = 0; i < 4; ++i) {
+    runners.emplace_back([&] { total.fetch_add(ctx.run(), std::memory_order_relaxed); });
+  }
+  for (auto& t : runners) {
+    t.join();
+  }
+
+  EXPECT_EQ(executed.load(), task_count);
+  EXPECT_EQ(total.load(), static_cast<std::size_t>(task_count));
+}
+
+TEST(io_context_test, runner_stays_while_another_runner_executes_a_taken_handler) {
+  iocoro::io_context ctx;
+  auto ex = ctx.get_executor();
+
+  std::atomic<bool> started{false};
+  std::atomic<bool> release{false};
+  std::atomic<int> follow_ups{0};
+  ex.post([&] {
+    started.store(true);
+    while (!release.load()) {
+      std::this_thread::yield();
+    }
+    for (int i = 0; i < 16; ++i) {
+      ex.post([&] { follow_ups.fetch_add(1); });
+    }
+  });
+
+  std::thread first{[&] { (void)ctx.run(); }};
+  while (!started.load()) {
+    std::this_thread::yield();
+  }
+
+  // The only handler is taken but still running: the context is not out of work.
+  std::atomic<bool> second_returned{false};
+  std::thread second{[&] {
+    (void)ctx.run();
+    second_returned.store(true);
+  }};
+  std::this_thread::sleep_for(20ms);
+  EXPECT_FALSE(second_returned.load());
+
+  release.store(true);
+  first.join();
+  second.join();
+  EXPECT_EQ(follow_ups.load(), 16);
+}
+
+TEST(io_context_test, stop_wakes_all_runner_threads) {
+  iocoro::io_context ctx;
+  auto guard = iocoro::make_work_guard(ctx);
+
+  std::atomic<int> exited{0};
+  std::vector<std::thread> runners;
+  for (int i = 0; i < 4; ++i) {
+    runners.emplace_back([&] {
+      (void)ctx.run();
+      exited.fetch_add(1, std::memory_order_relaxed);
+    });
+  }
+
+  std::this_thread::sleep_for(20ms);
+  EXPECT_EQ(exited.load(), 0);
+  ctx.stop();
+  for (auto& t : runners) {
+    t.join();
+  }
+  EXPECT_EQ(exited.load(), 4);
+}
+
+TEST(io_context_test, post_bulk_runs_in_order_and_bulk_through_any_executor) {
+  iocoro::io_context ctx;
+  std::vector<int> order;
+
+  std::vector<iocoro::detail::unique_function<void()>> batch;
+  for (int i = 0; i < 3; ++i) {
+    batch.emplace_back([&order, i] { order.push_back(i); });
+  }
+  ctx.get_executor().post_bulk(batch);
+
+  batch.clear();
+  for (int i = 3; i < 6; ++i) {
+    batch.emplace_back([&order, i] {
+      EXPECT_TRUE(iocoro::detail::get_current_executor());
+      order.push_back(i);
+    });
+  }
+  iocoro::any_executor{ctx.get_executor()}.post_bulk(batch);
+
+  EXPECT_EQ(ctx.run(), 6U);
+  EXPECT_EQ(order, (std::vector<int>{0, 1, 2, 3, 4, 5}));
+}
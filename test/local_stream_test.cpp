@@ -85,3 +85,69 @@ TEST(local_stream_test, endpoint_from_path_rejects_invalid_lengths) {
   ASSERT_FALSE(too_long);
   EXPECT_EQ(too_long.error(), iocoro::error::invalid_argument);
 }
+
+TEST(local_stream_test, zerocopy_write_falls_back_to_a_copying_send) {
+  auto path = iocoro::test::make_temp_path("iocoro_local_stream_zc");
+  iocoro::test::unlink_path(path);
+
+  auto ep = iocoro::local::endpoint::from_path(path);
+  ASSERT_TRUE(ep);
+
+  iocoro::io_context ctx;
+  iocoro::local::stream::acceptor acc{ctx};
+
+  auto lr = acc.listen(*ep);
+  ASSERT_TRUE(lr) << lr.error().message();
+
+  std::string received;
+  std::thread client([path, &received] {
+    int fd = ::socket(AF_UNIX, SOCK_STREAM, 0);
+    if (fd < 0) {
+      return;
+    }
+    sockaddr_un addr{};
+    addr.sun_family = AF_UNIX;
+    std::snprintf(addr.sun_path, sizeof(addr.sun_path), "%s", path.c_str());
+    bool connected = false;
+    for (int i = 0; i < 200; ++i) {
+      if (::connect(fd, reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) == 0) {
+        connected = true;
+        break;
+      }
+      std::this_thread::sleep_for(std::chrono::milliseconds{1});
+    }
+    if (!connected) {
+      (void)::close(fd);
+      return;
+    }
+    std::array<char, 16> buf{};
+    for (;;) {
+      auto n = ::recv(fd, buf.data(), buf.size(), 0);
+      if (n <= 0) {
+        break;
+      }
+      received.append(buf.data(), static_cast<std::size_t>(n));
+    }
+    (void)::close(fd);
+  });
+
+  // AF_UNIX has no SO_ZEROCOPY: the write must complete as a plain send, not wait forever.
+  auto r = iocoro::test::sync_wait(ctx, [&]() -> iocoro::awaitable<iocoro::result<std::size_t>> {
+    auto accepted = co_await acc.async_accept();
+    if (!accepted) {
+      co_return iocoro::unexpected(accepted.error());
+    }
+    std::string const out = "hello";
+    auto wr = co_await accepted->async_write_some_zerocopy(iocoro::net::buffer(out));
+    (void)accepted->close();
+    co_return wr;
+  }());
+
+  client.join();
+  iocoro::test::unlink_path(path);
+
+  ASSERT_TRUE(r);
+  ASSERT_TRUE(*r) << r->error().message();
+  EXPECT_EQ(**r, 5U);
+  EXPECT_EQ(received, "hello");
+}
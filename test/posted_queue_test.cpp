@@ -0,0 +1,177 @@
+#include <gtest/gtest.h>
+
+#include <iocoro/detail/posted_queue.hpp>
+
+#include <atomic>
+#include <cstddef>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+TEST(posted_queue_test, process_runs_tasks_in_fifo_order) {
+  iocoro::detail::posted_queue q;
+  std::vector<int> order;
+
+  for (int i = 0; i < 5; ++i) {
+    q.post([&order, i] { order.push_back(i); });
+  }
+  EXPECT_TRUE(q.has_pending_tasks());
+  EXPECT_EQ(q.pending_count(), 5U);
+
+  EXPECT_EQ(q.process(), 5U);
+  EXPECT_EQ(order, (std::vector<int>{0, 1, 2, 3, 4}));
+  EXPECT_FALSE(q.has_pending_tasks());
+  EXPECT_EQ(q.process(), 0U);
+}
+
+TEST(posted_queue_test, process_respects_batch_bound) {
+  iocoro::detail::posted_queue q;
+  int runs = 0;
+  for (int i = 0; i < 10; ++i) {
+    q.post([&runs] { ++runs; });
+  }
+
+  EXPECT_EQ(q.process(4), 4U);
+  EXPECT_EQ(runs, 4);
+  EXPECT_EQ(q.pending_count(), 6U);
+  EXPECT_EQ(q.process(), 6U);
+  EXPECT_EQ(runs, 10);
+}
+
+TEST(posted_queue_test, tasks_posted_while_processing_run_in_a_later_batch) {
+  iocoro::detail::posted_queue q;
+  int runs = 0;
+  q.post([&] {
+    ++runs;
+    q.post([&runs] { ++runs; });
+  });
+
+  EXPECT_EQ(q.process(), 1U);
+  EXPECT_EQ(runs, 1);
+  EXPECT_EQ(q.process(), 1U);
+  EXPECT_EQ(runs, 2);
+}
+
+TEST(posted_queue_test, taken_tasks_stay_outstanding_until_they_have_run) {
+  iocoro::detail::posted_queue q;
+  EXPECT_FALSE(q.has_outstanding_work());
+
+  bool outstanding_while_running = false;
+  q.post([&] {
+    outstanding_while_running = q.has_outstanding_work();
+    EXPECT_FALSE(q.has_pending_tasks());
+  });
+  EXPECT_TRUE(q.has_outstanding_work());
+
+  EXPECT_EQ(q.process(), 1U);
+  EXPECT_TRUE(outstanding_while_running);
+  EXPECT_FALSE(q.has_outstanding_work());
+
+  q.post([] { throw std::runtime_error{"boom"}; });
+  q.post([] {});
+  EXPECT_THROW((void)q.process(), std::runtime_error);
+  EXPECT_TRUE(q.has_outstanding_work());
+  EXPECT_EQ(q.process(), 1U);
+  EXPECT_FALSE(q.has_outstanding_work());
+}
+
+TEST(posted_queue_test, throwing_task_keeps_the_rest_of_the_batch_in_order) {
+  iocoro::detail::posted_queue q;
+  std::vector<int> order;
+
+  q.post([&order] { order.push_back(0); });
+  q.post([] { throw std::runtime_error{"boom"}; });
+  q.post([&order] { order.push_back(2); });
+  q.post([&order] { order.push_back(3); });
+
+  EXPECT_THROW((void)q.process(), std::runtime_error);
+  EXPECT_EQ(order, (std::vector<int>{0}));
+  EXPECT_EQ(q.pending_count(), 2U);
+
+  q.post([&order] { order.push_back(4); });
+  EXPECT_EQ(q.process(), 3U);
+  EXPECT_EQ(order, (std::vector<int>{0, 2, 3, 4}));
+}
+
+TEST(posted_queue_test, concurrent_producers_deliver_every_task_once) {
+  iocoro::detail::posted_queue q;
+  constexpr int producers = 4;
+  constexpr int per_producer = 5000;
+  std::atomic<int> done_producers{0};
+  std::vector<int> counts(producers, 0);
+  std::vector<int> last_seen(producers, -1);
+  bool in_order = true;
+
+  std::vector<std::thread> threads;
+  threads.reserve(producers);
+  for (int p = 0; p < producers; ++p) {
+    threads.emplace_back([&, p] {
+      for (int i = 0; i < per_producer; ++i) {
+        q.post([&, p, i] {
+          ++counts[p];
+          if (last_seen[p] >= i) {
+            in_order = false;
+          }
+          last_seen[p] = i;
+        });
+      }
+      done_producers.fetch_add(1, std::memory_order_release);
+    });
+  }
+
+  std::size_t total = 0;
+  while (done_producers.load(std::memory_order_acquire) < producers || q.has_pending_tasks()) {
+    total += q.process(64);
+  }
+  for (auto& t : threads) {
+    t.join();
+  }
+  total += q.process();
+
+  EXPECT_EQ(total, static_cast<std::size_t>(producers * per_producer));
+  for (int p = 0; p < producers; ++p) {
+    EXPECT_EQ(counts[p], per_producer);
+  }
+  EXPECT_TRUE(in_order);
+}
+
+TEST(posted_queue_test, post_bulk_keeps_order_with_single_posts) {
+  iocoro::detail::posted_queue q;
+  std::vector<int> order;
+
+  q.post([&order] { order.push_back(0); });
+  std::vector<iocoro::detail::unique_function<void()>> batch;
+  for (int i = 1; i <= 3; ++i) {
+    batch.emplace_back([&order, i] { order.push_back(i); });
+  }
+  q.post_bulk(batch);
+  q.post_bulk({});
+  q.post([&order] { order.push_back(4); });
+  EXPECT_EQ(q.pending_count(), 5U);
+
+  EXPECT_EQ(q.process(), 5U);
+  EXPECT_EQ(order, (std::vector<int>{0, 1, 2, 3, 4}));
+  for (auto const& f : batch) {
+    EXPECT_FALSE(f);
+  }
+}
+
+TEST(posted_queue_test, tasks_outlive_the_thread_that_posted_them) {
+  iocoro::detail::posted_queue q;
+  constexpr int count = 100;
+  int ran = 0;
+
+  std::thread producer{[&] {
+    for (int i = 0; i < count; ++i) {
+      q.post([&ran] { ++ran; });
+    }
+  }};
+  producer.join();
+
+  EXPECT_EQ(q.process(), static_cast<std::size_t>(count));
+  EXPECT_EQ(ran, count);
+
+  // Tasks still queued at destruction are released with the queue.
+  std::thread{[&] { q.post([] {}); }}.join();
+  EXPECT_TRUE(q.has_pending_tasks());
+}
@@ -0,0 +1,127 @@
+#include <gtest/gtest.h>
+
+#include <iocoro/detail/reactor_backend.hpp>
+#include <iocoro/io_context.hpp>
+
+#include <chrono>
+#include <vector>
+
+#include <fcntl.h>
+#include <sys/resource.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+using namespace std::chrono_literals;
+
+TEST(reactor_backend_test, sub_millisecond_timeout_blocks_for_the_full_duration) {
+  auto backend = iocoro::detail::make_backend();
+  std::vector<iocoro::detail::backend_event> out;
+
+  // A millisecond-granular backend would turn these into a zero-timeout poll.
+  for (auto const timeout : {300us, 750us, 1300us}) {
+    auto const start = std::chrono::steady_clock::now();
+    backend->prepare_wait();
+    backend->wait(std::chrono::steady_clock::duration{timeout}, out);
+    auto const elapsed = std::chrono::steady_clock::now() - start;
+
+    EXPECT_GE(elapsed, timeout) << "woke early for a " << timeout.count() << "us timeout";
+    EXPECT_LT(elapsed, 1s);
+    EXPECT_TRUE(out.empty());
+  }
+}
+
+TEST(reactor_backend_test, zero_timeout_polls_and_wakeup_interrupts_untimed_wait) {
+  auto backend = iocoro::detail::make_backend();
+  std::vector<iocoro::detail::backend_event> out;
+
+  auto const start = std::chrono::steady_clock::now();
+  backend->wait(std::chrono::steady_clock::duration::zero(), out);
+  EXPECT_LT(std::chrono::steady_clock::now() - start, 1s);
+
+  backend->prepare_wait();
+  backend->wakeup();
+  backend->wait(std::nullopt, out);
+  EXPECT_TRUE(out.empty());
+}
+
+TEST(reactor_backend_test, custom_options_construct_a_working_backend) {
+  iocoro::detail::backend_options opts{};
+  opts.queue_depth = 64;
+  opts.single_issuer = true;
+  opts.coop_taskrun = true;
+  auto backend = iocoro::detail::make_backend(opts);
+  std::vector<iocoro::detail::backend_event> out;
+
+  backend->prepare_wait();
+  backend->wakeup();
+  backend->wait(std::nullopt, out);
+  EXPECT_TRUE(out.empty());
+}
+
+TEST(reactor_backend_test, fds_beyond_the_first_table_chunk_report_readiness_until_removed) {
+  rlimit lim{};
+  ASSERT_EQ(::getrlimit(RLIMIT_NOFILE, &lim), 0);
+  if (lim.rlim_cur != RLIM_INFINITY && lim.rlim_cur <= 5000) {
+    GTEST_SKIP() << "RLIMIT_NOFILE too low for a high fd";
+  }
+
+  int pair[2]{};
+  ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0, pair), 0);
+  int const high = ::fcntl(pair[0], F_DUPFD_CLOEXEC, 5000);
+  ASSERT_GE(high, 5000);
+
+  auto backend = iocoro::detail::make_backend();
+  std::vector<iocoro::detail::backend_event> out;
+  backend->add_fd(high);
+  ASSERT_EQ(::write(pair[1], "x", 1), 1);
+
+  backend->prepare_wait();
+  backend->wait(std::chrono::steady_clock::duration{1s}, out);
+  ASSERT_EQ(out.size(), 1U);
+  EXPECT_EQ(out[0].fd, high);
+  EXPECT_TRUE(out[0].can_read);
+
+  // Re-registration bumps the generation; after removal nothing is reported for the fd.
+  backend->add_fd(high);
+  backend->remove_fd(high);
+  ASSERT_EQ(::write(pair[1], "y", 1), 1);
+  backend->prepare_wait();
+  backend->wait(std::chrono::steady_clock::duration{10ms}, out);
+  EXPECT_TRUE(out.empty());
+
+  ::close(high);
+  ::close(pair[0]);
+  ::close(pair[1]);
+}
+
+TEST(reactor_backend_test, saturated_event_batch_grows_up_to_the_limit) {
+#if defined(IOCORO_BACKEND_URING)
+  GTEST_SKIP() << "epoll event batch sizing";
+#endif
+  constexpr int n = 4;
+  int pairs[n][2]{};
+  iocoro::detail::backend_options opts{};
+  opts.max_events = 1;
+  opts.max_events_limit = 2;
+  auto backend = iocoro::detail::make_backend(opts);
+  for (auto& p : pairs) {
+    ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK | SOCK_CLOEXEC, 0, p), 0);
+    backend->add_fd(p[0]);
+    ASSERT_EQ(::write(p[1], "x", 1), 1);
+  }
+
+  // Edge-triggered: events not fetched by one wait stay pending for the next.
+  std::vector<iocoro::detail::backend_event> out;
+  std::vector<std::size_t> batches;
+  for (int i = 0; i < 3; ++i) {
+    backend->wait(std::chrono::steady_clock::duration::zero(), out);
+    batches.push_back(out.size());
+  }
+  EXPECT_EQ(batches, (std::vector<std::size_t>{1, 2, 1}));
+
+  for (auto& p : pairs) {
+    backend->remove_fd(p[0]);
+    ::close(p[0]);
+    ::close(p[1]);
+  }
+}
@@ -1,5 +1,6 @@
 #include <gtest/gtest.h>
 
+#include <iocoro/co_spawn.hpp>
 #include <iocoro/detail/socket/socket_impl_base.hpp>
 #include <iocoro/io_context.hpp>
 
@@ -9,7 +10,9 @@
 #include <unistd.h>
 #include <atomic>
 #include <chrono>
+#include <string>
 #include <thread>
+#include <vector>
 
 TEST(socket_impl_base_test, open_close_lifecycle) {
   iocoro::io_context ctx;
@@ -153,3 +156,114 @@ TEST(socket_impl_base_test, release_never_succeeds_while_operation_guard_is_live
   (void)::close(released_fd);
   (void)::close(fds[1]);
 }
+
+TEST(socket_impl_base_test, readiness_resumes_the_waiter_inline_in_the_same_run_one) {
+  iocoro::io_context ctx;
+  iocoro::detail::socket::socket_impl_base base{ctx.get_executor()};
+  int fds[2]{-1, -1};
+  ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds), 0);
+  ASSERT_TRUE(base.assign(fds[0]));
+
+  bool resumed = false;
+  iocoro::co_spawn(
+    ctx.get_executor(),
+    [&]() -> iocoro::awaitable<void> {
+      auto r = co_await base.wait_read_ready();
+      EXPECT_TRUE(r);
+      resumed = true;
+    },
+    iocoro::detached);
+
+  // Let the coroutine register its wait, then make the fd readable.
+  ctx.run_for(std::chrono::milliseconds{20});
+  ctx.restart();
+  ASSERT_FALSE(resumed);
+  ASSERT_EQ(::write(fds[1], "x", 1), 1);
+
+  // One reactor turn both dispatches the readiness and resumes the coroutine.
+  EXPECT_EQ(ctx.run_one(), 1U);
+  EXPECT_TRUE(resumed);
+
+  base.close();
+  (void)::close(fds[1]);
+}
+
+TEST(socket_impl_base_test, readiness_is_posted_while_another_thread_runs_the_context) {
+  iocoro::io_context ctx;
+  auto ex = ctx.get_executor();
+  iocoro::detail::socket::socket_impl_base base{ex};
+  int fds[2]{-1, -1};
+  ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds), 0);
+  ASSERT_TRUE(base.assign(fds[0]));
+
+  std::atomic<bool> resumed{false};
+  iocoro::co_spawn(
+    ex,
+    [&]() -> iocoro::awaitable<void> {
+      auto r = co_await base.wait_read_ready();
+      EXPECT_TRUE(r);
+      resumed.store(true);
+    },
+    iocoro::detached);
+  ctx.run_for(std::chrono::milliseconds{20});
+  ctx.restart();
+
+  // Keep a second runner inside run() but busy, so it neither holds the reactor role nor drains.
+  std::atomic<bool> busy{false};
+  std::atomic<bool> release{false};
+  ex.post([&] {
+    busy.store(true);
+    while (!release.load()) {
+      std::this_thread::yield();
+    }
+  });
+  std::thread other{[&] { ctx.run(); }};
+  while (!busy.load()) {
+    std::this_thread::yield();
+  }
+
+  ASSERT_EQ(::write(fds[1], "x", 1), 1);
+  // The readiness is dispatched on this thread, but resumption goes through the posted queue
+  // where any runner can take it.
+  EXPECT_EQ(ctx.run_one(), 1U);
+  EXPECT_FALSE(resumed.load());
+
+  release.store(true);
+  ctx.run();
+  other.join();
+  EXPECT_TRUE(resumed.load());
+
+  base.close();
+  (void)::close(fds[1]);
+}
+
+TEST(socket_impl_base_test, abort_caused_by_user_code_does_not_resume_the_waiter_nested) {
+  iocoro::io_context ctx;
+  auto ex = ctx.get_executor();
+  iocoro::detail::socket::socket_impl_base base{ex};
+  int fds[2]{-1, -1};
+  ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM | SOCK_NONBLOCK, 0, fds), 0);
+  ASSERT_TRUE(base.assign(fds[0]));
+
+  std::vector<std::string> order;
+  iocoro::co_spawn(
+    ex,
+    [&]() -> iocoro::awaitable<void> {
+      auto r = co_await base.wait_read_ready();
+      EXPECT_FALSE(r);
+      order.emplace_back("waiter resumed");
+    },
+    iocoro::detached);
+  ctx.run_for(std::chrono::milliseconds{20});
+  ctx.restart();
+
+  ex.post([&] {
+    base.cancel_read();
+    order.emplace_back("cancel returned");
+  });
+  ctx.run();
+
+  EXPECT_EQ(order, (std::vector<std::string>{"cancel returned", "waiter resumed"}));
+  base.close();
+  (void)::close(fds[1]);
+}
@@ -11,6 +11,7 @@
 #include <mutex>
 #include <stdexcept>
 #include <thread>
+#include <vector>
 
 TEST(strand_test, tasks_on_same_strand_never_run_concurrently) {
   iocoro::thread_pool pool{4};
@@ -163,3 +164,116 @@ TEST(strand_test, drain_does_not_swallow_task_exception) {
   (void)ctx.run();
   EXPECT_EQ(ran.load(std::memory_order_relaxed), 2);
 }
+
+TEST(strand_test, post_bulk_runs_in_order_without_overlap) {
+  iocoro::thread_pool pool{4};
+  auto s = iocoro::make_strand(pool.get_executor());
+
+  constexpr int total = 100;
+  std::mutex m;
+  std::condition_variable cv;
+  std::vector<int> order;
+  std::atomic<int> in_flight{0};
+  std::atomic<bool> overlapped{false};
+
+  std::vector<iocoro::detail::unique_function<void()>> batch;
+  for (int i = 0; i < total; ++i) {
+    batch.emplace_back([&, i] {
+      if (in_flight.fetch_add(1) != 0) {
+        overlapped.store(true);
+      }
+      std::scoped_lock lk{m};
+      order.push_back(i);
+      in_flight.fetch_sub(1);
+      cv.notify_all();
+    });
+  }
+  s.post_bulk(batch);
+
+  std::unique_lock lk{m};
+  ASSERT_TRUE(cv.wait_for(lk, std::chrono::seconds{5}, [&] { return order.size() == total; }));
+  EXPECT_FALSE(overlapped.load());
+  for (int i = 0; i < total; ++i) {
+    EXPECT_EQ(order[static_cast<std::size_t>(i)], i);
+  }
+}
+
+TEST(strand_test, dispatch_on_io_context_thread_runs_inline_when_strand_is_idle) {
+  iocoro::io_context ctx;
+  auto s = iocoro::make_strand(ctx.get_executor());
+  std::vector<int> order;
+
+  ctx.get_executor().post([&] {
+    order.push_back(1);
+    s.dispatch([&] {
+      auto const cur = iocoro::detail::get_current_executor();
+      EXPECT_NE(iocoro::detail::any_executor_access::target<iocoro::strand_executor>(cur),
+                nullptr);
+      order.push_back(2);
+    });
+    order.push_back(3);
+  });
+
+  ctx.run();
+  EXPECT_EQ(order, (std::vector<int>{1, 2, 3}));
+}
+
+TEST(strand_test, dispatch_on_io_context_thread_queues_behind_pending_strand_work) {
+  iocoro::io_context ctx;
+  auto s = iocoro::make_strand(ctx.get_executor());
+  std::vector<int> order;
+
+  ctx.get_executor().post([&] {
+    order.push_back(1);
+    s.dispatch([&] { order.push_back(3); });
+  });
+  s.post([&] { order.push_back(2); });
+
+  ctx.run();
+  EXPECT_EQ(order, (std::vector<int>{1, 2, 3}));
+}
+
+TEST(strand_test, busy_strand_on_io_context_yields_after_a_drain_batch) {
+  iocoro::io_context ctx;
+  auto s = iocoro::make_strand(ctx.get_executor());
+
+  constexpr int total = 1000;
+  int ran = 0;
+  int ran_before_other = -1;
+  for (int i = 0; i < total; ++i) {
+    s.post([&] { ++ran; });
+  }
+  ctx.get_executor().post([&] { ran_before_other = ran; });
+
+  ctx.run();
+  EXPECT_EQ(ran, total);
+  EXPECT_EQ(ran_before_other, static_cast<int>(iocoro::strand_executor::max_drain_per_tick));
+}
+
+TEST(strand_test, tasks_posted_from_other_threads_all_run_on_io_context) {
+  iocoro::io_context ctx;
+  auto guard = iocoro::make_work_guard(ctx);
+  auto s = iocoro::make_strand(ctx.get_executor());
+
+  constexpr int producers = 4;
+  constexpr int per_producer = 20000;
+  std::atomic<int> remaining{producers * per_producer};
+  std::vector<std::thread> threads;
+  for (int p = 0; p < producers; ++p) {
+    threads.emplace_back([&] {
+      for (int i = 0; i < per_producer; ++i) {
+        s.post([&] {
+          if (remaining.fetch_sub(1) == 1) {
+            guard.reset();
+          }
+        });
+      }
+    });
+  }
+
+  ctx.run();
+  for (auto& t : threads) {
+    t.join();
+  }
+  EXPECT_EQ(remaining.load(), 0);
+}
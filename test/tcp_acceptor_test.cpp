@@ -106,6 +106,46 @@ TEST(tcp_acceptor_test, accepts_multiple_connections_sequentially) {
   EXPECT_EQ(**r, 4U);
 }
 
+TEST(tcp_acceptor_test, accept_onto_other_executor_registers_fd_only_with_that_context) {
+  iocoro::io_context ctx;
+  iocoro::io_context other;
+  iocoro::ip::tcp::acceptor acc{ctx};
+
+  auto lr = acc.listen(iocoro::ip::tcp::endpoint{iocoro::ip::address_v4::loopback(), 0});
+  ASSERT_TRUE(lr) << lr.error().message();
+
+  auto local_ep = acc.local_endpoint();
+  ASSERT_TRUE(local_ep);
+
+  // Connect up-front (completes via the listen backlog) so the accept does not need to wait.
+  iocoro::test::unique_fd client{::socket(AF_INET, SOCK_STREAM, 0)};
+  ASSERT_GE(client.get(), 0);
+  ASSERT_EQ(::connect(client.get(), local_ep->data(), local_ep->size()), 0);
+
+  auto* ctx_impl = ctx.get_executor().io_context_ptr();
+  auto* other_impl = other.get_executor().io_context_ptr();
+  std::size_t const ctx_load_before = ctx_impl->load();
+  std::size_t ctx_load_after = 0;
+  std::size_t other_load_after = 0;
+
+  auto r = iocoro::test::sync_wait(ctx, [&]() -> iocoro::awaitable<iocoro::result<bool>> {
+    auto other_ex = other.get_executor();
+    auto accepted = co_await acc.async_accept(other_ex);
+    if (!accepted) {
+      co_return iocoro::unexpected(accepted.error());
+    }
+    ctx_load_after = ctx_impl->load();
+    other_load_after = other_impl->load();
+    co_return accepted->get_executor() == other_ex;
+  }());
+
+  ASSERT_TRUE(r);
+  ASSERT_TRUE(*r) << r->error().message();
+  EXPECT_TRUE(**r);
+  EXPECT_EQ(ctx_load_after, ctx_load_before);
+  EXPECT_EQ(other_load_after, 1U);
+}
+
 TEST(tcp_acceptor_test, listen_with_mismatched_family_on_open_socket_returns_invalid_argument) {
   iocoro::io_context ctx;
   iocoro::ip::tcp::acceptor acc{ctx};
@@ -11,9 +11,11 @@
 
 #include "test_util.hpp"
 
+#include <algorithm>
 #include <array>
 #include <chrono>
 #include <cstring>
+#include <string>
 #include <thread>
 
 TEST(tcp_socket_test, connect_and_exchange_data) {
@@ -206,6 +208,50 @@ TEST(tcp_socket_test, async_read_some_returns_zero_on_peer_graceful_close) {
   EXPECT_EQ(**r, 0U);
 }
 
+TEST(tcp_socket_test, async_receive_buffer_returns_owned_bytes_then_empty_at_eof) {
+  auto [listen_fd, port] = iocoro::test::make_listen_socket_ipv4();
+  ASSERT_GE(listen_fd.get(), 0);
+  ASSERT_NE(port, 0);
+
+  std::thread server([fd = listen_fd.get()] {
+    int client = ::accept(fd, nullptr, nullptr);
+    if (client < 0) {
+      return;
+    }
+    (void)::write(client, "hello", 5);
+    (void)::close(client);
+  });
+
+  iocoro::io_context ctx;
+  iocoro::ip::tcp::socket sock{ctx};
+  iocoro::ip::tcp::endpoint ep{iocoro::ip::address_v4::loopback(), port};
+
+  std::string received;
+  auto r = iocoro::test::sync_wait(ctx, [&]() -> iocoro::awaitable<iocoro::result<void>> {
+    auto cr = co_await sock.async_connect(ep);
+    if (!cr) {
+      co_return iocoro::unexpected(cr.error());
+    }
+    for (;;) {
+      auto b = co_await sock.async_receive_buffer();
+      if (!b) {
+        co_return iocoro::unexpected(b.error());
+      }
+      if (b->empty()) {
+        co_return iocoro::ok();
+      }
+      auto const bytes = b->data();
+      received.append(reinterpret_cast<char const*>(bytes.data()), bytes.size());
+    }
+  }());
+
+  server.join();
+
+  ASSERT_TRUE(r);
+  ASSERT_TRUE(*r) << r->error().message();
+  EXPECT_EQ(received, "hello");
+}
+
 TEST(tcp_socket_test, io_async_read_returns_error_eof_on_peer_graceful_close) {
   auto [listen_fd, port] = iocoro::test::make_listen_socket_ipv4();
   ASSERT_GE(listen_fd.get(), 0);
@@ -331,3 +377,154 @@ TEST(tcp_socket_test, shutdown_send_makes_future_writes_fail_broken_pipe) {
   ASSERT_TRUE(r);
   ASSERT_TRUE(*r);
 }
+
+static_assert(iocoro::io::async_gather_write_stream<iocoro::ip::tcp::socket>);
+static_assert(iocoro::io::async_scatter_read_stream<iocoro::ip::tcp::socket>);
+
+TEST(tcp_socket_test, buffer_sequences_are_written_and_read_vectored) {
+  auto [listen_fd, port] = iocoro::test::make_listen_socket_ipv4();
+  ASSERT_GE(listen_fd.get(), 0);
+  ASSERT_NE(port, 0);
+
+  constexpr std::size_t total = 11;
+  std::thread server([fd = listen_fd.get()] {
+    int client = ::accept(fd, nullptr, nullptr);
+    if (client < 0) {
+      return;
+    }
+
+    // Echo the request back.
+    std::array<char, total> buf{};
+    std::size_t read_total = 0;
+    while (read_total < buf.size()) {
+      auto n = ::recv(client, buf.data() + read_total, buf.size() - read_total, 0);
+      if (n <= 0) {
+        (void)::close(client);
+        return;
+      }
+      read_total += static_cast<std::size_t>(n);
+    }
+    (void)::send(client, buf.data(), buf.size(), 0);
+    (void)::close(client);
+  });
+
+  iocoro::io_context ctx;
+  iocoro::ip::tcp::socket sock{ctx};
+  iocoro::ip::tcp::endpoint ep{iocoro::ip::address_v4::loopback(), port};
+
+  std::string const header = "HEAD ";
+  std::string const body = "body";
+  std::string const trailer = "!\n";
+  std::array<char, 5> head_in{};
+  std::array<char, 6> rest_in{};
+
+  auto r = iocoro::test::sync_wait(ctx, [&]() -> iocoro::awaitable<iocoro::result<std::size_t>> {
+    auto cr = co_await sock.async_connect(ep);
+    if (!cr) {
+      co_return iocoro::unexpected(cr.error());
+    }
+
+    std::array<iocoro::net::const_buffer, 3> out{
+      iocoro::net::buffer(header), iocoro::net::buffer(body), iocoro::net::buffer(trailer)};
+    auto wr = co_await iocoro::io::async_write(sock, out);
+    if (!wr) {
+      co_return iocoro::unexpected(wr.error());
+    }
+    EXPECT_EQ(*wr, total);
+
+    std::array<iocoro::net::mutable_buffer, 2> in{iocoro::net::buffer(head_in),
+                                                  iocoro::net::buffer(rest_in)};
+    co_return co_await iocoro::io::async_read(sock, in);
+  }());
+
+  server.join();
+
+  ASSERT_TRUE(r);
+  ASSERT_TRUE(*r);
+  EXPECT_EQ(**r, total);
+  EXPECT_EQ(std::string(head_in.data(), head_in.size()), "HEAD ");
+  EXPECT_EQ(std::string(rest_in.data(), rest_in.size()), "body!\n");
+}
+
+TEST(tcp_socket_test, zerocopy_writes_deliver_data_without_aborting_a_pending_read) {
+  auto [listen_fd, port] = iocoro::test::make_listen_socket_ipv4();
+  ASSERT_GE(listen_fd.get(), 0);
+  ASSERT_NE(port, 0);
+
+  constexpr std::size_t total = 1 << 20;
+  std::string received;
+  std::thread server([fd = listen_fd.get(), &received] {
+    int client = ::accept(fd, nullptr, nullptr);
+    if (client < 0) {
+      return;
+    }
+    std::array<char, 65536> buf{};
+    while (received.size() < total + 1) {
+      auto n = ::recv(client, buf.data(), buf.size(), 0);
+      if (n <= 0) {
+        break;
+      }
+      received.append(buf.data(), static_cast<std::size_t>(n));
+    }
+    // Let the client's reactor see the unreaped notification before the reply arrives.
+    std::this_thread::sleep_for(std::chrono::milliseconds{50});
+    (void)::send(client, "k", 1, 0);
+    (void)::close(client);
+  });
+
+  iocoro::io_context ctx;
+  iocoro::ip::tcp::socket sock{ctx};
+  iocoro::ip::tcp::endpoint ep{iocoro::ip::address_v4::loopback(), port};
+
+  std::string payload(total, '\0');
+  for (std::size_t i = 0; i < payload.size(); ++i) {
+    payload[i] = static_cast<char>(i * 7);
+  }
+
+  auto r = iocoro::test::sync_wait(ctx, [&]() -> iocoro::awaitable<iocoro::result<std::size_t>> {
+    auto cr = co_await sock.async_connect(ep);
+    if (!cr) {
+      co_return iocoro::unexpected(cr.error());
+    }
+
+    // Completion notifications raise error events on the socket; the reader must sit them out.
+    auto ex = co_await iocoro::this_coro::io_executor;
+    auto ack = iocoro::co_spawn(
+      ex,
+      [&]() -> iocoro::awaitable<iocoro::result<std::size_t>> {
+        std::array<std::byte, 1> buf{};
+        co_return co_await sock.async_read_some(std::span{buf});
+      },
+      iocoro::use_awaitable);
+
+    std::size_t sent = 0;
+    while (sent < payload.size()) {
+      auto chunk = iocoro::net::buffer(payload.data() + sent,
+                                       (std::min)(payload.size() - sent, std::size_t{256 * 1024}));
+      auto wr = co_await sock.async_write_some_zerocopy(chunk);
+      if (!wr) {
+        co_return iocoro::unexpected(wr.error());
+      }
+      sent += *wr;
+    }
+
+    // A notification nobody reaps keeps the socket in an error state while the read waits.
+    if (::send(sock.native_handle(), "z", 1, MSG_ZEROCOPY) != 1) {
+      co_return iocoro::unexpected(std::error_code{errno, std::generic_category()});
+    }
+
+    auto ar = co_await std::move(ack);
+    if (!ar) {
+      co_return iocoro::unexpected(ar.error());
+    }
+    EXPECT_EQ(*ar, 1U);
+    co_return sent;
+  }());
+
+  server.join();
+
+  ASSERT_TRUE(r);
+  ASSERT_TRUE(*r) << r->error().message();
+  EXPECT_EQ(**r, total);
+  EXPECT_TRUE(received == payload + "z");
+}
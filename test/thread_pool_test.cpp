@@ -11,6 +11,7 @@
 #include <mutex>
 #include <stdexcept>
 #include <thread>
+#include <vector>
 
 TEST(thread_pool_test, size_returns_thread_count) {
   iocoro::thread_pool pool{2};
@@ -217,3 +218,92 @@ TEST(thread_pool_test, post_after_stop_is_dropped) {
 
   pool.join();
 }
+
+TEST(thread_pool_test, idle_workers_steal_tasks_posted_from_a_worker) {
+  constexpr int n = 4;
+  iocoro::thread_pool pool{n};
+  auto ex = pool.get_executor();
+
+  // Every task blocks until all of them run at once: only possible if the tasks queued on the
+  // posting worker are picked up by the others.
+  std::atomic<int> arrived{0};
+  std::atomic<int> met{0};
+  auto rendezvous = [&] {
+    arrived.fetch_add(1);
+    auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds{5};
+    while (arrived.load() < n && std::chrono::steady_clock::now() < deadline) {
+      std::this_thread::yield();
+    }
+    if (arrived.load() >= n) {
+      met.fetch_add(1);
+    }
+  };
+
+  ex.post([&] {
+    for (int i = 1; i < n; ++i) {
+      ex.post(rendezvous);
+    }
+    rendezvous();
+  });
+
+  auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+  while (arrived.load() < n && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+  }
+  pool.join();
+  EXPECT_EQ(met.load(), n);
+}
+
+TEST(thread_pool_test, worker_queue_overflow_spills_and_stop_drains_everything) {
+  iocoro::thread_pool pool{2};
+  auto ex = pool.get_executor();
+
+  constexpr int total = 5000;
+  std::atomic<int> ran{0};
+  std::atomic<bool> stopped{false};
+  ex.post([&] {
+    for (int i = 0; i < total; ++i) {
+      ex.post([&] { ran.fetch_add(1, std::memory_order_relaxed); });
+    }
+    // Already-queued tasks still run while the pool drains.
+    pool.stop();
+    stopped.store(true, std::memory_order_release);
+  });
+
+  while (!stopped.load(std::memory_order_acquire)) {
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+  }
+  pool.join();
+  EXPECT_EQ(ran.load(std::memory_order_relaxed), total);
+}
+
+TEST(thread_pool_test, post_bulk_from_outside_and_from_a_worker_runs_everything) {
+  iocoro::thread_pool pool{2};
+  auto ex = pool.get_executor();
+
+  constexpr int outer = 100;
+  constexpr int inner = 1000;
+  std::atomic<int> ran{0};
+  auto make_batch = [&](int n) {
+    std::vector<iocoro::detail::unique_function<void()>> batch;
+    for (int i = 0; i < n; ++i) {
+      batch.emplace_back([&] { ran.fetch_add(1, std::memory_order_relaxed); });
+    }
+    return batch;
+  };
+
+  auto batch = make_batch(outer);
+  batch.emplace_back([&] {
+    // More than a worker queue holds: the remainder spills to the injection queue.
+    auto nested = make_batch(inner);
+    ex.post_bulk(nested);
+  });
+  ex.post_bulk(batch);
+
+  auto const deadline = std::chrono::steady_clock::now() + std::chrono::seconds{10};
+  while (ran.load() < outer + inner && std::chrono::steady_clock::now() < deadline) {
+    std::this_thread::sleep_for(std::chrono::milliseconds{1});
+  }
+  pool.join();
+  EXPECT_EQ(ran.load(), outer + inner);
+}
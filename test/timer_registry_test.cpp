@@ -7,6 +7,7 @@
 #include <atomic>
 #include <chrono>
 #include <cstddef>
+#include <cstdint>
 #include <thread>
 #include <vector>
 
@@ -124,3 +125,201 @@ TEST(timer_registry_test, stale_token_after_drain_all_does_not_cancel_new_timer)
   EXPECT_EQ(complete.load(std::memory_order_relaxed), 1);
   EXPECT_EQ(abort.load(std::memory_order_relaxed), 1);
 }
+
+namespace {
+
+struct record_state {
+  std::vector<int>* fired{};
+  int id = 0;
+
+  void on_complete() noexcept { fired->push_back(id); }
+  void on_abort(std::error_code) noexcept { fired->push_back(-id); }
+};
+
+auto add_recorded(iocoro::detail::timer_registry& reg, std::chrono::steady_clock::time_point at,
+                  std::vector<int>& fired, int id)
+  -> iocoro::detail::timer_registry::register_result {
+  return reg.add_timer(at,
+                       iocoro::detail::make_reactor_op<record_state>(record_state{&fired, id}));
+}
+
+void advance_to(iocoro::detail::timer_registry& reg, std::chrono::steady_clock::time_point now) {
+  std::vector<iocoro::detail::timer_registry::expired_op> ops;
+  reg.take_expired(ops, now);
+  (void)iocoro::detail::timer_registry::complete_expired(ops);
+}
+
+}  // namespace
+
+TEST(timer_registry_test, heap_next_timeout_skips_cancelled_top) {
+  iocoro::detail::timer_registry reg;
+  std::vector<int> fired;
+  auto const base = std::chrono::steady_clock::now();
+
+  auto first = add_recorded(reg, base + std::chrono::milliseconds{10}, fired, 1);
+  (void)add_recorded(reg, base + std::chrono::hours{1}, fired, 2);
+
+  auto cr = reg.cancel(first.index, first.token);
+  ASSERT_TRUE(cr.cancelled);
+  EXPECT_TRUE(cr.deferred);
+  abort_and_destroy(std::move(cr.op));
+
+  auto timeout = reg.next_timeout(base);
+  ASSERT_TRUE(timeout.has_value());
+  EXPECT_GT(*timeout, std::chrono::minutes{59});
+
+  (void)reg.drain_all();
+}
+
+TEST(timer_registry_test, heap_next_timeout_keeps_sub_millisecond_precision) {
+  iocoro::detail::timer_registry reg;
+  std::vector<int> fired;
+  auto const base = std::chrono::steady_clock::now();
+
+  (void)add_recorded(reg, base + std::chrono::microseconds{250}, fired, 1);
+  EXPECT_EQ(reg.next_timeout(base), std::chrono::microseconds{250});
+  EXPECT_EQ(reg.next_timeout(base + std::chrono::microseconds{100}),
+            std::chrono::microseconds{150});
+
+  (void)reg.drain_all();
+}
+
+TEST(timer_registry_test, wheel_fires_each_level_on_time_and_never_early) {
+  iocoro::detail::timer_registry reg{iocoro::detail::timer_queue_kind::wheel};
+  std::vector<int> fired;
+  auto const base = std::chrono::steady_clock::now();
+  using std::chrono::hours;
+  using std::chrono::milliseconds;
+  using std::chrono::seconds;
+
+  // One timer per wheel level, one beyond the wheel span, and one already due.
+  (void)add_recorded(reg, base + milliseconds{3}, fired, 1);
+  (void)add_recorded(reg, base + milliseconds{100}, fired, 2);
+  (void)add_recorded(reg, base + seconds{10}, fired, 3);
+  (void)add_recorded(reg, base + hours{2}, fired, 4);
+  (void)add_recorded(reg, base + hours{10}, fired, 5);
+  (void)add_recorded(reg, base - milliseconds{1}, fired, 6);
+
+  EXPECT_EQ(reg.next_timeout(base), milliseconds{0});
+  advance_to(reg, base);
+  EXPECT_EQ(fired, (std::vector<int>{6}));
+
+  struct step {
+    std::chrono::steady_clock::duration before;
+    std::chrono::steady_clock::duration after;
+    int id;
+  };
+  for (auto const& s : {step{milliseconds{2}, milliseconds{5}, 1},
+                        step{milliseconds{99}, milliseconds{102}, 2},
+                        step{seconds{10} - milliseconds{1}, seconds{10} + milliseconds{2}, 3},
+                        step{hours{2} - milliseconds{1}, hours{2} + milliseconds{2}, 4},
+                        step{hours{10} - milliseconds{1}, hours{10} + milliseconds{2}, 5}}) {
+    auto const count = fired.size();
+    advance_to(reg, base + s.before);
+    EXPECT_EQ(fired.size(), count) << "timer " << s.id << " fired early";
+    advance_to(reg, base + s.after);
+    ASSERT_EQ(fired.size(), count + 1) << "timer " << s.id << " did not fire";
+    EXPECT_EQ(fired.back(), s.id);
+  }
+  EXPECT_TRUE(reg.empty());
+  EXPECT_FALSE(reg.next_timeout(base + hours{11}).has_value());
+}
+
+TEST(timer_registry_test, wheel_next_timeout_never_overshoots_earliest_expiry) {
+  iocoro::detail::timer_registry reg{iocoro::detail::timer_queue_kind::wheel};
+  std::vector<int> fired;
+  auto const base = std::chrono::steady_clock::now();
+
+  auto far = add_recorded(reg, base + std::chrono::hours{1}, fired, 1);
+  EXPECT_TRUE(far.earliest);
+  auto near = add_recorded(reg, base + std::chrono::milliseconds{500}, fired, 2);
+  EXPECT_TRUE(near.earliest);
+  auto later = add_recorded(reg, base + std::chrono::seconds{30}, fired, 3);
+  EXPECT_FALSE(later.earliest);
+
+  // Walk the reactor loop: sleeping for `next_timeout()` each turn must reach the 500ms timer
+  // without passing it (intermediate wakeups only cascade entries between levels).
+  auto now = base;
+  for (int turn = 0; turn < 16 && fired.empty(); ++turn) {
+    auto timeout = reg.next_timeout(now);
+    ASSERT_TRUE(timeout.has_value());
+    now += *timeout;
+    advance_to(reg, now);
+  }
+  EXPECT_EQ(fired, (std::vector<int>{2}));
+  EXPECT_LE(now - base, std::chrono::milliseconds{502});
+
+  (void)reg.drain_all();
+}
+
+TEST(timer_registry_test, wheel_cancel_removes_timer_eagerly) {
+  iocoro::detail::timer_registry reg{iocoro::detail::timer_queue_kind::wheel};
+  std::vector<int> fired;
+  auto const base = std::chrono::steady_clock::now();
+
+  auto r1 = add_recorded(reg, base + std::chrono::hours{1}, fired, 1);
+  auto cr = reg.cancel(r1.index, r1.token);
+  ASSERT_TRUE(cr.cancelled);
+  EXPECT_FALSE(cr.deferred);
+  abort_and_destroy(std::move(cr.op));
+  EXPECT_EQ(fired, (std::vector<int>{-1}));
+
+  // Nothing is left queued: no wakeup is scheduled and the slot is free for reuse.
+  EXPECT_TRUE(reg.empty());
+  EXPECT_FALSE(reg.next_timeout(base).has_value());
+
+  auto r2 = add_recorded(reg, base + std::chrono::milliseconds{1}, fired, 2);
+  EXPECT_EQ(r2.index, r1.index);
+  EXPECT_NE(r2.token, r1.token);
+  EXPECT_FALSE(reg.cancel(r1.index, r1.token).cancelled);
+
+  advance_to(reg, base + std::chrono::milliseconds{3});
+  EXPECT_EQ(fired, (std::vector<int>{-1, 2}));
+}
+
+TEST(timer_registry_test, wheel_random_churn_fires_every_live_timer_within_one_tick) {
+  iocoro::detail::timer_registry reg{iocoro::detail::timer_queue_kind::wheel};
+  std::vector<int> fired;
+  auto const base = std::chrono::steady_clock::now();
+  using std::chrono::milliseconds;
+
+  // Deterministic LCG so failures are reproducible.
+  std::uint64_t seed = 0x9e3779b97f4a7c15ULL;
+  auto next = [&](std::uint64_t bound) {
+    seed = seed * 6364136223846793005ULL + 1442695040888963407ULL;
+    return (seed >> 33) % bound;
+  };
+
+  constexpr int count = 4000;
+  std::vector<std::chrono::steady_clock::time_point> expiry(count + 1);
+  std::vector<bool> cancelled(count + 1, false);
+  std::vector<iocoro::detail::timer_registry::register_result> handles(count + 1);
+  for (int id = 1; id <= count; ++id) {
+    // Mostly short timeouts, some spanning the upper wheel levels.
+    auto const span = (id % 10 == 0) ? std::uint64_t{6} * 3600 * 1000 : std::uint64_t{20'000};
+    expiry[id] = base + milliseconds{static_cast<std::int64_t>(next(span))};
+    handles[id] = add_recorded(reg, expiry[id], fired, id);
+  }
+  for (int id = 1; id <= count; id += 3) {
+    auto cr = reg.cancel(handles[id].index, handles[id].token);
+    ASSERT_TRUE(cr.cancelled);
+    cancelled[id] = true;
+    abort_and_destroy(std::move(cr.op));
+  }
+  fired.clear();
+
+  auto prev = base;
+  auto now = base;
+  while (!reg.empty()) {
+    now += milliseconds{1 + static_cast<std::int64_t>(next(5'000))};
+    advance_to(reg, now);
+    for (auto id : fired) {
+      ASSERT_GT(id, 0);
+      EXPECT_FALSE(cancelled[id]);
+      EXPECT_LE(expiry[id], now) << "timer " << id << " fired early";
+      EXPECT_LT(prev, expiry[id] + milliseconds{1}) << "timer " << id << " fired late";
+    }
+    fired.clear();
+    prev = now;
+  }
+}
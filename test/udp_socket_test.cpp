@@ -2,10 +2,14 @@
 
 #include <iocoro/io_context.hpp>
 #include <iocoro/ip/udp.hpp>
+#include <iocoro/net/buffer.hpp>
+#include <iocoro/socket_option.hpp>
 #include "test_util.hpp"
 
 #include <array>
 #include <cstring>
+#include <span>
+#include <string>
 
 TEST(udp_socket_test, basic_send_receive) {
   iocoro::io_context ctx;
@@ -96,3 +100,229 @@ TEST(udp_socket_test, connect_with_mismatched_family_on_open_socket_returns_inva
   ASSERT_FALSE(connect_r);
   EXPECT_EQ(connect_r.error(), iocoro::error::invalid_argument);
 }
+
+TEST(udp_socket_test, batch_send_and_receive_report_sizes_sources_and_truncation) {
+  iocoro::io_context ctx;
+  iocoro::ip::udp::socket s1{ctx};
+  iocoro::ip::udp::socket s2{ctx};
+
+  auto r1 = s1.bind(iocoro::ip::udp::endpoint{iocoro::ip::address_v4::loopback(), 0});
+  ASSERT_TRUE(r1) << r1.error().message();
+  auto r2 = s2.bind(iocoro::ip::udp::endpoint{iocoro::ip::address_v4::loopback(), 0});
+  ASSERT_TRUE(r2) << r2.error().message();
+
+  auto ep1 = s1.local_endpoint();
+  ASSERT_TRUE(ep1);
+  auto ep2 = s2.local_endpoint();
+  ASSERT_TRUE(ep2);
+
+  std::string const a = "one";
+  std::string const b = "three";
+  std::string const c = "a datagram too long for its slot";
+  std::array<iocoro::ip::udp::socket::outgoing_datagram_type, 3> out{{
+    {iocoro::net::buffer(a), *ep2},
+    {iocoro::net::buffer(b), *ep2},
+    {iocoro::net::buffer(c), *ep2},
+  }};
+
+  std::array<std::array<char, 8>, 4> storage{};
+  std::array<iocoro::ip::udp::socket::incoming_datagram_type, 4> in{};
+  for (std::size_t i = 0; i < in.size(); ++i) {
+    in[i].buffer = iocoro::net::buffer(storage[i]);
+  }
+
+  std::size_t received = 0;
+  auto r = iocoro::test::sync_wait(ctx, [&]() -> iocoro::awaitable<iocoro::result<std::size_t>> {
+    std::span<iocoro::ip::udp::socket::outgoing_datagram_type const> pending{out};
+    while (!pending.empty()) {
+      auto sent = co_await s1.async_send_batch(pending);
+      if (!sent) {
+        co_return iocoro::unexpected(sent.error());
+      }
+      pending = pending.subspan(*sent);
+    }
+
+    // Loopback delivery is synchronous, but a batch may still come back in pieces.
+    while (received < out.size()) {
+      auto got = co_await s2.async_receive_batch(std::span{in}.subspan(received));
+      if (!got) {
+        co_return iocoro::unexpected(got.error());
+      }
+      received += *got;
+    }
+    co_return received;
+  }());
+
+  ASSERT_TRUE(r);
+  ASSERT_TRUE(*r) << r->error().message();
+  ASSERT_EQ(**r, 3U);
+
+  EXPECT_EQ(in[0].size, 3U);
+  EXPECT_FALSE(in[0].truncated);
+  EXPECT_EQ(std::string(storage[0].data(), in[0].size), "one");
+  EXPECT_EQ(in[1].size, 5U);
+  EXPECT_EQ(std::string(storage[1].data(), in[1].size), "three");
+  EXPECT_EQ(in[2].size, 8U);
+  EXPECT_TRUE(in[2].truncated);
+  for (std::size_t i = 0; i < 3; ++i) {
+    EXPECT_EQ(in[i].source, *ep1);
+  }
+}
+
+TEST(udp_socket_test, batch_send_on_connected_socket_takes_plain_buffers) {
+  iocoro::io_context ctx;
+  iocoro::ip::udp::socket s1{ctx};
+  iocoro::ip::udp::socket s2{ctx};
+
+  auto r2 = s2.bind(iocoro::ip::udp::endpoint{iocoro::ip::address_v4::loopback(), 0});
+  ASSERT_TRUE(r2) << r2.error().message();
+  auto ep2 = s2.local_endpoint();
+  ASSERT_TRUE(ep2);
+  auto c1 = s1.connect(*ep2);
+  ASSERT_TRUE(c1) << c1.error().message();
+
+  std::string const a = "ab";
+  std::string const b = "cde";
+  std::array<iocoro::net::const_buffer, 2> out{iocoro::net::buffer(a), iocoro::net::buffer(b)};
+
+  auto r = iocoro::test::sync_wait(ctx, [&]() -> iocoro::awaitable<iocoro::result<std::size_t>> {
+    auto sent = co_await s1.async_send_batch(out);
+    if (!sent) {
+      co_return iocoro::unexpected(sent.error());
+    }
+    EXPECT_EQ(*sent, 2U);
+
+    // Another destination than the connected peer is rejected, as for async_send_to().
+    std::array<iocoro::ip::udp::socket::outgoing_datagram_type, 1> stray{
+      {{iocoro::net::buffer(a),
+        iocoro::ip::udp::endpoint{iocoro::ip::address_v4::loopback(), 9}}}};
+    auto rejected = co_await s1.async_send_batch(stray);
+    EXPECT_FALSE(rejected);
+    if (!rejected) {
+      EXPECT_EQ(rejected.error(), iocoro::error::invalid_argument);
+    }
+
+    std::array<char, 4> x{};
+    std::array<char, 4> y{};
+    std::array<iocoro::ip::udp::socket::incoming_datagram_type, 2> in{};
+    in[0].buffer = iocoro::net::buffer(x);
+    in[1].buffer = iocoro::net::buffer(y);
+    std::size_t received = 0;
+    while (received < in.size()) {
+      auto got = co_await s2.async_receive_batch(std::span{in}.subspan(received));
+      if (!got) {
+        co_return iocoro::unexpected(got.error());
+      }
+      received += *got;
+    }
+    EXPECT_EQ(std::string(x.data(), in[0].size), "ab");
+    EXPECT_EQ(std::string(y.data(), in[1].size), "cde");
+    co_return received;
+  }());
+
+  ASSERT_TRUE(r);
+  ASSERT_TRUE(*r) << r->error().message();
+  EXPECT_EQ(**r, 2U);
+}
+
+TEST(udp_socket_test, segmented_send_arrives_as_separate_datagrams) {
+  iocoro::io_context ctx;
+  iocoro::ip::udp::socket s1{ctx};
+  iocoro::ip::udp::socket s2{ctx};
+
+  auto r1 = s1.bind(iocoro::ip::udp::endpoint{iocoro::ip::address_v4::loopback(), 0});
+  ASSERT_TRUE(r1) << r1.error().message();
+  auto r2 = s2.bind(iocoro::ip::udp::endpoint{iocoro::ip::address_v4::loopback(), 0});
+  ASSERT_TRUE(r2) << r2.error().message();
+  auto ep2 = s2.local_endpoint();
+  ASSERT_TRUE(ep2);
+
+  std::string payload(250, 'x');
+  for (std::size_t i = 0; i < payload.size(); ++i) {
+    payload[i] = static_cast<char>('a' + i / 100);
+  }
+
+  auto r = iocoro::test::sync_wait(ctx, [&]() -> iocoro::awaitable<iocoro::result<std::size_t>> {
+    auto bad = co_await s1.async_send_to(iocoro::net::buffer(payload), *ep2, 70000);
+    EXPECT_FALSE(bad);
+    if (!bad) {
+      EXPECT_EQ(bad.error(), iocoro::error::invalid_argument);
+    }
+
+    auto sent = co_await s1.async_send_to(iocoro::net::buffer(payload), *ep2, 100);
+    if (!sent) {
+      co_return iocoro::unexpected(sent.error());
+    }
+    EXPECT_EQ(*sent, payload.size());
+
+    // GRO is off on the receiver: the kernel hands over each segment as its own datagram.
+    std::string got;
+    std::array<char, 512> in{};
+    iocoro::ip::udp::endpoint src{};
+    for (std::size_t expected : {100U, 100U, 50U}) {
+      std::size_t segment_size = 0;
+      auto n = co_await s2.async_receive_from(iocoro::net::buffer(in), src, segment_size);
+      if (!n) {
+        co_return iocoro::unexpected(n.error());
+      }
+      EXPECT_EQ(*n, expected);
+      EXPECT_EQ(segment_size, expected);
+      got.append(in.data(), *n);
+    }
+    EXPECT_EQ(got, payload);
+    co_return got.size();
+  }());
+
+  ASSERT_TRUE(r);
+  ASSERT_TRUE(*r) << r->error().message();
+  EXPECT_EQ(**r, 250U);
+}
+
+TEST(udp_socket_test, gro_receive_reports_the_segment_size_of_coalesced_datagrams) {
+  iocoro::io_context ctx;
+  iocoro::ip::udp::socket s1{ctx};
+  iocoro::ip::udp::socket s2{ctx};
+
+  auto r1 = s1.bind(iocoro::ip::udp::endpoint{iocoro::ip::address_v4::loopback(), 0});
+  ASSERT_TRUE(r1) << r1.error().message();
+  auto r2 = s2.bind(iocoro::ip::udp::endpoint{iocoro::ip::address_v4::loopback(), 0});
+  ASSERT_TRUE(r2) << r2.error().message();
+  if (!s2.set_option(iocoro::socket_option::udp::gro{true})) {
+    GTEST_SKIP() << "UDP_GRO not supported";
+  }
+  auto ep1 = s1.local_endpoint();
+  ASSERT_TRUE(ep1);
+  auto ep2 = s2.local_endpoint();
+  ASSERT_TRUE(ep2);
+
+  std::string const payload(1000, 'g');
+
+  auto r = iocoro::test::sync_wait(ctx, [&]() -> iocoro::awaitable<iocoro::result<std::size_t>> {
+    auto sent = co_await s1.async_send_to(iocoro::net::buffer(payload), *ep2, 200);
+    if (!sent) {
+      co_return iocoro::unexpected(sent.error());
+    }
+
+    // Whether the segments stay coalesced is up to the kernel; either way each receive reports
+    // the 200-byte segment size and the bytes add up.
+    std::array<char, 65536> in{};
+    std::size_t total = 0;
+    while (total < payload.size()) {
+      iocoro::ip::udp::endpoint src{};
+      std::size_t segment_size = 0;
+      auto n = co_await s2.async_receive_from(iocoro::net::buffer(in), src, segment_size);
+      if (!n) {
+        co_return iocoro::unexpected(n.error());
+      }
+      EXPECT_EQ(segment_size, 200U);
+      EXPECT_EQ(*n % 200, 0U);
+      EXPECT_EQ(src, *ep1);
+      total += *n;
+    }
+    co_return total;
+  }());
+
+  ASSERT_TRUE(r);
+  ASSERT_TRUE(*r) << r->error().message();
+  EXPECT_EQ(**r, 1000U);
+}
@@ -0,0 +1,877 @@
+#include <gtest/gtest.h>
+
+#include <iocoro/detail/reactor_backend.hpp>
+#include <iocoro/detail/reactor_types.hpp>
+#include <iocoro/error.hpp>
+#include <iocoro/io/read.hpp>
+#include <iocoro/io/write.hpp>
+#include <iocoro/io_context.hpp>
+#include <iocoro/ip/tcp.hpp>
+
+#include "test_util.hpp"
+
+#include <algorithm>
+#include <cerrno>
+#include <chrono>
+#include <csignal>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <functional>
+#include <future>
+#include <memory>
+#include <set>
+#include <span>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#include <fcntl.h>
+#include <netinet/in.h>
+#include <sys/socket.h>
+#include <unistd.h>
+
+// These cases drive the backend against the running kernel. Every build compiles them; they skip
+// unless the backend offers completion I/O (the io_uring configurations, see the build-test-uring
+// CI jobs) and the kernel runs the opcode under test.
+
+using namespace std::chrono_literals;
+
+namespace {
+
+using iocoro::detail::backend_interface;
+using iocoro::detail::backend_options;
+using iocoro::detail::io_request;
+using iocoro::test::unique_fd;
+
+struct flag_state {
+  bool* done{};
+  void on_complete() noexcept { *done = true; }
+  void on_abort(std::error_code) noexcept { *done = true; }
+};
+
+// Marks entry `index` of `done`.
+struct index_state {
+  std::vector<bool>* done{};
+  std::size_t index = 0;
+  void on_complete() noexcept { (*done)[index] = true; }
+  void on_abort(std::error_code) noexcept { (*done)[index] = true; }
+};
+
+// Records every result of a multishot stream.
+struct recording_sink final : iocoro::detail::io_stream_sink {
+  struct entry {
+    std::int32_t res = 0;
+    std::uint32_t buffer = iocoro::detail::no_provided_buffer;
+    bool more = false;
+  };
+  std::vector<entry> results;
+
+  void on_result(std::int32_t res, std::uint32_t buffer, bool more) noexcept override {
+    results.push_back(entry{res, buffer, more});
+  }
+  auto ended() const -> bool { return !results.empty() && !results.back().more; }
+};
+
+// Waits on `backend` until `done()` holds (at most 5 s), completing the operations it returns.
+void run_until(backend_interface& backend, std::function<bool()> const& done) {
+  std::vector<iocoro::detail::backend_event> events;
+  std::vector<iocoro::detail::reactor_op_ptr> ops;
+  auto const deadline = std::chrono::steady_clock::now() + 5s;
+  while (!done() && std::chrono::steady_clock::now() < deadline) {
+    backend.prepare_wait();
+    backend.wait(std::chrono::steady_clock::duration{10ms}, events);
+    backend.take_completions(ops);
+    for (auto& op : ops) {
+      op->vt->on_complete(op->block);
+    }
+    ops.clear();
+  }
+}
+
+// Submits `req` and waits for it; returns its result (or -ETIMEDOUT if it never completes).
+auto complete(backend_interface& backend, io_request req) -> std::int32_t {
+  std::int32_t res = -ETIMEDOUT;
+  bool done = false;
+  req.result = &res;
+  (void)backend.submit_io(req, iocoro::detail::make_reactor_op<flag_state>(flag_state{&done}));
+  run_until(backend, [&] { return done; });
+  return done ? res : -ETIMEDOUT;
+}
+
+// Connected TCP loopback pair: zero-copy sends need an inet socket.
+auto tcp_pair() -> std::pair<unique_fd, unique_fd> {
+  auto [listener, port] = iocoro::test::make_listen_socket_ipv4();
+  if (listener.get() < 0) {
+    return {};
+  }
+  unique_fd client{::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0)};
+  sockaddr_in addr{};
+  addr.sin_family = AF_INET;
+  addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+  addr.sin_port = htons(port);
+  if (::connect(client.get(), reinterpret_cast<sockaddr*>(&addr), sizeof(addr)) != 0) {
+    return {};
+  }
+  unique_fd server{::accept4(listener.get(), nullptr, nullptr, SOCK_CLOEXEC)};
+  if (server.get() < 0) {
+    return {};
+  }
+  return {std::move(client), std::move(server)};
+}
+
+auto recv_exactly(int fd, std::byte* data, std::size_t size) -> bool {
+  for (std::size_t got = 0; got < size;) {
+    auto const n = ::recv(fd, data + got, size - got, 0);
+    if (n <= 0) {
+      return false;
+    }
+    got += static_cast<std::size_t>(n);
+  }
+  return true;
+}
+
+}  // namespace
+
+TEST(uring_backend_test, send_zc_completes_once_the_kernel_releases_the_buffer) {
+  auto backend = iocoro::detail::make_backend();
+  if (!backend->supports_io_op(io_request::opcode::send_zc)) {
+    GTEST_SKIP() << "no IORING_OP_SEND_ZC";
+  }
+  auto [a, b] = tcp_pair();
+  ASSERT_GE(a.get(), 0);
+
+  std::vector<std::byte> payload(64 * 1024);
+  for (std::size_t i = 0; i < payload.size(); ++i) {
+    payload[i] = static_cast<std::byte>(i * 7);
+  }
+  std::int32_t res = 0;
+  bool done = false;
+  io_request req{.op = io_request::opcode::send_zc,
+                 .fd = a.get(),
+                 .data = payload.data(),
+                 .size = payload.size(),
+                 .result = &res};
+  (void)backend->submit_io(req, iocoro::detail::make_reactor_op<flag_state>(flag_state{&done}));
+  run_until(*backend, [&] { return done; });
+
+  // The op completes with the send's byte count, held back until the notification CQE.
+  ASSERT_TRUE(done);
+  ASSERT_GT(res, 0) << std::error_code(-res, std::generic_category()).message();
+  ASSERT_LE(static_cast<std::size_t>(res), payload.size());
+  std::vector<std::byte> got(static_cast<std::size_t>(res));
+  ASSERT_TRUE(recv_exactly(b.get(), got.data(), got.size()));
+  EXPECT_TRUE(std::equal(got.begin(), got.end(), payload.begin()));
+}
+
+TEST(uring_backend_test, splice_moves_bytes_between_a_socket_and_a_pipe) {
+  auto backend = iocoro::detail::make_backend();
+  if (!backend->supports_io_op(io_request::opcode::splice)) {
+    GTEST_SKIP() << "no IORING_OP_SPLICE";
+  }
+  auto [a, b] = tcp_pair();
+  ASSERT_GE(a.get(), 0);
+  int pipe_fds[2]{-1, -1};
+  ASSERT_EQ(::pipe2(pipe_fds, O_CLOEXEC), 0);
+  unique_fd const pipe_read{pipe_fds[0]};
+  unique_fd const pipe_write{pipe_fds[1]};
+
+  // Socket to pipe: `fd` is the source.
+  ASSERT_EQ(::send(b.get(), "inbound", 7, MSG_NOSIGNAL), 7);
+  auto in = complete(*backend, io_request{.op = io_request::opcode::splice,
+                                          .fd = a.get(),
+                                          .size = 64,
+                                          .splice_out = pipe_write.get()});
+  ASSERT_EQ(in, 7) << std::error_code(-in, std::generic_category()).message();
+  char buf[16]{};
+  ASSERT_EQ(::read(pipe_read.get(), buf, sizeof(buf)), 7);
+  EXPECT_EQ(std::string_view(buf, 7), "inbound");
+
+  // Pipe to socket: `fd` is the destination.
+  ASSERT_EQ(::write(pipe_write.get(), "outbound", 8), 8);
+  auto out = complete(*backend, io_request{.op = io_request::opcode::splice,
+                                           .fd = a.get(),
+                                           .size = 8,
+                                           .splice_in = pipe_read.get()});
+  ASSERT_EQ(out, 8) << std::error_code(-out, std::generic_category()).message();
+  std::vector<std::byte> got(8);
+  ASSERT_TRUE(recv_exactly(b.get(), got.data(), got.size()));
+  EXPECT_EQ(std::string_view(reinterpret_cast<char const*>(got.data()), got.size()), "outbound");
+}
+
+TEST(uring_backend_test, splice_into_a_reset_socket_fails_without_raising_sigpipe) {
+  auto backend = iocoro::detail::make_backend();
+  if (!backend->supports_io_op(io_request::opcode::splice)) {
+    GTEST_SKIP() << "no IORING_OP_SPLICE";
+  }
+  auto [a, b] = tcp_pair();
+  ASSERT_GE(a.get(), 0);
+  ::linger const abort_on_close{1, 0};
+  ASSERT_EQ(::setsockopt(b.get(), SOL_SOCKET, SO_LINGER, &abort_on_close, sizeof(abort_on_close)),
+            0);
+  b = unique_fd{};
+  int pipe_fds[2]{-1, -1};
+  ASSERT_EQ(::pipe2(pipe_fds, O_CLOEXEC), 0);
+  unique_fd const pipe_read{pipe_fds[0]};
+  unique_fd const pipe_write{pipe_fds[1]};
+
+  // The splice runs on an io-wq worker, which has every signal blocked; with the default
+  // disposition a SIGPIPE reaching this thread would end the test process. The first failure
+  // may report the reset itself; the splices after it fail with EPIPE.
+  auto const old_sigpipe = std::signal(SIGPIPE, SIG_DFL);
+  std::int32_t res = 0;
+  for (int i = 0; i < 100 && res != -EPIPE; ++i) {
+    ASSERT_EQ(::write(pipe_write.get(), "payload", 7), 7);
+    res = complete(*backend, io_request{.op = io_request::opcode::splice,
+                                        .fd = a.get(),
+                                        .size = 7,
+                                        .splice_in = pipe_read.get()});
+  }
+  std::signal(SIGPIPE, old_sigpipe);
+
+  EXPECT_EQ(res, -EPIPE) << std::error_code(-res, std::generic_category()).message();
+}
+
+TEST(uring_backend_test, requests_queued_between_waits_complete_in_one_wait) {
+  auto backend = iocoro::detail::make_backend();
+  if (!backend->supports_io_op(io_request::opcode::recv)) {
+    GTEST_SKIP() << "no IORING_OP_RECV";
+  }
+  // Every receive has its byte waiting, so each completes as the kernel takes its SQE: the one
+  // io_uring_enter() made by wait() both submits the batch and reaps all of it.
+  constexpr std::size_t count = 32;
+  std::vector<unique_fd> fds;
+  std::vector<char> bytes(count);
+  std::vector<std::int32_t> results(count, -1);
+  std::vector<bool> done(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    int sv[2]{-1, -1};
+    ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sv), 0);
+    fds.emplace_back(sv[0]);
+    fds.emplace_back(sv[1]);
+    char const c = static_cast<char>('a' + i % 26);
+    ASSERT_EQ(::send(sv[1], &c, 1, MSG_NOSIGNAL), 1);
+  }
+  for (std::size_t i = 0; i < count; ++i) {
+    (void)backend->submit_io(
+      io_request{.op = io_request::opcode::recv,
+                 .fd = fds[2 * i].get(),
+                 .data = &bytes[i],
+                 .size = 1,
+                 .result = &results[i]},
+      iocoro::detail::make_reactor_op<index_state>(index_state{&done, i}));
+  }
+
+  std::vector<iocoro::detail::backend_event> events;
+  std::vector<iocoro::detail::reactor_op_ptr> ops;
+  backend->prepare_wait();
+  backend->wait(std::chrono::steady_clock::duration{1s}, events);
+  backend->take_completions(ops);
+  EXPECT_EQ(ops.size(), count);
+  for (auto& op : ops) {
+    op->vt->on_complete(op->block);
+  }
+  for (std::size_t i = 0; i < count; ++i) {
+    EXPECT_TRUE(done[i]) << i;
+    EXPECT_EQ(results[i], 1) << i;
+    EXPECT_EQ(bytes[i], static_cast<char>('a' + i % 26)) << i;
+  }
+}
+
+TEST(uring_backend_test, batches_larger_than_the_submission_queue_are_submitted_in_parts) {
+  // With 8 SQEs, preparing the batch has to submit four times before the wait.
+  auto backend = iocoro::detail::make_backend(backend_options{.queue_depth = 8});
+  if (!backend->supports_io_op(io_request::opcode::recv)) {
+    GTEST_SKIP() << "no IORING_OP_RECV";
+  }
+  constexpr std::size_t count = 40;
+  std::vector<unique_fd> fds;
+  std::vector<char> bytes(count);
+  std::vector<std::int32_t> results(count, -1);
+  std::vector<bool> done(count);
+  for (std::size_t i = 0; i < count; ++i) {
+    int sv[2]{-1, -1};
+    ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sv), 0);
+    fds.emplace_back(sv[0]);
+    fds.emplace_back(sv[1]);
+  }
+  for (std::size_t i = 0; i < count; ++i) {
+    (void)backend->submit_io(
+      io_request{.op = io_request::opcode::recv,
+                 .fd = fds[2 * i].get(),
+                 .data = &bytes[i],
+                 .size = 1,
+                 .result = &results[i]},
+      iocoro::detail::make_reactor_op<index_state>(index_state{&done, i}));
+  }
+  // Data arrives only after the receives are in the kernel.
+  std::vector<iocoro::detail::backend_event> events;
+  backend->prepare_wait();
+  backend->wait(std::chrono::steady_clock::duration::zero(), events);
+  for (std::size_t i = 0; i < count; ++i) {
+    char const c = static_cast<char>('A' + i % 26);
+    ASSERT_EQ(::send(fds[2 * i + 1].get(), &c, 1, MSG_NOSIGNAL), 1);
+  }
+  run_until(*backend, [&] { return std::find(done.begin(), done.end(), false) == done.end(); });
+
+  for (std::size_t i = 0; i < count; ++i) {
+    EXPECT_TRUE(done[i]) << i;
+    EXPECT_EQ(results[i], 1) << i;
+    EXPECT_EQ(bytes[i], static_cast<char>('A' + i % 26)) << i;
+  }
+}
+
+TEST(uring_backend_test, multishot_accept_yields_each_connection_until_cancelled) {
+  auto backend = iocoro::detail::make_backend();
+  if (!backend->supports_multishot()) {
+    GTEST_SKIP() << "no multishot requests";
+  }
+  auto [listener, port] = iocoro::test::make_listen_socket_ipv4();
+  ASSERT_GE(listener.get(), 0);
+  auto sink = std::make_shared<recording_sink>();
+  auto const id = backend->submit_multishot(
+    io_request{.op = io_request::opcode::accept_multishot,
+               .fd = listener.get(),
+               .flags = SOCK_CLOEXEC},
+    sink);
+
+  // One submission, one result per connection, each flagged IORING_CQE_F_MORE.
+  std::vector<unique_fd> clients;
+  for (int i = 0; i < 3; ++i) {
+    unique_fd c{::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0)};
+    sockaddr_in addr{};
+    addr.sin_family = AF_INET;
+    addr.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    addr.sin_port = htons(port);
+    ASSERT_EQ(::connect(c.get(), reinterpret_cast<sockaddr*>(&addr), sizeof(addr)), 0);
+    clients.push_back(std::move(c));
+  }
+  run_until(*backend, [&] { return sink->results.size() >= 3 || sink->ended(); });
+  if (sink->ended() && sink->results.back().res == -EINVAL) {
+    GTEST_SKIP() << "kernel without multishot accept";
+  }
+  ASSERT_EQ(sink->results.size(), 3U);
+  for (auto const& r : sink->results) {
+    EXPECT_GE(r.res, 0) << std::error_code(-r.res, std::generic_category()).message();
+    EXPECT_TRUE(r.more);
+    unique_fd const accepted{r.res};
+  }
+
+  backend->cancel_io(id);
+  run_until(*backend, [&] { return sink->ended(); });
+  ASSERT_TRUE(sink->ended());
+  EXPECT_EQ(sink->results.size(), 4U);
+  EXPECT_EQ(sink->results.back().res, -ECANCELED);
+}
+
+TEST(uring_backend_test, multishot_receive_recycles_provided_buffers) {
+  auto backend = iocoro::detail::make_backend();
+  if (!backend->supports_multishot()) {
+    GTEST_SKIP() << "no multishot requests";
+  }
+  int sv[2]{-1, -1};
+  ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sv), 0);
+  unique_fd const reader{sv[0]};
+  unique_fd writer{sv[1]};
+  auto sink = std::make_shared<recording_sink>();
+  (void)backend->submit_multishot(
+    io_request{.op = io_request::opcode::recv_multishot, .fd = reader.get()}, sink);
+
+  // Three times as many messages as the ring has buffers: only recycling keeps it going.
+  constexpr std::size_t messages = 3 * iocoro::detail::provided_buffer_count;
+  std::set<std::uint32_t> ids;
+  for (std::size_t i = 0; i < messages; ++i) {
+    auto const msg = std::to_string(i);
+    ASSERT_EQ(::send(writer.get(), msg.data(), msg.size(), MSG_NOSIGNAL),
+              static_cast<ssize_t>(msg.size()));
+    run_until(*backend, [&] { return sink->results.size() > i; });
+    ASSERT_EQ(sink->results.size(), i + 1);
+    auto const r = sink->results.back();
+    if (i == 0 && r.res == -EINVAL) {
+      GTEST_SKIP() << "kernel without multishot receive or provided-buffer rings";
+    }
+    ASSERT_EQ(r.res, static_cast<std::int32_t>(msg.size())) << i;
+    ASSERT_NE(r.buffer, iocoro::detail::no_provided_buffer);
+    ASSERT_TRUE(r.more) << i;
+    auto const data = backend->provided_buffer(r.buffer);
+    EXPECT_EQ(std::string_view(reinterpret_cast<char const*>(data.data()), msg.size()), msg);
+    ids.insert(r.buffer);
+    backend->recycle_buffer(r.buffer);
+  }
+  EXPECT_LE(ids.size(), std::size_t{iocoro::detail::provided_buffer_count});
+
+  // End of stream ends the request.
+  writer = unique_fd{};
+  run_until(*backend, [&] { return sink->ended(); });
+  ASSERT_TRUE(sink->ended());
+  EXPECT_EQ(sink->results.back().res, 0);
+}
+
+TEST(uring_backend_test, multishot_receive_ends_when_the_ring_runs_dry_and_can_be_rearmed) {
+  auto backend = iocoro::detail::make_backend();
+  if (!backend->supports_multishot()) {
+    GTEST_SKIP() << "no multishot requests";
+  }
+  int sv[2]{-1, -1};
+  ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sv), 0);
+  unique_fd const reader{sv[0]};
+  unique_fd const writer{sv[1]};
+  io_request const req{.op = io_request::opcode::recv_multishot, .fd = reader.get()};
+  auto sink = std::make_shared<recording_sink>();
+  (void)backend->submit_multishot(req, sink);
+
+  // Hold on to every buffer: once the ring is empty the kernel ends the request with -ENOBUFS
+  // and without IORING_CQE_F_MORE, leaving the next message in the socket.
+  std::vector<std::uint32_t> held;
+  for (std::uint32_t i = 0; i <= iocoro::detail::provided_buffer_count && !sink->ended(); ++i) {
+    ASSERT_EQ(::send(writer.get(), "x", 1, MSG_NOSIGNAL), 1);
+    run_until(*backend, [&] { return sink->results.size() > i; });
+    ASSERT_EQ(sink->results.size(), i + 1);
+    if (auto const& r = sink->results.back(); r.res > 0) {
+      held.push_back(r.buffer);
+    }
+  }
+  ASSERT_TRUE(sink->ended());
+  if (sink->results.size() == 1 && sink->results.back().res == -EINVAL) {
+    GTEST_SKIP() << "kernel without multishot receive or provided-buffer rings";
+  }
+  EXPECT_EQ(sink->results.back().res, -ENOBUFS);
+  EXPECT_EQ(held.size(), std::size_t{iocoro::detail::provided_buffer_count});
+
+  // Returning the buffers and submitting again picks up where the first request stopped.
+  for (auto const id : held) {
+    backend->recycle_buffer(id);
+  }
+  auto rearmed = std::make_shared<recording_sink>();
+  (void)backend->submit_multishot(req, rearmed);
+  run_until(*backend, [&] { return !rearmed->results.empty(); });
+  ASSERT_FALSE(rearmed->results.empty());
+  auto const r = rearmed->results.front();
+  ASSERT_EQ(r.res, 1) << std::error_code(-r.res, std::generic_category()).message();
+  EXPECT_TRUE(r.more);
+  EXPECT_EQ(static_cast<char>(backend->provided_buffer(r.buffer)[0]), 'x');
+  backend->recycle_buffer(r.buffer);
+}
+
+TEST(uring_backend_test, acceptor_rearms_multishot_accept_after_its_queue_fills) {
+  if (!iocoro::detail::make_backend()->supports_multishot()) {
+    GTEST_SKIP() << "no multishot requests";
+  }
+  iocoro::io_context ctx;
+  iocoro::ip::tcp::acceptor acc{ctx};
+  ASSERT_TRUE(acc.listen(iocoro::ip::tcp::endpoint{iocoro::ip::address_v4::loopback(), 0}));
+  // Two queued connections disarm the request; the rest need it armed again.
+  acc.set_multishot_accept(2);
+  auto const ep = acc.local_endpoint();
+  ASSERT_TRUE(ep);
+
+  std::vector<unique_fd> clients;
+  for (int i = 0; i < 5; ++i) {
+    unique_fd c{::socket(AF_INET, SOCK_STREAM | SOCK_CLOEXEC, 0)};
+    ASSERT_EQ(::connect(c.get(), ep->data(), ep->size()), 0);
+    clients.push_back(std::move(c));
+  }
+
+  auto r = iocoro::test::sync_wait(ctx, [&]() -> iocoro::awaitable<iocoro::result<int>> {
+    int accepted = 0;
+    for (std::size_t i = 0; i < clients.size(); ++i) {
+      auto s = co_await acc.async_accept();
+      if (!s) {
+        co_return iocoro::unexpected(s.error());
+      }
+      ++accepted;
+    }
+    co_return accepted;
+  }());
+
+  ASSERT_TRUE(r);
+  ASSERT_TRUE(*r) << r->error().message();
+  EXPECT_EQ(**r, 5);
+}
+
+TEST(uring_backend_test, receive_buffer_keeps_going_when_held_buffers_drain_the_ring) {
+  if (!iocoro::detail::make_backend()->supports_multishot()) {
+    GTEST_SKIP() << "no multishot requests";
+  }
+  // Three times what the ring holds, with every buffer kept until 300 are held.
+  std::string content(3 * iocoro::detail::provided_buffer_count *
+                        iocoro::detail::provided_buffer_size,
+                      '\0');
+  for (std::size_t i = 0; i < content.size(); ++i) {
+    content[i] = static_cast<char>('a' + (i * 13) % 26);
+  }
+  auto [listener, port] = iocoro::test::make_listen_socket_ipv4();
+  ASSERT_GE(listener.get(), 0);
+  std::thread peer([fd = listener.get(), &content] {
+    unique_fd conn{::accept(fd, nullptr, nullptr)};
+    for (std::size_t done = 0; conn.get() >= 0 && done < content.size();) {
+      auto const n = ::send(conn.get(), content.data() + done, content.size() - done, MSG_NOSIGNAL);
+      if (n <= 0) {
+        break;
+      }
+      done += static_cast<std::size_t>(n);
+    }
+  });
+
+  iocoro::io_context ctx;
+  iocoro::ip::tcp::socket sock{ctx};
+  std::string received;
+  auto r = iocoro::test::sync_wait(ctx, [&]() -> iocoro::awaitable<iocoro::result<void>> {
+    auto cr = co_await sock.async_connect(
+      iocoro::ip::tcp::endpoint{iocoro::ip::address_v4::loopback(), port});
+    if (!cr) {
+      co_return iocoro::unexpected(cr.error());
+    }
+    // The ring runs dry while these are held: the stream ends (-ENOBUFS), the socket falls
+    // back to plain reads and arms a new request on the next call, which gets buffers again
+    // once these are released.
+    std::vector<iocoro::received_buffer> held;
+    for (;;) {
+      auto b = co_await sock.async_receive_buffer();
+      if (!b) {
+        co_return iocoro::unexpected(b.error());
+      }
+      if (b->empty()) {
+        co_return iocoro::result<void>{};
+      }
+      received.append(reinterpret_cast<char const*>(b->data().data()), b->size());
+      if (held.size() < 300) {
+        held.push_back(std::move(*b));
+      } else {
+        held.clear();
+      }
+    }
+  }());
+  peer.join();
+
+  ASSERT_TRUE(r);
+  ASSERT_TRUE(*r) << r->error().message();
+  EXPECT_EQ(received.size(), content.size());
+  EXPECT_TRUE(received == content);
+}
+
+TEST(uring_backend_test, registered_file_slot_stands_in_for_the_descriptor) {
+  // Without a single issuer the table is updated at once; with one, by the next wait().
+  for (bool const single_issuer : {false, true}) {
+    SCOPED_TRACE(single_issuer ? "single issuer" : "any issuer");
+    auto backend = iocoro::detail::make_backend(backend_options{.single_issuer = single_issuer});
+    if (!backend->supports_io()) {
+      GTEST_SKIP() << "no completion I/O";
+    }
+    int sv[2]{-1, -1};
+    ASSERT_EQ(::socketpair(AF_UNIX, SOCK_STREAM | SOCK_CLOEXEC, 0, sv), 0);
+    unique_fd const a{sv[0]};
+    unique_fd const b{sv[1]};
+    auto const slot = backend->register_file(a.get());
+    if (slot < 0) {
+      GTEST_SKIP() << "no sparse registered-file table";
+    }
+
+    char out[] = "fixed file";
+    auto sent = complete(*backend, io_request{.op = io_request::opcode::send,
+                                              .fd = a.get(),
+                                              .data = out,
+                                              .size = sizeof(out),
+                                              .fixed_file = slot});
+    ASSERT_EQ(sent, static_cast<std::int32_t>(sizeof(out)))
+      << std::error_code(-sent, std::generic_category()).message();
+    std::vector<std::byte> got(sizeof(out));
+    ASSERT_TRUE(recv_exactly(b.get(), got.data(), got.size()));
+    EXPECT_EQ(std::memcmp(got.data(), out, sizeof(out)), 0);
+
+    ASSERT_EQ(::send(b.get(), "back", 4, MSG_NOSIGNAL), 4);
+    char in[8]{};
+    auto received = complete(*backend, io_request{.op = io_request::opcode::recv,
+                                                  .fd = a.get(),
+                                                  .data = in,
+                                                  .size = sizeof(in),
+                                                  .fixed_file = slot});
+    ASSERT_EQ(received, 4) << std::error_code(-received, std::generic_category()).message();
+    EXPECT_EQ(std::string_view(in, 4), "back");
+    backend->unregister_file(slot);
+  }
+}
+
+TEST(uring_backend_test, fixed_buffers_carry_reads_and_writes) {
+  auto backend = iocoro::detail::make_backend();
+  if (!backend->supports_io_op(io_request::opcode::read_fixed) ||
+      !backend->supports_io_op(io_request::opcode::write_fixed)) {
+    GTEST_SKIP() << "no IORING_OP_READ_FIXED / WRITE_FIXED";
+  }
+  std::vector<std::byte> region(64 * 1024);
+  std::span<std::byte> const table[] = {std::span{region}};
+  ASSERT_EQ(backend->register_buffers(table), 0);
+  auto [a, b] = tcp_pair();
+  ASSERT_GE(a.get(), 0);
+
+  // Write from the first half, read into the second; any sub-range of the buffer qualifies.
+  auto const half = region.size() / 2;
+  for (std::size_t i = 0; i < half; ++i) {
+    region[i] = static_cast<std::byte>(i * 5);
+  }
+  auto const written = complete(*backend, io_request{.op = io_request::opcode::write_fixed,
+                                                     .fd = a.get(),
+                                                     .data = region.data() + 16,
+                                                     .size = 1024,
+                                                     .buf_index = 0});
+  ASSERT_EQ(written, 1024) << std::error_code(-written, std::generic_category()).message();
+  std::vector<std::byte> got(1024);
+  ASSERT_TRUE(recv_exactly(b.get(), got.data(), got.size()));
+  EXPECT_TRUE(std::equal(got.begin(), got.end(), region.begin() + 16));
+
+  ASSERT_EQ(::send(b.get(), got.data(), got.size(), MSG_NOSIGNAL), 1024);
+  std::size_t read = 0;
+  while (read < got.size()) {
+    auto const n = complete(*backend, io_request{.op = io_request::opcode::read_fixed,
+                                                 .fd = a.get(),
+                                                 .data = region.data() + half + read,
+                                                 .size = got.size() - read,
+                                                 .buf_index = 0});
+    ASSERT_GT(n, 0) << std::error_code(-n, std::generic_category()).message();
+    read += static_cast<std::size_t>(n);
+  }
+  EXPECT_TRUE(std::equal(got.begin(), got.end(), region.begin() + half));
+
+  EXPECT_EQ(backend->register_buffers({}), 0);
+}
+
+TEST(uring_backend_test, socket_io_through_registered_buffers) {
+  if (!iocoro::detail::make_backend()->supports_io_op(io_request::opcode::write_fixed)) {
+    GTEST_SKIP() << "no IORING_OP_WRITE_FIXED";
+  }
+  // Ignored while registering, so writes go out as WRITE_FIXED as well.
+  auto const old_sigpipe = std::signal(SIGPIPE, SIG_IGN);
+  iocoro::io_context ctx;
+  std::vector<std::byte> region(16 * 1024);
+  std::span<std::byte> const table[] = {std::span{region}};
+  auto const reg = ctx.register_buffers(table);
+  std::signal(SIGPIPE, old_sigpipe);
+  ASSERT_TRUE(reg) << reg.error().message();
+
+  auto [listener, port] = iocoro::test::make_listen_socket_ipv4();
+  ASSERT_GE(listener.get(), 0);
+  // Echoes everything back until the client hangs up.
+  std::thread peer([fd = listener.get()] {
+    unique_fd conn{::accept(fd, nullptr, nullptr)};
+    std::byte buf[4096];
+    for (;;) {
+      auto const n = conn.get() < 0 ? -1 : ::recv(conn.get(), buf, sizeof(buf), 0);
+      if (n <= 0 || ::send(conn.get(), buf, static_cast<std::size_t>(n), MSG_NOSIGNAL) != n) {
+        return;
+      }
+    }
+  });
+
+  auto const out = std::span{region}.first(4096);
+  auto const in = std::span{region}.subspan(8192, 4096);
+  for (std::size_t i = 0; i < out.size(); ++i) {
+    out[i] = static_cast<std::byte>(i * 3);
+  }
+  iocoro::ip::tcp::socket sock{ctx};
+  auto r = iocoro::test::sync_wait(ctx, [&]() -> iocoro::awaitable<iocoro::result<void>> {
+    auto cr = co_await sock.async_connect(
+      iocoro::ip::tcp::endpoint{iocoro::ip::address_v4::loopback(), port});
+    if (!cr) {
+      co_return iocoro::unexpected(cr.error());
+    }
+    auto w = co_await iocoro::io::async_write(sock, std::span<std::byte const>{out});
+    if (!w) {
+      co_return iocoro::unexpected(w.error());
+    }
+    auto rd = co_await iocoro::io::async_read(sock, in);
+    if (!rd) {
+      co_return iocoro::unexpected(rd.error());
+    }
+    co_return iocoro::result<void>{};
+  }());
+  (void)sock.close();
+  peer.join();
+
+  ASSERT_TRUE(r);
+  ASSERT_TRUE(*r) << r->error().message();
+  EXPECT_TRUE(std::equal(out.begin(), out.end(), in.begin()));
+}
+
+TEST(uring_backend_test, registered_buffer_writes_need_sigpipe_ignored_at_registration) {
+  if (!iocoro::detail::make_backend()->supports_io_op(io_request::opcode::write_fixed)) {
+    GTEST_SKIP() << "no IORING_OP_WRITE_FIXED";
+  }
+  // SIGPIPE keeps its default disposition throughout: a WRITE_FIXED into the reset connection
+  // would end the test process, so the writes must go out as plain sends.
+  auto const old_sigpipe = std::signal(SIGPIPE, SIG_DFL);
+  iocoro::io_context ctx;
+  std::vector<std::byte> region(4096);
+  std::span<std::byte> const table[] = {std::span{region}};
+  ASSERT_TRUE(ctx.register_buffers(table));
+
+  auto [listener, port] = iocoro::test::make_listen_socket_ipv4();
+  ASSERT_GE(listener.get(), 0);
+  std::promise<void> connected;
+  std::thread peer([fd = listener.get(), established = connected.get_future()] {
+    int conn = ::accept(fd, nullptr, nullptr);
+    if (conn < 0) {
+      return;
+    }
+    established.wait();
+    ::linger const abort_on_close{1, 0};
+    (void)::setsockopt(conn, SOL_SOCKET, SO_LINGER, &abort_on_close, sizeof(abort_on_close));
+    (void)::close(conn);
+  });
+
+  iocoro::ip::tcp::socket sock{ctx};
+  auto r = iocoro::test::sync_wait(ctx, [&]() -> iocoro::awaitable<iocoro::result<std::size_t>> {
+    auto cr = co_await sock.async_connect(
+      iocoro::ip::tcp::endpoint{iocoro::ip::address_v4::loopback(), port});
+    connected.set_value();
+    peer.join();
+    if (!cr) {
+      co_return iocoro::unexpected(cr.error());
+    }
+    // The first failure may report the reset itself; the writes after it fail with EPIPE.
+    iocoro::result<std::size_t> n{};
+    for (int i = 0; i < 100; ++i) {
+      n = co_await sock.async_write_some(std::span<std::byte const>{region});
+      if (!n && n.error() == iocoro::error::broken_pipe) {
+        break;
+      }
+    }
+    co_return n;
+  }());
+  std::signal(SIGPIPE, old_sigpipe);
+
+  ASSERT_TRUE(r);
+  ASSERT_FALSE(*r);
+  EXPECT_EQ(r->error(), iocoro::error::broken_pipe) << r->error().message();
+}
+
+namespace {
+
+// Connects to an echo peer through `ctx` and round-trips `msg`.
+auto echo_once(iocoro::io_context& ctx, std::string const& msg) -> iocoro::result<std::string> {
+  auto [listener, port] = iocoro::test::make_listen_socket_ipv4();
+  if (listener.get() < 0) {
+    return iocoro::unexpected(std::make_error_code(std::errc::bad_file_descriptor));
+  }
+  std::thread peer([fd = listener.get()] {
+    unique_fd conn{::accept(fd, nullptr, nullptr)};
+    char buf[256];
+    auto const n = conn.get() < 0 ? -1 : ::recv(conn.get(), buf, sizeof(buf), 0);
+    if (n > 0) {
+      (void)::send(conn.get(), buf, static_cast<std::size_t>(n), MSG_NOSIGNAL);
+    }
+  });
+
+  iocoro::ip::tcp::socket sock{ctx};
+  std::string in(msg.size(), '\0');
+  auto r = iocoro::test::sync_wait(ctx, [&]() -> iocoro::awaitable<iocoro::result<void>> {
+    auto cr = co_await sock.async_connect(
+      iocoro::ip::tcp::endpoint{iocoro::ip::address_v4::loopback(), port});
+    if (!cr) {
+      co_return iocoro::unexpected(cr.error());
+    }
+    auto w = co_await iocoro::io::async_write(sock, std::as_bytes(std::span{msg}));
+    if (!w) {
+      co_return iocoro::unexpected(w.error());
+    }
+    auto rd = co_await iocoro::io::async_read(sock, std::as_writable_bytes(std::span{in}));
+    if (!rd) {
+      co_return iocoro::unexpected(rd.error());
+    }
+    co_return iocoro::result<void>{};
+  }());
+  (void)sock.close();
+  peer.join();
+  if (!r) {
+    return iocoro::unexpected(std::make_error_code(std::errc::timed_out));
+  }
+  if (!*r) {
+    return iocoro::unexpected(r->error());
+  }
+  return in;
+}
+
+}  // namespace
+
+TEST(uring_backend_test, each_setup_flag_yields_a_working_context) {
+  if (!iocoro::detail::make_backend()->supports_io()) {
+    GTEST_SKIP() << "no completion I/O";
+  }
+  struct setup_case {
+    char const* name;
+    backend_options opts;
+    bool single_issuer;
+  };
+  setup_case const cases[] = {
+    {"sqpoll", {.sqpoll = true, .sqpoll_idle = std::chrono::milliseconds{5}}, false},
+    {"sqpoll pinned to cpu 0", {.sqpoll = true, .sqpoll_cpu = 0}, false},
+    {"single_issuer", {.single_issuer = true}, true},
+    {"defer_taskrun", {.defer_taskrun = true}, true},
+    {"coop_taskrun", {.coop_taskrun = true}, false},
+    {"sqpoll + single_issuer", {.sqpoll = true, .single_issuer = true}, true},
+    {"single_issuer + coop_taskrun", {.single_issuer = true, .coop_taskrun = true}, true},
+  };
+  for (auto const& c : cases) {
+    SCOPED_TRACE(c.name);
+    EXPECT_EQ(iocoro::detail::make_backend(c.opts)->single_issuer(), c.single_issuer);
+    iocoro::io_context ctx{iocoro::io_context::options{.backend = c.opts}};
+    auto r = echo_once(ctx, c.name);
+    ASSERT_TRUE(r) << r.error().message();
+    EXPECT_EQ(*r, c.name);
+  }
+}
+
+TEST(uring_backend_test, setup_drops_task_run_flags_the_kernel_rejects) {
+  if (!iocoro::detail::make_backend()->supports_io()) {
+    GTEST_SKIP() << "no completion I/O";
+  }
+  // The kernel refuses COOP_TASKRUN and DEFER_TASKRUN next to SQPOLL with -EINVAL. The ring is
+  // set up without them; DEFER_TASKRUN's single issuer is kept.
+  struct setup_case {
+    char const* name;
+    backend_options opts;
+    bool single_issuer;
+  };
+  setup_case const cases[] = {
+    {"sqpoll + coop_taskrun", {.sqpoll = true, .coop_taskrun = true}, false},
+    {"sqpoll + defer_taskrun", {.sqpoll = true, .defer_taskrun = true}, true},
+  };
+  for (auto const& c : cases) {
+    SCOPED_TRACE(c.name);
+    std::unique_ptr<backend_interface> backend;
+    ASSERT_NO_THROW(backend = iocoro::detail::make_backend(c.opts));
+    EXPECT_EQ(backend->single_issuer(), c.single_issuer);
+    iocoro::io_context ctx{iocoro::io_context::options{.backend = c.opts}};
+    auto r = echo_once(ctx, c.name);
+    ASSERT_TRUE(r) << r.error().message();
+    EXPECT_EQ(*r, c.name);
+  }
+}
+
+TEST(uring_backend_test, single_issuer_ring_refuses_a_second_waiting_thread) {
+  auto backend = iocoro::detail::make_backend(backend_options{.single_issuer = true});
+  if (!backend->supports_io()) {
+    GTEST_SKIP() << "no completion I/O";
+  }
+  // The first thread to wait enables the ring and becomes its issuer.
+  std::vector<iocoro::detail::backend_event> events;
+  backend->prepare_wait();
+  backend->wait(std::chrono::steady_clock::duration::zero(), events);
+
+  std::error_code other{};
+  std::thread([&] {
+    std::vector<iocoro::detail::backend_event> ev;
+    try {
+      backend->prepare_wait();
+      backend->wait(std::chrono::steady_clock::duration::zero(), ev);
+    } catch (std::system_error const& e) {
+      other = e.code();
+    }
+  }).join();
+  EXPECT_EQ(other, std::errc::file_exists);
+
+  backend->prepare_wait();
+  EXPECT_NO_THROW(backend->wait(std::chrono::steady_clock::duration::zero(), events));
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+
+#include <iocoro/detail/work_stealing_deque.hpp>
+
+#include <array>
+#include <atomic>
+#include <thread>
+#include <vector>
+
+TEST(work_stealing_deque_test, push_reports_full_and_take_is_fifo) {
+  iocoro::detail::work_stealing_deque<int, 4> dq{};
+  std::array<int, 5> items{0, 1, 2, 3, 4};
+
+  EXPECT_TRUE(dq.empty());
+  EXPECT_EQ(dq.take(), nullptr);
+  for (int i = 0; i < 4; ++i) {
+    EXPECT_TRUE(dq.push(&items[static_cast<std::size_t>(i)]));
+  }
+  EXPECT_FALSE(dq.push(&items[4]));
+
+  EXPECT_EQ(dq.take(), &items[0]);
+  EXPECT_TRUE(dq.push(&items[4]));
+  for (std::size_t i = 1; i < items.size(); ++i) {
+    EXPECT_EQ(dq.take(), &items[i]);
+  }
+  EXPECT_TRUE(dq.empty());
+}
+
+TEST(work_stealing_deque_test, concurrent_thieves_take_every_item_exactly_once) {
+  constexpr int total = 20000;
+  iocoro::detail::work_stealing_deque<int, 64> dq{};
+  std::vector<int> items(total);
+  std::vector<std::atomic<int>> taken(total);
+  std::atomic<bool> done{false};
+
+  auto record = [&](int* p) { taken[static_cast<std::size_t>(p - items.data())].fetch_add(1); };
+
+  std::vector<std::jthread> thieves;
+  for (int i = 0; i < 3; ++i) {
+    thieves.emplace_back([&] {
+      while (!done.load(std::memory_order_acquire) || !dq.empty()) {
+        if (auto* p = dq.steal()) {
+          record(p);
+        }
+      }
+    });
+  }
+
+  for (int i = 0; i < total; ++i) {
+    while (!dq.push(&items[static_cast<std::size_t>(i)])) {
+      if (auto* p = dq.take()) {
+        record(p);
+      }
+    }
+  }
+  done.store(true, std::memory_order_release);
+  thieves.clear();
+
+  for (auto const& n : taken) {
+    EXPECT_EQ(n.load(), 1);
+  }
+}
+
+TEST(work_stealing_deque_test, owner_pop_is_lifo_and_steal_is_fifo) {
+  iocoro::detail::work_stealing_deque<int, 4> dq{};
+  std::array<int, 3> items{0, 1, 2};
+
+  EXPECT_EQ(dq.pop(), nullptr);
+  for (auto& item : items) {
+    EXPECT_TRUE(dq.push(&item));
+  }
+  EXPECT_EQ(dq.pop(), &items[2]);
+  EXPECT_EQ(dq.steal(), &items[0]);
+  EXPECT_EQ(dq.pop(), &items[1]);
+  EXPECT_EQ(dq.pop(), nullptr);
+  EXPECT_TRUE(dq.empty());
+}
+
+TEST(work_stealing_deque_test, owner_pops_and_thieves_take_every_item_exactly_once) {
+  constexpr int total = 20000;
+  iocoro::detail::work_stealing_deque<int, 64> dq{};
+  std::vector<int> items(total);
+  std::vector<std::atomic<int>> taken(total);
+  std::atomic<bool> done{false};
+
+  auto record = [&](int* p) { taken[static_cast<std::size_t>(p - items.data())].fetch_add(1); };
+
+  std::vector<std::jthread> thieves;
+  for (int i = 0; i < 3; ++i) {
+    thieves.emplace_back([&] {
+      while (!done.load(std::memory_order_acquire) || !dq.empty()) {
+        if (auto* p = dq.steal()) {
+          record(p);
+        }
+      }
+    });
+  }
+
+  // Keep the deque short so that the owner keeps racing the thieves for the last element.
+  for (int i = 0; i < total; ++i) {
+    while (!dq.push(&items[static_cast<std::size_t>(i)])) {
+      if (auto* p = dq.pop()) {
+        record(p);
+      }
+    }
+    if (i % 2 == 1) {
+      if (auto* p = dq.pop()) {
+        record(p);
+      }
+    }
+  }
+  while (auto* p = dq.pop()) {
+    record(p);
+  }
+  done.store(true, std::memory_order_release);
+  thieves.clear();
+
+  for (auto const& n : taken) {
+    EXPECT_EQ(n.load(), 1);
+  }
+}